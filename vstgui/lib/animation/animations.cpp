@@ -95,6 +95,88 @@ void ViewSizeAnimation::animationTick (CView* view, IdStringPtr name, float pos)
 	}
 }
 
+//-----------------------------------------------------------------------------
+/** @class CompositeAlphaAnimation
+	see @ref page_animation Support */
+//-----------------------------------------------------------------------------
+void CompositeAlphaAnimation::animationStart (CView* view, IdStringPtr name)
+{
+	view->enableCompositeLayer ();
+	AlphaValueAnimation::animationStart (view, name);
+}
+
+//-----------------------------------------------------------------------------
+void CompositeAlphaAnimation::animationFinished (CView* view, IdStringPtr name, bool wasCanceled)
+{
+	AlphaValueAnimation::animationFinished (view, name, wasCanceled);
+	view->disableCompositeLayer ();
+}
+
+//-----------------------------------------------------------------------------
+/** @class CompositeViewSizeAnimation
+	see @ref page_animation Support */
+//-----------------------------------------------------------------------------
+CompositeViewSizeAnimation::CompositeViewSizeAnimation (const CRect& inNewRect,
+                                                        bool forceEndValueOnFinish)
+: newRect (inNewRect)
+, forceEndValueOnFinish (forceEndValueOnFinish)
+{
+}
+
+//-----------------------------------------------------------------------------
+void CompositeViewSizeAnimation::animationStart (CView* view, IdStringPtr name)
+{
+	startRect = currentRect = view->getViewSize ();
+	view->enableCompositeLayer ();
+}
+
+//-----------------------------------------------------------------------------
+void CompositeViewSizeAnimation::animationTick (CView* view, IdStringPtr name, float pos)
+{
+	currentRect.left = startRect.left + ((newRect.left - startRect.left) * pos);
+	currentRect.right = startRect.right + ((newRect.right - startRect.right) * pos);
+	currentRect.top = startRect.top + ((newRect.top - startRect.top) * pos);
+	currentRect.bottom = startRect.bottom + ((newRect.bottom - startRect.bottom) * pos);
+	if (startRect.getWidth () <= 0. || startRect.getHeight () <= 0.)
+	{
+		// an empty layer can not be scaled
+		if (view->getViewSize () != currentRect)
+		{
+			view->invalid ();
+			view->setViewSize (currentRect);
+			view->setMouseableArea (currentRect);
+			view->invalid ();
+		}
+		return;
+	}
+	CGraphicsTransform transform;
+	transform.scale (currentRect.getWidth () / startRect.getWidth (),
+	                 currentRect.getHeight () / startRect.getHeight ());
+	transform.translate (currentRect.left - startRect.left, currentRect.top - startRect.top);
+	view->setCompositeTransform (transform);
+}
+
+//-----------------------------------------------------------------------------
+void CompositeViewSizeAnimation::animationFinished (CView* view, IdStringPtr name,
+                                                    bool wasCanceled)
+{
+	view->setCompositeTransform (CGraphicsTransform ());
+	view->disableCompositeLayer ();
+	CRect r (newRect);
+	if (wasCanceled && !forceEndValueOnFinish)
+	{
+		r = currentRect;
+		r.makeIntegral ();
+	}
+	if (view->getViewSize () != r)
+	{
+		view->invalid ();
+		view->setViewSize (r);
+		view->setMouseableArea (r);
+		view->invalid ();
+	}
+}
+
 //-----------------------------------------------------------------------------
 /** @class ExchangeViewAnimation
 	see @ref page_animation Support */
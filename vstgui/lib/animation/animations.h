@@ -49,6 +49,44 @@ protected:
 	bool forceEndValueOnFinish;
 };
 
+//-----------------------------------------------------------------------------
+/// @brief animates the alpha value of the view via its composite layer
+///
+/// the view content is drawn once into the composite layer of the view, each tick only blits it
+/// with the new alpha value
+/// @ingroup AnimationTargets
+//-----------------------------------------------------------------------------
+class CompositeAlphaAnimation : public AlphaValueAnimation
+{
+public:
+	using AlphaValueAnimation::AlphaValueAnimation;
+
+	void animationStart (CView* view, IdStringPtr name) override;
+	void animationFinished (CView* view, IdStringPtr name, bool wasCanceled) override;
+};
+
+//-----------------------------------------------------------------------------
+/// @brief animates the view size of the view via its composite layer
+///
+/// the ticks scale and move the composite layer of the view instead of resizing it, the view
+/// size is only set once when the animation finishes
+/// @ingroup AnimationTargets
+//-----------------------------------------------------------------------------
+class CompositeViewSizeAnimation : public IAnimationTarget, public NonAtomicReferenceCounted
+{
+public:
+	CompositeViewSizeAnimation (const CRect& newRect, bool forceEndValueOnFinish = false);
+
+	void animationStart (CView* view, IdStringPtr name) override;
+	void animationTick (CView* view, IdStringPtr name, float pos) override;
+	void animationFinished (CView* view, IdStringPtr name, bool wasCanceled) override;
+protected:
+	CRect startRect;
+	CRect currentRect;
+	CRect newRect;
+	bool forceEndValueOnFinish;
+};
+
 //-----------------------------------------------------------------------------
 /// @brief exchange a view by another view with an animation
 /// @ingroup AnimationTargets
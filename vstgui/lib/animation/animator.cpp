@@ -96,7 +96,11 @@ public:
 #include "../cview.h"
 #include "../dispatchlist.h"
 #include "../platform/iplatformframe.h"
+#include <algorithm>
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #define DEBUG_LOG	0 // DEBUG
 
@@ -112,7 +116,14 @@ class Timer : public NonAtomicReferenceCounted
 public:
 	static void addAnimator (Animator* animator)
 	{
-		getInstance ()->animators.emplace_back (animator);
+		auto instance = getInstance ();
+		auto it = std::find (instance->toRemove.begin (), instance->toRemove.end (), animator);
+		if (it != instance->toRemove.end ())
+		{
+			instance->toRemove.erase (it);
+			return;
+		}
+		instance->animators.emplace_back (animator);
 #if DEBUG_LOG
 		DebugPrint ("Animator added: %p\n", animator);
 #endif
@@ -194,56 +205,152 @@ protected:
 Timer* Timer::gInstance = nullptr;
 
 //-----------------------------------------------------------------------------
-class Animation : public NonAtomicReferenceCounted
+struct AnimationKey
 {
-public:
-	Animation (CView* view, const std::string& name, IAnimationTarget* at, ITimingFunction* t, DoneFunction&& notification);
-	~Animation () noexcept override;
-	
-	std::string name;
-	SharedPointer<CView> view;
-	IAnimationTarget* animationTarget;
+	const CView* view;
+	const std::string* name;
+
+	bool operator== (const AnimationKey& other) const
+	{
+		return view == other.view && name == other.name;
+	}
+};
+
+//-----------------------------------------------------------------------------
+struct AnimationKeyHash
+{
+	size_t operator() (const AnimationKey& key) const
+	{
+		auto hash = std::hash<const void*> () (key.view);
+		return hash ^ (std::hash<const void*> () (key.name) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
+	}
+};
+
+//-----------------------------------------------------------------------------
+/** the part of an animation touched by the batched timing pass */
+struct AnimationTiming
+{
+	AnimationTiming (ITimingFunction* timingFunction) : timingFunction (timingFunction) {}
+
 	ITimingFunction* timingFunction;
+	uint32_t startTime {0};
+	float lastPos {-1.f};
+	float pos {0.f};
+	bool started {false};
+	bool timingDone {false};
+	bool done {false};
+	bool removed {false};
+};
+
+//-----------------------------------------------------------------------------
+struct Animation
+{
+	SharedPointer<CView> view;
+	const std::string* name;
+	IAnimationTarget* target;
 	DoneFunction notification;
-	uint32_t startTime;
-	float lastPos;
-	bool done;
 };
 
 //-----------------------------------------------------------------------------
-Animation::Animation (CView* view, const std::string& name, IAnimationTarget* at, ITimingFunction* t, DoneFunction&& notification)
-: name (name)
-, view (view)
-, animationTarget (at)
-, timingFunction (t)
-, notification (std::move (notification))
-, startTime (0)
-, lastPos (-1)
-, done (false)
+template <typename T>
+static void releaseObject (T* obj)
 {
+	if (auto ref = dynamic_cast<IReference*> (obj))
+		ref->forget ();
+	else
+		delete obj;
 }
 
 //-----------------------------------------------------------------------------
-Animation::~Animation () noexcept
+static void finalize (Animation& animation, ITimingFunction* timingFunction)
 {
-	if (notification)
-		notification (view, name.c_str (), animationTarget);
-	if (auto obj = dynamic_cast<IReference*> (animationTarget))
-		obj->forget ();
-	else
-		delete animationTarget;
-	if (auto obj = dynamic_cast<IReference*> (timingFunction))
-		obj->forget ();
-	else
-		delete timingFunction;
+	if (animation.notification)
+		animation.notification (animation.view, animation.name->data (), animation.target);
+	releaseObject (animation.target);
+	releaseObject (timingFunction);
 }
 
 } // Detail
 
 //-----------------------------------------------------------------------------
+/** Animations are stored in two parallel arrays, the timings which are evaluated for all
+ *	animations at once on every tick, and the rest which is only touched when calling the targets.
+ *	Removed animations are only marked while any target is called and are swapped out of the arrays
+ *	afterwards, so indices stay valid during a tick.
+ */
 struct Animator::Impl
 {
-	DispatchList<SharedPointer<Detail::Animation>> animations;
+	using Index = std::unordered_map<Detail::AnimationKey, uint32_t, Detail::AnimationKeyHash>;
+	using ViewCounts = std::unordered_map<const CView*, uint32_t>;
+	using Names = std::unordered_set<std::string>;
+
+	std::vector<Detail::AnimationTiming> timings;
+	std::vector<Detail::Animation> animations;
+	Index index;
+	ViewCounts numAnimationsPerView;
+	std::vector<uint32_t> removedIndices;
+	/** the animation names are interned so that animations are identified by comparing pointers */
+	Names names;
+	uint32_t callDepth {0};
+	bool timerRegistered {false};
+
+	size_t numActive () const { return animations.size () - removedIndices.size (); }
+
+	const std::string* internName (IdStringPtr name) { return &*names.emplace (name).first; }
+	/** returns nullptr if no animation was ever added with the name */
+	const std::string* findName (IdStringPtr name) const
+	{
+		auto it = names.find (name);
+		return it == names.end () ? nullptr : &*it;
+	}
+
+	void remove (uint32_t i, bool clearNotification)
+	{
+		auto& timing = timings[i];
+		if (timing.removed)
+			return;
+		timing.removed = true;
+		removedIndices.emplace_back (i);
+		auto& animation = animations[i];
+		auto viewCount = numAnimationsPerView.find (animation.view);
+		if (--viewCount->second == 0)
+			numAnimationsPerView.erase (viewCount);
+		if (!timing.done)
+		{
+			timing.done = true;
+			++callDepth;
+			animation.target->animationFinished (animation.view, animation.name->data (), true);
+			--callDepth;
+		}
+		if (clearNotification)
+			animations[i].notification = nullptr;
+	}
+
+	void collectRemoved ()
+	{
+		if (callDepth > 0 || removedIndices.empty ())
+			return;
+		std::sort (removedIndices.begin (), removedIndices.end (), std::greater<uint32_t> ());
+		std::vector<std::pair<Detail::Animation, ITimingFunction*>> removed;
+		removed.reserve (removedIndices.size ());
+		for (auto i : removedIndices)
+		{
+			removed.emplace_back (std::move (animations[i]), timings[i].timingFunction);
+			auto last = static_cast<uint32_t> (animations.size () - 1);
+			if (i != last)
+			{
+				animations[i] = std::move (animations[last]);
+				timings[i] = timings[last];
+				index[{animations[i].view, animations[i].name}] = i;
+			}
+			animations.pop_back ();
+			timings.pop_back ();
+		}
+		removedIndices.clear ();
+		// notifications may add or remove animations again
+		for (auto& animation : removed)
+			Detail::finalize (animation.first, animation.second);
+	}
 };
 ///@endcond
 
@@ -257,15 +364,31 @@ Animator::Animator ()
 Animator::~Animator () noexcept
 {
 	Detail::Timer::removeAnimator (this);
+	for (auto i = 0u; i < pImpl->animations.size (); ++i)
+		Detail::finalize (pImpl->animations[i], pImpl->timings[i].timingFunction);
 }
 
 //-----------------------------------------------------------------------------
 void Animator::addAnimation (CView* view, IdStringPtr name, IAnimationTarget* target, ITimingFunction* timingFunction, DoneFunction notification)
 {
-	if (pImpl->animations.empty ())
+	if (!pImpl->timerRegistered)
+	{
 		Detail::Timer::addAnimator (this);
-	removeAnimation (view, name);
-	pImpl->animations.add (makeOwned<Detail::Animation> (view, name, target, timingFunction, std::move (notification)));
+		pImpl->timerRegistered = true;
+	}
+	Detail::AnimationKey key {view, pImpl->internName (name)};
+	auto it = pImpl->index.find (key);
+	if (it != pImpl->index.end ())
+	{
+		auto i = it->second;
+		pImpl->index.erase (it);
+		pImpl->remove (i, true);
+	}
+	pImpl->index[key] = static_cast<uint32_t> (pImpl->animations.size ());
+	pImpl->timings.emplace_back (timingFunction);
+	pImpl->animations.push_back ({view, key.name, target, std::move (notification)});
+	++pImpl->numAnimationsPerView[view];
+	pImpl->collectRemoved ();
 #if DEBUG_LOG
 	DebugPrint ("new animation added: %p - %s\n", view, name);
 #endif
@@ -291,75 +414,115 @@ void Animator::addAnimation (CView* view, IdStringPtr name, IAnimationTarget* ta
 //-----------------------------------------------------------------------------
 void Animator::removeAnimation (CView* view, IdStringPtr name)
 {
-	pImpl->animations.forEach ([&] (const SharedPointer<Detail::Animation>& animation) {
-		if (animation->view == view && animation->name == name)
-		{
+	auto internedName = pImpl->findName (name);
+	if (internedName == nullptr)
+		return;
+	auto it = pImpl->index.find ({view, internedName});
+	if (it == pImpl->index.end ())
+		return;
 #if DEBUG_LOG
-			DebugPrint ("animation removed: %p - %s\n", view, name);
+	DebugPrint ("animation removed: %p - %s\n", view, name);
 #endif
-			if (animation->done == false)
-			{
-				animation->done = true;
-				animation->animationTarget->animationFinished (view, name, true);
-			}
-			animation->notification = nullptr;
-			pImpl->animations.remove (animation);
-		}
-	});
+	auto i = it->second;
+	pImpl->index.erase (it);
+	pImpl->remove (i, true);
+	pImpl->collectRemoved ();
 }
 
 //-----------------------------------------------------------------------------
 void Animator::removeAnimations (CView* view)
 {
-	pImpl->animations.forEach ([&] (const SharedPointer<Detail::Animation>& animation) {
-		if (animation->view == view)
-		{
+	// called for every view removed from the frame, most of them have no animations
+	if (pImpl->numAnimationsPerView.find (view) == pImpl->numAnimationsPerView.end ())
+		return;
+	++pImpl->callDepth;
+	auto numAnimations = pImpl->animations.size ();
+	for (auto i = 0u; i < numAnimations; ++i)
+	{
+		auto& animation = pImpl->animations[i];
+		if (animation.view != view || pImpl->timings[i].removed)
+			continue;
 #if DEBUG_LOG
-			DebugPrint ("animation removed: %p - %s\n", view, animation->name.data ());
+		DebugPrint ("animation removed: %p - %s\n", view, animation.name->data ());
 #endif
-			if (animation->done == false)
-			{
-				animation->done = true;
-				animation->animationTarget->animationFinished (view, animation->name.data (), true);
-			}
-			pImpl->animations.remove (animation);
-		}
-	});
+		pImpl->index.erase ({view, animation.name});
+		pImpl->remove (i, false);
+	}
+	--pImpl->callDepth;
+	pImpl->collectRemoved ();
 }
 
 //-----------------------------------------------------------------------------
 void Animator::onTimer ()
 {
+	if (pImpl->callDepth > 0)
+		return;
 	auto selfGuard = shared (this);
 	uint32_t currentTicks = IPlatformFrame::getTicks ();
-	pImpl->animations.forEach ([&] (SharedPointer<Detail::Animation>& animation) {
-		if (animation->startTime == 0)
+	// animations added by the targets are started with the next tick
+	auto numAnimations = pImpl->animations.size ();
+
+	// evaluate all timing functions first
+	for (auto i = 0u; i < numAnimations; ++i)
+	{
+		auto& timing = pImpl->timings[i];
+		if (timing.removed)
+			continue;
+		if (!timing.started)
+			timing.startTime = currentTicks;
+		uint32_t time = currentTicks - timing.startTime;
+		timing.pos = timing.timingFunction->getPosition (time);
+		timing.timingDone = timing.timingFunction->isDone (time);
+	}
+
+	// then call the targets, which may add and remove animations
+	++pImpl->callDepth;
+	for (auto i = 0u; i < numAnimations; ++i)
+	{
+		if (pImpl->timings[i].removed)
+			continue;
+		auto view = pImpl->animations[i].view.get ();
+		auto name = pImpl->animations[i].name;
+		auto target = pImpl->animations[i].target;
+		if (!pImpl->timings[i].started)
 		{
 #if DEBUG_LOG
-			DebugPrint ("animation start: %p - %s\n", animation->view.cast<CView>(), animation->name.data ());
+			DebugPrint ("animation start: %p - %s\n", view, name->data ());
 #endif
-			animation->animationTarget->animationStart (animation->view, animation->name.data ());
-			animation->startTime = currentTicks;
+			pImpl->timings[i].started = true;
+			target->animationStart (view, name->data ());
+			if (pImpl->timings[i].removed)
+				continue;
 		}
-		uint32_t time = currentTicks - animation->startTime;
-		float pos = animation->timingFunction->getPosition (time);
-		if (pos != animation->lastPos)
+		auto pos = pImpl->timings[i].pos;
+		if (pos != pImpl->timings[i].lastPos)
 		{
-			animation->animationTarget->animationTick (animation->view, animation->name.data (), pos);
-			animation->lastPos = pos;
+			pImpl->timings[i].lastPos = pos;
+			target->animationTick (view, name->data (), pos);
+			if (pImpl->timings[i].removed)
+				continue;
 		}
-		if (animation->timingFunction->isDone (time))
+		if (pImpl->timings[i].timingDone)
 		{
-			animation->done = true;
-			animation->animationTarget->animationFinished (animation->view, animation->name.data (), false);
+			pImpl->timings[i].done = true;
+			target->animationFinished (view, name->data (), false);
 #if DEBUG_LOG
-			DebugPrint ("animation finished: %p - %s\n", animation->view.cast<CView>(), animation->name.data ());
+			DebugPrint ("animation finished: %p - %s\n", view, name->data ());
 #endif
-			pImpl->animations.remove (animation);
+			if (!pImpl->timings[i].removed)
+			{
+				pImpl->index.erase ({view, name});
+				pImpl->remove (i, false);
+			}
 		}
-	});
-	if (pImpl->animations.empty ())
+	}
+	--pImpl->callDepth;
+	pImpl->collectRemoved ();
+	if (pImpl->numActive () == 0 && pImpl->timerRegistered)
+	{
+		pImpl->timerRegistered = false;
 		Detail::Timer::removeAnimator (this);
+	}
 }
 
 #if VSTGUI_ENABLE_DEPRECATED_METHODS
@@ -797,9 +797,23 @@ void CDataBrowserView::drawRect (CDrawContext* context, const CRect& updateRect)
 
 	CDrawContext::LineList lines;
 
+	// only iterate the rows intersecting the update rect
+	int32_t firstRow = 0;
+	int32_t lastRow = numRows;
+	if (rowHeight > 0.)
+	{
+		firstRow = static_cast<int32_t> (
+		    std::floor ((updateRect.top - getViewSize ().top) / rowHeight));
+		lastRow = static_cast<int32_t> (
+		    std::ceil ((updateRect.bottom - getViewSize ().top) / rowHeight));
+		firstRow = std::max<int32_t> (0, firstRow);
+		lastRow = std::min<int32_t> (numRows, lastRow);
+	}
+
 	CRect r (getViewSize ());
 	r.setHeight (rowHeight - lineWidth);
-	for (int32_t row = 0; row < numRows; row++)
+	r.offset (0, rowHeight * firstRow);
+	for (int32_t row = firstRow; row < lastRow; row++)
 	{
 		CRect testRect (r);
 		testRect.bound (updateRect);
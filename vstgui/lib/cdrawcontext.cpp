@@ -258,6 +258,7 @@ void CDrawContext::drawString (IPlatformString* string, const CRect& _rect, cons
 			rect.left = rect.left + (rect.getWidth () / 2.) - (stringWidth / 2.);
 	}
 
+	profileDrawCall (DrawProfiler::kString);
 	painter->drawString (this, string, CPoint (rect.left, rect.bottom), antialias);
 }
 
@@ -268,7 +269,10 @@ void CDrawContext::drawString (IPlatformString* string, const CPoint& point, boo
 		return;
 	
 	if (auto painter = currentState.font->getFontPainter ())
+	{
+		profileDrawCall (DrawProfiler::kString);
 		painter->drawString (this, string, point, antialias);
+	}
 }
 
 //-----------------------------------------------------------------------------
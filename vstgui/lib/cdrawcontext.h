@@ -13,6 +13,7 @@
 #include "cgraphicstransform.h"
 #include "clinestyle.h"
 #include "cdrawdefs.h"
+#include "drawprofiler.h"
 #include <cmath>
 #include <stack>
 #include <vector>
@@ -230,6 +231,10 @@ public:
 
 	const CRect& getSurfaceRect () const { return surfaceRect; }
 
+	/** the profiler recording the draw calls, set by the frame while it draws */
+	void setDrawProfiler (DrawProfiler* profiler) { drawProfiler = profiler; }
+	DrawProfiler* getDrawProfiler () const { return drawProfiler; }
+
 protected:
 	CDrawContext () = delete;
 	explicit CDrawContext (const CRect& surfaceRect);
@@ -243,6 +248,27 @@ protected:
 	const UTF8String& getDrawString (UTF8StringPtr string);
 	void clearDrawString ();
 
+	/** must be called by the draw primitives of the platform contexts */
+	void profileDrawCall (DrawProfiler::DrawCallType type) const
+	{
+		if (drawProfiler)
+			drawProfiler->onDrawCall (type);
+	}
+	void profileBitmapDraw (const CRect& dest) const
+	{
+		if (drawProfiler)
+			drawProfiler->onBitmapDraw (dest, getScaleFactor ());
+	}
+	/** for primitives drawn with other primitives, the calls made by proc are not counted */
+	template<typename Proc>
+	void drawUnprofiled (Proc proc)
+	{
+		auto profiler = drawProfiler;
+		drawProfiler = nullptr;
+		proc ();
+		drawProfiler = profiler;
+	}
+
 	/// @cond ignore
 	struct CDrawContextState
 	{
@@ -271,6 +297,7 @@ protected:
 
 private:
 	UTF8String* drawStringHelper {nullptr};
+	DrawProfiler* drawProfiler {nullptr};
 	CRect surfaceRect;
 
 	CDrawContextState currentState;
@@ -4,6 +4,7 @@
 
 #include "cframe.h"
 #include "coffscreencontext.h"
+#include "drawprofiler.h"
 #include "ctooltipsupport.h"
 #include "itouchevent.h"
 #include "iscalefactorchangedlistener.h"
@@ -62,6 +63,7 @@ struct CFrame::Impl
 	IViewAddedRemovedObserver* viewAddedRemovedObserver {nullptr};
 	SharedPointer<CTooltipSupport> tooltips;
 	SharedPointer<Animation::Animator> animator;
+	SharedPointer<DrawProfiler> drawProfiler;
 #if VSTGUI_ENABLE_DEPRECATED_METHODS
 	Optional<ModalViewSessionID> legacyModalViewSessionID;
 #endif
@@ -198,7 +200,7 @@ void CFrame::close ()
 //-----------------------------------------------------------------------------
 bool CFrame::open (void* systemWin, PlatformType systemWindowType, IPlatformFrameConfig* config)
 {
-	if (!systemWin || isAttached ())
+	if ((!systemWin && systemWindowType != PlatformType::kHeadless) || isAttached ())
 		return false;
 
 	pImpl->platformFrame = owned (IPlatformFrame::createPlatformFrame (this, getViewSize (), systemWin, systemWindowType, config));
@@ -290,6 +292,19 @@ BitmapInterpolationQuality CFrame::getBitmapInterpolationQuality () const
 	return BitmapInterpolationQuality::kDefault;
 }
 
+//-----------------------------------------------------------------------------
+void CFrame::setDrawProfiler (DrawProfiler* profiler)
+{
+	if (pImpl)
+		pImpl->drawProfiler = profiler;
+}
+
+//-----------------------------------------------------------------------------
+DrawProfiler* CFrame::getDrawProfiler () const
+{
+	return pImpl ? pImpl->drawProfiler.get () : nullptr;
+}
+
 //-----------------------------------------------------------------------------
 double CFrame::getScaleFactor () const
 {
@@ -1453,6 +1468,9 @@ void CFrame::invalidRect (const CRect& rect)
 	if (!isVisible () || !pImpl->platformFrame)
 		return;
 
+	if (pImpl->drawProfiler)
+		pImpl->drawProfiler->onInvalidRect ();
+
 	CRect _rect (rect);
 	getTransform ().transform (_rect);
 	_rect.makeIntegral ();
@@ -1643,6 +1661,15 @@ IPlatformFrame* CFrame::getPlatformFrame () const
 //-----------------------------------------------------------------------------
 bool CFrame::platformDrawRect (CDrawContext* context, const CRect& rect)
 {
+	if (auto profiler = pImpl->drawProfiler)
+	{
+		profiler->beginFrame (rect);
+		context->setDrawProfiler (profiler);
+		drawRect (context, rect);
+		context->setDrawProfiler (nullptr);
+		profiler->endFrame ();
+		return true;
+	}
 	drawRect (context, rect);
 	return true;
 }
@@ -52,6 +52,10 @@ public:
 	void setBitmapInterpolationQuality (BitmapInterpolationQuality quality);	///< set interpolation quality for bitmaps
 	BitmapInterpolationQuality getBitmapInterpolationQuality () const;			///< get interpolation quality for bitmaps
 
+	/** record the frame draws with the profiler, nullptr stops recording */
+	void setDrawProfiler (DrawProfiler* profiler);
+	DrawProfiler* getDrawProfiler () const;
+
 	double getScaleFactor () const;
 
 	void idle ();
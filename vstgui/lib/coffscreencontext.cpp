@@ -6,6 +6,7 @@
 #include "cframe.h"
 #include "cbitmap.h"
 #include "platform/iplatformframe.h"
+#include <cmath>
 
 namespace VSTGUI {
 
@@ -53,4 +54,66 @@ CCoord COffscreenContext::getHeight () const
 	return bitmap ? bitmap->getHeight () : 0.;
 }
 
+//-----------------------------------------------------------------------------
+bool OffscreenLayer::update (CDrawContext* parentContext, CFrame* frame, CCoord width,
+                             CCoord height)
+{
+	if (width <= 0. || height <= 0.)
+		return false;
+	double newScaleFactor = parentContext->getScaleFactor ();
+	const auto& matrix = parentContext->getCurrentTransform ();
+	if (matrix.m11 == matrix.m22)
+	{
+		double matrixScale = std::floor (matrix.m11 + 0.5);
+		if (matrixScale != 0.)
+			newScaleFactor *= matrixScale;
+	}
+	if (!context || scaleFactor != newScaleFactor || context->getWidth () != width ||
+	    context->getHeight () != height)
+	{
+		context = COffscreenContext::create (frame, width, height, newScaleFactor);
+		if (!context)
+			return false;
+		scaleFactor = newScaleFactor;
+		dirtyRect = CRect (0, 0, width, height);
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void OffscreenLayer::invalidRect (const CRect& rect)
+{
+	if (dirtyRect.isEmpty ())
+		dirtyRect = rect;
+	else if (!rect.isEmpty ())
+		dirtyRect.unite (rect);
+}
+
+//-----------------------------------------------------------------------------
+void OffscreenLayer::redrawDirty (CDrawContext* parentContext, const CRect& viewSize,
+                                  const DrawFunc& drawFunc)
+{
+	if (!context || dirtyRect.isEmpty ())
+		return;
+	CRect r (dirtyRect);
+	r.bound (CRect (0, 0, context->getWidth (), context->getHeight ()));
+	r.makeIntegral ();
+	dirtyRect = CRect ();
+	if (r.isEmpty ())
+		return;
+
+	context->setDrawProfiler (parentContext->getDrawProfiler ());
+	context->beginDraw ();
+	context->setClipRect (r);
+	context->clearRect (r);
+	{
+		CDrawContext::Transform transform (
+		    *context, CGraphicsTransform ().translate (-viewSize.left, -viewSize.top));
+		r.offset (viewSize.left, viewSize.top);
+		drawFunc (context, r);
+	}
+	context->endDraw ();
+	context->setDrawProfiler (nullptr);
+}
+
 } // VSTGUI
@@ -6,6 +6,7 @@
 
 #include "vstguifwd.h"
 #include "cdrawcontext.h"
+#include <functional>
 
 namespace VSTGUI {
 
@@ -79,4 +80,28 @@ protected:
 	SharedPointer<CBitmap> bitmap;
 };
 
+//-----------------------------------------------------------------------------
+/** An offscreen context caching the drawing of a view, only its dirty area is redrawn.
+ *	Used by the cached bitmap of CViewContainer and the composite layer of CView.
+ */
+struct OffscreenLayer
+{
+	using DrawFunc = std::function<void (CDrawContext* context, const CRect& updateRect)>;
+
+	SharedPointer<COffscreenContext> context;
+	/** the area to redraw in the coordinates of the layer */
+	CRect dirtyRect;
+	double scaleFactor {0.};
+
+	/** recreates the context when the size or the scale factor of the parent context changed
+	 *	@return false if there is no context
+	 */
+	bool update (CDrawContext* parentContext, CFrame* frame, CCoord width, CCoord height);
+	/** adds rect in the coordinates of the layer to the dirty area */
+	void invalidRect (const CRect& rect);
+	/** clears the dirty area and calls drawFunc to draw it in the coordinates of viewSize */
+	void redrawDirty (CDrawContext* parentContext, const CRect& viewSize, const DrawFunc& drawFunc);
+	void reset () { context = nullptr; }
+};
+
 } // VSTGUI
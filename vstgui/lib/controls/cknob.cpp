@@ -479,6 +479,15 @@ bool CKnob::getFocusPath (CGraphicsPath &outPath)
 //------------------------------------------------------------------------
 void CKnob::draw (CDrawContext *pContext)
 {
+	// the old handle is still visible if the redrawn part did not cover it
+	CRect previousHandleRect (drawnHandleRect);
+	CRect redrawnRect (getViewSize ());
+	if (!previousHandleRect.isEmpty ())
+	{
+		redrawnRect = previousHandleRect;
+		redrawnRect.unite (calculateHandleBounds ()).bound (getViewSize ());
+	}
+	drawnHandleRect = {};
 	if (getDrawBackground ())
 	{
 		getDrawBackground ()->draw (pContext, getViewSize (), offset);
@@ -499,9 +508,57 @@ void CKnob::draw (CDrawContext *pContext)
 				drawHandleAsLine (pContext);
 		}
 	}
+	if (drawnHandleRect != previousHandleRect && !isRectInClip (pContext, redrawnRect))
+		drawnHandleRect = {};
 	setDirty (false);
 }
 
+//------------------------------------------------------------------------
+CRect CKnob::getDirtyRect () const
+{
+	if (hasViewFlag (kDirty) || drawnHandleRect.isEmpty () || (!pHandle && drawStyle & kCoronaDrawing))
+		return CKnobBase::getDirtyRect ();
+	auto dirtyRect = calculateHandleBounds ();
+	dirtyRect.unite (drawnHandleRect);
+	if (hasViewFlag (kHasDirtyRect))
+		dirtyRect.unite (CKnobBase::getDirtyRect ());
+	return dirtyRect;
+}
+
+//------------------------------------------------------------------------
+CRect CKnob::calculateHandleBounds () const
+{
+	CPoint where;
+	valueToPoint (where);
+	where.offset (getViewSize ().left, getViewSize ().top);
+
+	CRect r;
+	if (pHandle)
+	{
+		// see drawHandle
+		r.setWidth (pHandle->getWidth ());
+		r.setHeight (pHandle->getHeight ());
+		r.offset (floor (where.x - r.getWidth () / 2), floor (where.y - r.getHeight () / 2));
+		return r;
+	}
+	if (drawStyle & kHandleCircleDrawing)
+	{
+		r (where.x - 0.5, where.y - 0.5, where.x + 0.5, where.y + 0.5);
+		r.extend (handleLineWidth, handleLineWidth);
+	}
+	else
+	{
+		// the line and its shadow from the center to the handle point, see drawHandleAsLine
+		CPoint origin (getViewSize ().getCenter ());
+		r (where.x, where.y, origin.x, origin.y);
+		r.left -= 1.;
+		r.top -= 1.;
+		r.extend (handleLineWidth / 2., handleLineWidth / 2.);
+	}
+	// anti-aliasing
+	return r.extend (1., 1.);
+}
+
 //------------------------------------------------------------------------
 void CKnob::addArc (CGraphicsPath* path, const CRect& r, double startAngle, double sweepAngle)
 {
@@ -596,6 +653,7 @@ void CKnob::drawHandleAsCircle (CDrawContext* pContext) const
 	pContext->setLineStyle (kLineSolid);
 	pContext->setDrawMode (kAntiAliasing | kNonIntegralMode);
 	pContext->drawEllipse (r, kDrawFilledAndStroked);
+	drawnHandleRect = calculateHandleBounds ();
 }
 
 //------------------------------------------------------------------------
@@ -617,6 +675,7 @@ void CKnob::drawHandleAsLine (CDrawContext* pContext) const
 	origin.offset (1, -1);
 	pContext->setFrameColor (colorHandle);
 	pContext->drawLine (where, origin);
+	drawnHandleRect = calculateHandleBounds ();
 }
 
 //------------------------------------------------------------------------
@@ -635,6 +694,7 @@ void CKnob::drawHandle (CDrawContext *pContext)
 	CRect handleSize (0, 0, width, height);
 	handleSize.offset (where.x, where.y);
 	pHandle->draw (pContext, handleSize);
+	drawnHandleRect = handleSize;
 }
 
 //------------------------------------------------------------------------
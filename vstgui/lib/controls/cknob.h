@@ -121,6 +121,7 @@ public:
 
 	// overrides
 	void draw (CDrawContext* pContext) override;
+	CRect getDirtyRect () const override;
 	bool getFocusPath (CGraphicsPath& outPath) override;
 	bool drawFocusOnTop () override;
 
@@ -134,6 +135,9 @@ protected:
 	virtual void drawHandleAsCircle (CDrawContext* pContext) const;
 	virtual void drawHandleAsLine (CDrawContext* pContext) const;
 
+	/** the bounds of the handle at the current value */
+	CRect calculateHandleBounds () const;
+
 	static void addArc (CGraphicsPath* path, const CRect& r, double startAngle, double sweepAngle);
 
 	CPoint offset;
@@ -146,6 +150,9 @@ protected:
 
 	CLineStyle coronaLineStyle;
 	CBitmap* pHandle;
+
+	/** set by the handle draw methods, empty if unknown */
+	mutable CRect drawnHandleRect;
 };
 
 //-----------------------------------------------------------------------------
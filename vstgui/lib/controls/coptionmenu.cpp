@@ -87,6 +87,7 @@ CMenuItem::CMenuItem (const CMenuItem& item)
 void CMenuItem::setTitle (const UTF8String& inTitle)
 {
 	title = inTitle;
+	titleWidth = -1.;
 }
 
 //------------------------------------------------------------------------
@@ -146,6 +147,27 @@ void CMenuItem::setIsSeparator (bool state)
 	setBit (flags, kSeparator, state);
 }
 
+//------------------------------------------------------------------------
+CCoord CMenuItem::getCachedTitleWidth (const CFontDesc* font) const
+{
+	// compared by value, the font may have been changed in place since it was measured
+	if (font && titleWidthFont && *titleWidthFont == *font)
+		return titleWidth;
+	return -1.;
+}
+
+//------------------------------------------------------------------------
+void CMenuItem::setCachedTitleWidth (const CFontDesc* font, CCoord width)
+{
+	if (!font)
+		return;
+	if (titleWidthFont)
+		*titleWidthFont = *font;
+	else
+		titleWidthFont = makeOwned<CFontDesc> (*font);
+	titleWidth = width;
+}
+
 //------------------------------------------------------------------------
 /*! @class CCommandMenuItem
 
@@ -87,6 +87,11 @@ public:
 	CBitmap* getIcon () const { return icon; }
 	/** returns the tag of the item */
 	int32_t getTag () const { return tag; }
+
+	/** returns the cached width of the title for font or a negative value if not cached */
+	CCoord getCachedTitleWidth (const CFontDesc* font) const;
+	/** cache the width of the title measured with a copy of font, reset when the title changes */
+	void setCachedTitleWidth (const CFontDesc* font, CCoord width);
 	//@}
 
 //------------------------------------------------------------------------
@@ -97,6 +102,8 @@ protected:
 	UTF8String keyCode;
 	SharedPointer<COptionMenu> submenu;
 	SharedPointer<CBitmap> icon;
+	SharedPointer<CFontDesc> titleWidthFont;
+	CCoord titleWidth {-1.};
 	int32_t flags {0};
 	int32_t keyModifiers {0};
 	int32_t virtualKeyCode {0};
@@ -172,16 +172,13 @@ bool CParamDisplay::getFocusPath (CGraphicsPath& outPath)
 }
 
 //------------------------------------------------------------------------
-void CParamDisplay::draw (CDrawContext *pContext)
+std::string CParamDisplay::getValueString () const
 {
-	if (hasBit (style, kNoDrawStyle))
-		return;
-
 	std::string string;
 
 	bool converted = false;
 	if (valueToStringFunction)
-		converted = valueToStringFunction (value, string, this);
+		converted = valueToStringFunction (value, string, const_cast<CParamDisplay*> (this));
 	if (!converted)
 	{
 		char tmp[255];
@@ -190,12 +187,38 @@ void CParamDisplay::draw (CDrawContext *pContext)
 		sprintf (tmp, precisionStr, value);
 		string = tmp;
 	}
+	return string;
+}
+
+//------------------------------------------------------------------------
+void CParamDisplay::draw (CDrawContext *pContext)
+{
+	if (hasBit (style, kNoDrawStyle))
+		return;
+
+	auto string = getValueString ();
 
 	drawBack (pContext);
 	drawPlatformText (pContext, UTF8String (string).getPlatformString ());
+
+	// the old string may still be visible if only a part of the display was redrawn
+	drawnStringValid = isRectInClip (pContext, getViewSize ()) ||
+					   (drawnStringValid && string == drawnString);
+	drawnString = std::move (string);
 	setDirty (false);
 }
 
+//------------------------------------------------------------------------
+CRect CParamDisplay::getDirtyRect () const
+{
+	if (hasViewFlag (kDirty) || !drawnStringValid || getValueString () != drawnString)
+		return getViewSize ();
+	// the value changed, but not the displayed string
+	if (hasViewFlag (kHasDirtyRect))
+		return CControl::getDirtyRect ();
+	return {};
+}
+
 //------------------------------------------------------------------------
 void CParamDisplay::drawBack (CDrawContext* pContext, CBitmap* newBack)
 {
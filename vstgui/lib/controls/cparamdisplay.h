@@ -114,6 +114,7 @@ public:
 	//@}
 
 	void draw (CDrawContext* pContext) override;
+	CRect getDirtyRect () const override;
 	bool getFocusPath (CGraphicsPath& outPath) override;
 	bool removed (CView* parent) override;
 
@@ -127,6 +128,9 @@ protected:
 
 	virtual void drawStyleChanged ();
 
+	/** the string drawn for the current value */
+	std::string getValueString () const;
+
 	ValueToStringFunction2 valueToStringFunction;
 
 	enum StylePrivate {
@@ -148,6 +152,10 @@ protected:
 	CCoord		roundRectRadius;
 	CCoord		frameWidth;
 	double		textRotation;
+
+	/** the string of the last draw, only valid if it was drawn completely */
+	std::string	drawnString;
+	bool		drawnStringValid {false};
 };
 
 } // VSTGUI
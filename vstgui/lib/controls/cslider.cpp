@@ -597,6 +597,9 @@ struct CSlider::Impl
 	CColor frameColor {kGreyCColor};
 	CColor backColor {kBlackCColor};
 	CColor valueColor {kWhiteCColor};
+
+	// where the handle was drawn, empty if unknown
+	CRect drawnHandleRect;
 };
 
 //------------------------------------------------------------------------
@@ -688,6 +691,7 @@ CSlider::CSlider (const CRect& rect, IControlListener* listener, int32_t tag,
 CSlider::CSlider (const CSlider& v) : CSliderBase (v)
 {
 	impl = std::unique_ptr<Impl> (new Impl (*v.impl.get ()));
+	impl->drawnHandleRect = {};
 }
 
 //------------------------------------------------------------------------
@@ -846,11 +850,36 @@ void CSlider::draw (CDrawContext* pContext)
 
 		// draw slider at new position
 		impl->pHandle->draw (drawContext, rectNew);
+
+		// the old handle is still visible if the redrawn part did not cover it
+		CRect redrawnRect (getViewSize ());
+		if (!impl->drawnHandleRect.isEmpty ())
+		{
+			redrawnRect = impl->drawnHandleRect;
+			redrawnRect.unite (rectNew).bound (getViewSize ());
+		}
+		if (rectNew == impl->drawnHandleRect || isRectInClip (drawContext, redrawnRect))
+			impl->drawnHandleRect = rectNew;
+		else
+			impl->drawnHandleRect = {};
 	}
 
 	setDirty (false);
 }
 
+//------------------------------------------------------------------------
+CRect CSlider::getDirtyRect () const
+{
+	if (hasViewFlag (kDirty) || impl->drawnHandleRect.isEmpty () || impl->drawStyle & kDrawValue)
+		return CSliderBase::getDirtyRect ();
+	auto dirtyRect = calculateHandleRect (getValueNormalized ());
+	dirtyRect.unite (impl->drawnHandleRect);
+	if (hasViewFlag (kHasDirtyRect))
+		dirtyRect.unite (CSliderBase::getDirtyRect ());
+	// the handle bitmap may be drawn at fractional coordinates
+	return dirtyRect.extend (1., 1.);
+}
+
 //------------------------------------------------------------------------
 void CSlider::setHandle (CBitmap* _pHandle)
 {
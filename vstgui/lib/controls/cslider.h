@@ -158,6 +158,7 @@ public:
 
 	// overrides
 	void draw (CDrawContext*) override;
+	CRect getDirtyRect () const override;
 	bool sizeToFit () override;
 
 	CLASS_METHODS (CSlider, CControl)
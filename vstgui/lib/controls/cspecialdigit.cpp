@@ -83,12 +83,9 @@ CSpecialDigit::CSpecialDigit (const CSpecialDigit& v)
 }
 
 //------------------------------------------------------------------------
-void CSpecialDigit::draw (CDrawContext *pContext)
+void CSpecialDigit::calculateDigits (int32_t digits[7]) const
 {
-	CPoint where;
-	CRect rectDest;
 	int32_t i, j;
-	int32_t one_digit[16] = {};
 
 	int32_t dwValue = static_cast<int32_t> (getValue ());
 	int32_t intMax = static_cast<int32_t> (getMax ());
@@ -99,32 +96,80 @@ void CSpecialDigit::draw (CDrawContext *pContext)
 	
 	for (i = 0, j = (intMax + 1) / 10; i < iNumbers; i++, j /= 10)
 	{
-		one_digit[i] = dwValue / j;
-		dwValue -= (one_digit[i] * j);
+		digits[i] = dwValue / j;
+		dwValue -= (digits[i] * j);
+		if (digits[i] > 9)
+			digits[i] = 9;
 	}
-	
+}
+
+//------------------------------------------------------------------------
+CRect CSpecialDigit::getDigitRect (int32_t index) const
+{
+	CRect rect;
+	rect.left   = (CCoord)xpos[index];
+	rect.top    = (CCoord)ypos[index];
+	rect.right  = rect.left + width;
+	rect.bottom = rect.top  + height;
+	return rect;
+}
+
+//------------------------------------------------------------------------
+void CSpecialDigit::draw (CDrawContext *pContext)
+{
+	CPoint where;
+	CRect rectDest;
+	CRect clipRect;
+	int32_t i;
+	int32_t one_digit[7] = {};
+
+	calculateDigits (one_digit);
+	pContext->getClipRect (clipRect);
+
 	where.x = 0;
 	for (i = 0; i < iNumbers; i++)
 	{	
-		j = one_digit[i];
-		if (j > 9)
-			j = 9;
-		
-		rectDest.left   = (CCoord)xpos[i];
-		rectDest.top    = (CCoord)ypos[i];
-		
-		rectDest.right  = rectDest.left + width;
-		rectDest.bottom = rectDest.top  + height;		
+		rectDest = getDigitRect (i);
 		
 		// where = src from bitmap
-		where.y = (CCoord)j * height;
+		where.y = (CCoord)one_digit[i] * height;
 		if (getDrawBackground ())
 		{
 			getDrawBackground ()->draw (pContext, rectDest, where);
 		}
+		// a digit outside of the clip still shows the digit drawn before, a partly redrawn digit
+		// is unknown if it changed
+		if (isRectInClip (pContext, rectDest))
+			drawnDigits[i] = one_digit[i];
+		else if (clipRect.rectOverlap (rectDest) && drawnDigits[i] != one_digit[i])
+			drawnDigits[i] = -1;
 	}
 		
 	setDirty (false);
 }
 
+//------------------------------------------------------------------------
+CRect CSpecialDigit::getDirtyRect () const
+{
+	if (hasViewFlag (kDirty))
+		return CControl::getDirtyRect ();
+
+	int32_t digits[7] = {};
+	calculateDigits (digits);
+
+	CRect dirtyRect;
+	if (hasViewFlag (kHasDirtyRect))
+		dirtyRect = CControl::getDirtyRect ();
+	for (int32_t i = 0; i < iNumbers; i++)
+	{
+		if (digits[i] == drawnDigits[i])
+			continue;
+		if (dirtyRect.isEmpty ())
+			dirtyRect = getDigitRect (i);
+		else
+			dirtyRect.unite (getDigitRect (i));
+	}
+	return dirtyRect;
+}
+
 } // VSTGUI
@@ -20,15 +20,22 @@ public:
 	CSpecialDigit (const CSpecialDigit& digit);
 	
 	void  draw (CDrawContext*) override;
+	CRect getDirtyRect () const override;
 
 	CLASS_METHODS(CSpecialDigit, CControl)
 protected:
 	~CSpecialDigit () noexcept override = default;
+
+	void calculateDigits (int32_t digits[7]) const;
+	CRect getDigitRect (int32_t index) const;
+
 	int32_t     iNumbers;
 	int32_t     xpos[7];
 	int32_t     ypos[7];
 	int32_t     width;
 	int32_t     height;
+	/** the digits of the last draw, -1 if unknown */
+	int32_t     drawnDigits[7] {-1, -1, -1, -1, -1, -1, -1};
 };
 
 } // VSTGUI
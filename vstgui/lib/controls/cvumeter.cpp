@@ -6,6 +6,7 @@
 #include "../coffscreencontext.h"
 #include "../cbitmap.h"
 #include "../cvstguitimer.h"
+#include <algorithm>
 #include <list>
 
 namespace VSTGUI {
@@ -66,6 +67,7 @@ void CVuMeter::setViewSize (const CRect& newSize, bool invalid)
 	CControl::setViewSize (newSize, invalid);
 	rectOn  = getViewSize ();
 	rectOff = getViewSize ();
+	drawnLedOffset = -1.;
 }
 
 //------------------------------------------------------------------------
@@ -103,7 +105,58 @@ void CVuMeter::setDirty (bool state)
 void CVuMeter::onIdle ()
 {
 	if (getOldValue () != value)
-		invalid ();
+		invalidDirtyRect ();
+}
+
+//------------------------------------------------------------------------
+CCoord CVuMeter::calculateLedOffset (float normValue) const
+{
+	if (style & kHorizontal)
+		return (CCoord)(((int32_t)(nbLed * normValue + 0.5f) / (float)nbLed) * getOnBitmap ()->getWidth ());
+	return (CCoord)(((int32_t)(nbLed * (1.f - normValue) + 0.5f) / (float)nbLed) * getOnBitmap ()->getHeight ());
+}
+
+//------------------------------------------------------------------------
+CRect CVuMeter::calculateLedRect (CCoord offset1, CCoord offset2) const
+{
+	CRect r (getViewSize ());
+	if (style & kHorizontal)
+	{
+		r.left = rectOn.left + std::min (offset1, offset2);
+		r.right = rectOn.left + std::max (offset1, offset2);
+	}
+	else
+	{
+		r.top = rectOff.top + std::min (offset1, offset2);
+		r.bottom = rectOff.top + std::max (offset1, offset2);
+	}
+	return r;
+}
+
+//------------------------------------------------------------------------
+CRect CVuMeter::getDirtyRect () const
+{
+	if (hasViewFlag (kDirty) || drawnLedOffset < 0. || !getOnBitmap ())
+		return CControl::getDirtyRect ();
+
+	// the leds between the drawn value and the current value change, and the decay of the
+	// displayed value never goes beyond the current value
+	auto normalize = [this] (float v) {
+		v = std::min (getMax (), std::max (getMin (), v));
+		return (v - getMin ()) / getRange ();
+	};
+	auto nextValue = std::max (getOldValue () - decreaseValue, value);
+	auto offsets = std::minmax ({drawnLedOffset, calculateLedOffset (normalize (nextValue)),
+								 calculateLedOffset (normalize (value))});
+
+	auto dirtyRect = calculateLedRect (offsets.first, offsets.second);
+	if (hasViewFlag (kHasDirtyRect))
+	{
+		if (dirtyRect.isEmpty ())
+			return CControl::getDirtyRect ();
+		dirtyRect.unite (CControl::getDirtyRect ());
+	}
+	return dirtyRect;
 }
 
 //------------------------------------------------------------------------
@@ -127,9 +180,9 @@ void CVuMeter::draw (CDrawContext *_pContext)
 
 	newValue = (newValue - getMin ()) / getRange (); // normalize
 	
+	auto tmp = calculateLedOffset (newValue);
 	if (style & kHorizontal) 
 	{
-		auto tmp = (CCoord)(((int32_t)(nbLed * newValue + 0.5f) / (float)nbLed) * getOnBitmap ()->getWidth ());
 		pointOff (tmp, 0);
 
 		_rectOff.left += tmp;
@@ -137,7 +190,6 @@ void CVuMeter::draw (CDrawContext *_pContext)
 	}
 	else 
 	{
-		auto tmp = (CCoord)(((int32_t)(nbLed * (1.f - newValue) + 0.5f) / (float)nbLed) * getOnBitmap ()->getHeight ());
 		pointOn (0, tmp);
 
 		_rectOff.bottom = tmp + rectOff.top;
@@ -151,6 +203,12 @@ void CVuMeter::draw (CDrawContext *_pContext)
 
 	getOnBitmap ()->draw (pContext, _rectOn, pointOn);
 
+	// the old leds are still visible if the redrawn part did not cover the changed leds
+	if (drawnLedOffset < 0.)
+		drawnLedOffset = isRectInClip (pContext, getViewSize ()) ? tmp : -1.;
+	else if (drawnLedOffset != tmp)
+		drawnLedOffset = isRectInClip (pContext, calculateLedRect (drawnLedOffset, tmp)) ? tmp : -1.;
+
 	setDirty (false);
 }
 
@@ -54,6 +54,7 @@ public:
 	// overrides
 	void setDirty (bool state) override;
 	void draw (CDrawContext* pContext) override;
+	CRect getDirtyRect () const override;
 	void setViewSize (const CRect& newSize, bool invalid = true) override;
 	bool sizeToFit () override;
 	void onIdle () override;
@@ -62,6 +63,11 @@ public:
 protected:
 	~CVuMeter () noexcept override;	
 
+	/** offset of the border between the on and the off part from the top/left of the meter */
+	CCoord calculateLedOffset (float normValue) const;
+	/** the part of the meter between two led offsets */
+	CRect calculateLedRect (CCoord offset1, CCoord offset2) const;
+
 	CBitmap* offBitmap;
 	
 	int32_t     nbLed;
@@ -70,6 +76,9 @@ protected:
 
 	CRect    rectOn;
 	CRect    rectOff;
+
+	/** the led offset of the last draw, negative if unknown */
+	CCoord   drawnLedOffset {-1.};
 };
 
 } // VSTGUI
@@ -27,8 +27,7 @@ void CRowColumnView::setStyle (Style newStyle)
 	if (newStyle != style)
 	{
 		style = newStyle;
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 	}
 }
 
@@ -38,8 +37,7 @@ void CRowColumnView::setSpacing (CCoord newSpacing)
 	if (newSpacing != spacing)
 	{
 		spacing = newSpacing;
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 	}
 }
 
@@ -49,8 +47,7 @@ void CRowColumnView::setMargin (const CRect& newMargin)
 	if (newMargin != margin)
 	{
 		margin = newMargin;
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 	}
 }
 
@@ -60,8 +57,7 @@ void CRowColumnView::setLayoutStyle (LayoutStyle inLayoutStyle)
 	if (inLayoutStyle != layoutStyle)
 	{
 		layoutStyle = inLayoutStyle;
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 	}
 }
 
@@ -235,8 +231,7 @@ CMessageResult CRowColumnView::notify (CBaseObject* sender, IdStringPtr message)
 {
 	if (message == kMsgViewSizeChanged)
 	{
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 	}
 	return CViewContainer::notify (sender, message);
 }
@@ -249,11 +244,38 @@ CAutoLayoutContainerView::CAutoLayoutContainerView (const CRect& size)
 {
 }
 
+//--------------------------------------------------------------------------------
+void CAutoLayoutContainerView::beginLayoutUpdates ()
+{
+	++layoutUpdateCount;
+}
+
+//--------------------------------------------------------------------------------
+void CAutoLayoutContainerView::endLayoutUpdates ()
+{
+	vstgui_assert (layoutUpdateCount > 0);
+	if (--layoutUpdateCount > 0 || !layoutPending)
+		return;
+	layoutPending = false;
+	if (isAttached ())
+		layoutViews ();
+}
+
+//--------------------------------------------------------------------------------
+void CAutoLayoutContainerView::requestLayout ()
+{
+	if (layoutUpdateCount > 0)
+		layoutPending = true;
+	else if (isAttached ())
+		layoutViews ();
+}
+
 //--------------------------------------------------------------------------------
 bool CAutoLayoutContainerView::attached (CView* parent)
 {
 	if (!isAttached ())
 	{
+		layoutPending = false;
 		layoutViews ();
 		return CViewContainer::attached (parent);
 	}
@@ -264,8 +286,7 @@ bool CAutoLayoutContainerView::attached (CView* parent)
 void CAutoLayoutContainerView::setViewSize (const CRect& rect, bool invalid)
 {
 	CViewContainer::setViewSize (rect, invalid);
-	if (isAttached ())
-		layoutViews ();
+	requestLayout ();
 }
 
 //--------------------------------------------------------------------------------
@@ -273,8 +294,7 @@ bool CAutoLayoutContainerView::addView (CView* pView, CView* pBefore)
 {
 	if (CViewContainer::addView (pView, pBefore))
 	{
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 		return true;
 	}
 	return false;
@@ -285,8 +305,7 @@ bool CAutoLayoutContainerView::removeView (CView* pView, bool withForget)
 {
 	if (CViewContainer::removeView (pView, withForget))
 	{
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 		return true;
 	}
 	return false;
@@ -297,8 +316,7 @@ bool CAutoLayoutContainerView::changeViewZOrder (CView* view, uint32_t newIndex)
 {
 	if (CViewContainer::changeViewZOrder (view, newIndex))
 	{
-		if (isAttached ())
-			layoutViews ();
+		requestLayout ();
 		return true;
 	}
 	return false;
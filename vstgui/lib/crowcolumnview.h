@@ -18,6 +18,12 @@ public:
 
 	virtual void layoutViews () = 0;
 
+	/** defer the layout until the matching endLayoutUpdates call, calls can be nested */
+	void beginLayoutUpdates ();
+	/** layout the views once if the layout was requested since the first beginLayoutUpdates call */
+	void endLayoutUpdates ();
+	bool isInLayoutUpdates () const { return layoutUpdateCount > 0; }
+
 	bool attached (CView* parent) override;
 	void setViewSize (const CRect& rect, bool invalid = true) override;
 	bool addView (CView* pView, CView* pBefore = nullptr) override;
@@ -25,6 +31,13 @@ public:
 	bool changeViewZOrder (CView* view, uint32_t newIndex) override;
 
 	CLASS_METHODS_VIRTUAL(CAutoLayoutContainerView, CViewContainer)
+protected:
+	/** layout the views now or when the layout updates end */
+	void requestLayout ();
+
+private:
+	uint32_t layoutUpdateCount {0};
+	bool layoutPending {false};
 };
 
 
@@ -6,6 +6,7 @@
 #include "cdrawcontext.h"
 #include "cbitmap.h"
 #include "cframe.h"
+#include "coffscreencontext.h"
 #include "cvstguitimer.h"
 #include "cgraphicspath.h"
 #include "dispatchlist.h"
@@ -15,7 +16,9 @@
 #include "animation/animator.h"
 #include "../uidescription/icontroller.h"
 #include "platform/iplatformframe.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <unordered_map>
 #if DEBUG
 #include <list>
@@ -144,6 +147,32 @@ protected:
 };
 std::unique_ptr<IdleViewUpdater> IdleViewUpdater::gInstance;
 
+//-----------------------------------------------------------------------------
+struct CompositeLayer
+{
+	OffscreenLayer offscreen;
+	CGraphicsTransform transform;
+	uint32_t useCount {0};
+};
+
+//-----------------------------------------------------------------------------
+static CRect transformBounds (const CGraphicsTransform& transform, const CRect& rect)
+{
+	CPoint corners[] = {rect.getTopLeft (), rect.getTopRight (), rect.getBottomLeft (),
+	                    rect.getBottomRight ()};
+	for (auto& corner : corners)
+		transform.transform (corner);
+	CRect result (corners[0].x, corners[0].y, corners[0].x, corners[0].y);
+	for (const auto& corner : corners)
+	{
+		result.left = std::min (result.left, corner.x);
+		result.top = std::min (result.top, corner.y);
+		result.right = std::max (result.right, corner.x);
+		result.bottom = std::max (result.bottom, corner.y);
+	}
+	return result;
+}
+
 } // CViewInternal
 
 uint32_t CView::idleRate = 30;
@@ -189,6 +218,17 @@ struct CView::Impl
 	int32_t autosizeFlags {kAutosizeNone};
 	CFrame* parentFrame {nullptr};
 	CView* parentView {nullptr};
+	std::unique_ptr<CViewInternal::CompositeLayer> compositeLayer;
+	CRect dirtyRect;
+
+	CGraphicsTransform getCompositeMatrix () const
+	{
+		CGraphicsTransform matrix;
+		matrix.translate (-size.left, -size.top);
+		matrix = compositeLayer->transform * matrix;
+		matrix.translate (size.left, size.top);
+		return matrix;
+	}
 };
 
 //-----------------------------------------------------------------------------
@@ -211,7 +251,7 @@ CView::CView (const CView& v)
 {
 	pImpl = std::unique_ptr<Impl> (new Impl ());
 	pImpl->size = v.pImpl->size;
-	pImpl->viewFlags = v.pImpl->viewFlags;
+	pImpl->viewFlags = v.pImpl->viewFlags & ~kHasCompositeLayer;
 	pImpl->autosizeFlags = v.pImpl->autosizeFlags;
 
 	setMouseableArea (v.getMouseableArea ());
@@ -395,18 +435,57 @@ void CView::setDirty (bool state)
 		if (state)
 		{
 			if (asViewContainer () && getParentView ())
-				getParentView ()->invalidRect (getViewSize ());
+				invalidParentRect (getViewSize ());
 			else
 				invalidRect (getViewSize ());
 		}
 		setViewFlag (kDirty, false);
+		setViewFlag (kHasDirtyRect, false);
 	}
 	else
 	{
 		setViewFlag (kDirty, state);
+		if (!state)
+			setViewFlag (kHasDirtyRect, false);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void CView::setDirtyRect (const CRect& rect)
+{
+	CRect r (rect);
+	r.bound (getViewSize ());
+	if (r.isEmpty ())
+		return;
+	if (asViewContainer ())
+	{
+		setDirty (true);
+		return;
+	}
+	if (kDirtyCallAlwaysOnMainThread && isAttached ())
+	{
+		invalidRect (r);
+		return;
+	}
+	if (hasViewFlag (kDirty))
+		return;
+	if (hasViewFlag (kHasDirtyRect))
+		pImpl->dirtyRect.unite (r);
+	else
+	{
+		pImpl->dirtyRect = r;
+		setViewFlag (kHasDirtyRect, true);
 	}
 }
 
+//-----------------------------------------------------------------------------
+CRect CView::getDirtyRect () const
+{
+	if (hasViewFlag (kHasDirtyRect) && !hasViewFlag (kDirty))
+		return pImpl->dirtyRect;
+	return getViewSize ();
+}
+
 //-----------------------------------------------------------------------------
 void CView::setSubviewState (bool state)
 {
@@ -457,6 +536,8 @@ bool CView::removed (CView* parent)
 	}
 	if (pImpl->parentFrame)
 		pImpl->parentFrame->onViewRemoved (this);
+	if (pImpl->compositeLayer)
+		pImpl->compositeLayer->offscreen.reset ();
 	pImpl->parentView = nullptr;
 	pImpl->parentFrame = nullptr;
 	setViewFlag (kIsAttached, false);
@@ -581,8 +662,61 @@ void CView::invalidRect (const CRect& rect)
 	if (isAttached () && hasViewFlag (kVisible))
 	{
 		vstgui_assert (pImpl->parentView);
+		invalidParentRect (rect);
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool CView::isRectInClip (CDrawContext* context, const CRect& rect) const
+{
+	CRect clipRect;
+	context->getClipRect (clipRect);
+	CRect r (rect);
+	return clipRect.rectInside (r.makeIntegral ());
+}
+
+//-----------------------------------------------------------------------------
+void CView::invalidDirtyRect ()
+{
+	auto dirtyRect = getDirtyRect ();
+	dirtyRect.bound (getViewSize ());
+	if (dirtyRect == getViewSize ())
+	{
+		invalid ();
+		return;
+	}
+	setDirty (false);
+	if (!dirtyRect.isEmpty ())
+		invalidRect (dirtyRect);
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param rect rect to invalidate in the coordinates of the parent view
+ * @param contentChanged if true the rect is redrawn into the composite layer
+ */
+void CView::invalidParentRect (const CRect& rect, bool contentChanged)
+{
+	if (!pImpl->parentView)
+		return;
+	auto layer = pImpl->compositeLayer.get ();
+	if (!layer)
+	{
 		pImpl->parentView->invalidRect (rect);
+		return;
 	}
+	if (contentChanged && layer->offscreen.context)
+	{
+		CRect layerRect (rect);
+		layerRect.offset (-getViewSize ().left, -getViewSize ().top);
+		layerRect.bound (CRect (0, 0, getWidth (), getHeight ()));
+		layer->offscreen.invalidRect (layerRect);
+	}
+	if (layer->transform.isInvariant ())
+		pImpl->parentView->invalidRect (rect);
+	else
+		pImpl->parentView->invalidRect (
+		    CViewInternal::transformBounds (pImpl->getCompositeMatrix (), rect));
 }
 
 //-----------------------------------------------------------------------------
@@ -793,8 +927,7 @@ void CView::setAlphaValue (float alpha)
 	if (oldAlpha != alpha)
 	{
 		// we invalidate the parent to make sure that when alpha == 0 that a redraw occurs
-		if (pImpl->parentView)
-			pImpl->parentView->invalidRect (getViewSize ());
+		invalidParentRect (getViewSize (), false);
 	}
 }
 
@@ -807,6 +940,100 @@ float CView::getAlphaValue () const
 	return a;
 }
 
+//-----------------------------------------------------------------------------
+void CView::enableCompositeLayer ()
+{
+	if (!pImpl->compositeLayer)
+	{
+		pImpl->compositeLayer = std::unique_ptr<CViewInternal::CompositeLayer> (
+		    new CViewInternal::CompositeLayer ());
+		setViewFlag (kHasCompositeLayer, true);
+	}
+	++pImpl->compositeLayer->useCount;
+}
+
+//-----------------------------------------------------------------------------
+void CView::disableCompositeLayer ()
+{
+	auto layer = pImpl->compositeLayer.get ();
+	if (!layer)
+		return;
+	vstgui_assert (layer->useCount > 0);
+	if (--layer->useCount > 0)
+		return;
+	auto transformed = !layer->transform.isInvariant ();
+	auto bounds = getCompositeViewSize ();
+	pImpl->compositeLayer = nullptr;
+	setViewFlag (kHasCompositeLayer, false);
+	if (transformed && pImpl->parentView && isVisible ())
+		pImpl->parentView->invalidRect (bounds.unite (getViewSize ()));
+}
+
+//-----------------------------------------------------------------------------
+void CView::setCompositeTransform (const CGraphicsTransform& transform)
+{
+	auto layer = pImpl->compositeLayer.get ();
+	if (!layer || layer->transform == transform)
+		return;
+	auto bounds = getCompositeViewSize ();
+	layer->transform = transform;
+	if (pImpl->parentView && isVisible ())
+		pImpl->parentView->invalidRect (bounds.unite (getCompositeViewSize ()));
+}
+
+//-----------------------------------------------------------------------------
+CGraphicsTransform CView::getCompositeTransform () const
+{
+	if (auto layer = pImpl->compositeLayer.get ())
+		return layer->transform;
+	return {};
+}
+
+//-----------------------------------------------------------------------------
+CRect CView::getCompositeViewSize () const
+{
+	auto layer = pImpl->compositeLayer.get ();
+	if (!layer || layer->transform.isInvariant ())
+		return getViewSize ();
+	return CViewInternal::transformBounds (pImpl->getCompositeMatrix (), getViewSize ());
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param pContext the context of the parent container
+ * @param updateRect the area to draw in the coordinates of the parent container
+ */
+void CView::drawCompositeLayer (CDrawContext* pContext, const CRect& updateRect)
+{
+	auto layer = pImpl->compositeLayer.get ();
+	if (!layer)
+	{
+		drawRect (pContext, updateRect);
+		return;
+	}
+	auto matrix = pImpl->getCompositeMatrix ();
+	auto& offscreen = layer->offscreen;
+	if (!offscreen.update (pContext, getFrame (), getWidth (), getHeight ()))
+	{
+		// draw directly with the composite transform applied
+		CDrawContext::Transform transform (*pContext, matrix);
+		CRect r (CViewInternal::transformBounds (matrix.inverse (), updateRect));
+		r.bound (getViewSize ());
+		if (!r.isEmpty ())
+			drawRect (pContext, r);
+		return;
+	}
+	offscreen.redrawDirty (pContext, getViewSize (), [this] (CDrawContext* context, const CRect& r) {
+		drawRect (context, r);
+	});
+	if (auto cachedBitmap = offscreen.context->getBitmap ())
+	{
+		CDrawContext::Transform transform (*pContext, matrix);
+		pContext->drawBitmap (cachedBitmap, getViewSize ());
+	}
+	setDirty (false);
+}
+
 //-----------------------------------------------------------------------------
 void CView::setAutosizeFlags (int32_t flags)
 {
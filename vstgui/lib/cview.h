@@ -64,9 +64,20 @@ public:
 	virtual bool checkUpdate (const CRect& updateRect) const { return updateRect.rectOverlap (getViewSize ()); }
 
 	/** check if view is dirty */
-	virtual bool isDirty () const { return hasViewFlag (kDirty); }
+	virtual bool isDirty () const { return hasViewFlag (kDirty | kHasDirtyRect); }
 	/** set the view to dirty so that it is redrawn in the next idle. Thread Safe ! */
 	virtual void setDirty (bool val = true);
+	/** set a part of the view dirty so that only this part is redrawn in the next idle. The rect is
+	 *	in the same coordinates as getViewSize () and is united with the rects set before. Not
+	 *	thread safe, call it on the main thread.
+	 */
+	void setDirtyRect (const CRect& rect);
+	/** the part of the view which needs to be redrawn when it is dirty, in the same coordinates as
+	 *	getViewSize (). This is the whole view, or only the rect set via setDirtyRect (). Views which
+	 *	know which part changes when their value changes can return a smaller rect, or an empty rect
+	 *	if nothing visible changed.
+	 */
+	virtual CRect getDirtyRect () const;
 	/** if this is true, setting a view dirty will call invalid() instead of checking it in idle. Default value is false. */
 	static bool kDirtyCallAlwaysOnMainThread;
 
@@ -74,6 +85,8 @@ public:
 	virtual void invalidRect (const CRect& rect);
 	/** mark whole view as invalid */
 	virtual void invalid () { setDirty (false); invalidRect (getViewSize ()); }
+	/** mark only the dirty part of the view as invalid, see getDirtyRect () */
+	void invalidDirtyRect ();
 
 	/** set visibility state */
 	virtual void setVisible (bool state);
@@ -264,6 +277,27 @@ public:
 	float getAlphaValue () const;
 	//@}
 
+	//-----------------------------------------------------------------------------
+	/// @name Composite Layer Methods
+	//-----------------------------------------------------------------------------
+	//@{
+	/** draw this view via an offscreen bitmap which its parent container composites with the
+	 *	alpha value and the composite transform. The view content is only redrawn into the bitmap
+	 *	when the view is invalidated, changing the alpha value or the composite transform only
+	 *	needs a blit. Calls must be balanced with disableCompositeLayer. */
+	void enableCompositeLayer ();
+	void disableCompositeLayer ();
+	bool hasCompositeLayer () const { return hasViewFlag (kHasCompositeLayer); }
+	/** set the transform applied to the composite layer relative to the view origin. It does not
+	 *	change the view size, hit testing or layouting. Has no effect without a composite layer. */
+	void setCompositeTransform (const CGraphicsTransform& transform);
+	CGraphicsTransform getCompositeTransform () const;
+	/** get the view size with the composite transform applied, in the coordinates of the parent */
+	CRect getCompositeViewSize () const;
+	/** draw the composite layer, called by the parent container instead of drawRect */
+	void drawCompositeLayer (CDrawContext* pContext, const CRect& updateRect);
+	//@}
+
 	//-----------------------------------------------------------------------------
 	/// @name Attaching Methods
 	//-----------------------------------------------------------------------------
@@ -389,7 +423,9 @@ protected:
 		kHasBackground			= 1 << 9,
 		kHasDisabledBackground	= 1 << 10,
 		kHasMouseableArea		= 1 << 11,
-		kLastCViewFlag			= 11
+		kHasCompositeLayer		= 1 << 12,
+		kHasDirtyRect			= 1 << 13,
+		kLastCViewFlag			= 13
 	};
 
 	~CView () noexcept override;
@@ -400,6 +436,13 @@ protected:
 	void setViewFlag (int32_t bit, bool state);
 	
 	void setAlphaValueNoInvalidate (float value);
+	/** check if the clip rect of the context covers the rect, which is rounded to full pixels like
+	 *	the rects passed to CFrame::invalidRect (). Views with their own getDirtyRect () use it in
+	 *	draw () to know if the part which changed was redrawn. */
+	bool isRectInClip (CDrawContext* context, const CRect& rect) const;
+	/** invalidate rect of the parent view, rect is in the coordinates of the parent view. If the
+	 *	content of the view has changed, the composite layer is redrawn too. */
+	void invalidParentRect (const CRect& rect, bool contentChanged = true);
 	void setParentFrame (CFrame* frame);
 	void setParentView (CView* parent);
 
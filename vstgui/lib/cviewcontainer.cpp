@@ -40,6 +40,8 @@ struct CViewContainer::Impl
 	
 	CDrawStyle backgroundColorDrawStyle {kDrawFilledAndStroked};
 	CColor backgroundColor {kBlackCColor};
+
+	OffscreenLayer cachedBitmap;
 };
 
 //------------------------------------------------------------------------
@@ -147,6 +149,7 @@ CViewContainer::CViewContainer (const CViewContainer& v)
 	pImpl->backgroundColorDrawStyle = v.pImpl->backgroundColorDrawStyle;
 	pImpl->backgroundColor = v.pImpl->backgroundColor;
 	setBackgroundOffset (v.getBackgroundOffset ());
+	setViewFlag (kCacheAsBitmap, v.getCacheAsBitmap ());
 	for (auto& view : v.pImpl->children)
 		addView (static_cast<CView*> (view->newCopy ()));
 }
@@ -224,6 +227,26 @@ void CViewContainer::clearMouseDownView ()
 	removeAttribute (kCViewContainerMouseDownViewAttribute);
 }
 
+//-----------------------------------------------------------------------------
+void CViewContainer::setCacheAsBitmap (bool state)
+{
+	if (state == getCacheAsBitmap ())
+		return;
+	setViewFlag (kCacheAsBitmap, state);
+	pImpl->cachedBitmap.reset ();
+	invalid ();
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param rect the area to redraw into the cached bitmap, in the coordinates of the bitmap
+ */
+void CViewContainer::invalidCachedBitmapRect (const CRect& rect)
+{
+	if (pImpl->cachedBitmap.context)
+		pImpl->cachedBitmap.invalidRect (rect);
+}
+
 //-----------------------------------------------------------------------------
 CRect CViewContainer::getLastDrawnFocus () const
 {
@@ -254,6 +277,7 @@ void CViewContainer::setTransform (const CGraphicsTransform& t)
 	if (getTransform () != t)
 	{
 		pImpl->transform = t;
+		invalidCachedBitmapRect (CRect (0, 0, getWidth (), getHeight ()));
 		pImpl->viewContainerListeners.forEach ([this] (IViewContainerListener* listener) {
 			listener->viewContainerTransformChanged (this);
 		});
@@ -713,8 +737,7 @@ bool CViewContainer::invalidateDirtyViews ()
 		return true;
 	if (CView::isDirty ())
 	{
-		if (auto parent = getParentView ())
-			parent->invalidRect (getViewSize ());
+		invalidParentRect (getViewSize ());
 		return true;
 	}
 	for (const auto& pV : pImpl->children)
@@ -724,7 +747,7 @@ bool CViewContainer::invalidateDirtyViews ()
 			if (CViewContainer* container = pV->asViewContainer ())
 				container->invalidateDirtyViews ();
 			else
-				pV->invalid ();
+				pV->invalidDirtyRect ();
 		}
 	}
 	return true;
@@ -735,9 +758,8 @@ void CViewContainer::invalid ()
 {
 	if (!isVisible ())
 		return;
-	CRect _rect (getViewSize ());
-	if (auto parent = getParentView ())
-		parent->invalidRect (_rect);
+	invalidCachedBitmapRect (CRect (0, 0, getWidth (), getHeight ()));
+	invalidParentRect (getViewSize ());
 }
 
 //-----------------------------------------------------------------------------
@@ -751,8 +773,13 @@ void CViewContainer::invalidRect (const CRect& rect)
 	_rect.bound (getViewSize ());
 	if (_rect.isEmpty ())
 		return;
-	if (auto parent = getParentView ())
-		parent->invalidRect (_rect);
+	if (pImpl->cachedBitmap.context)
+	{
+		CRect cacheRect (_rect);
+		cacheRect.offset (-getViewSize ().left, -getViewSize ().top);
+		invalidCachedBitmapRect (cacheRect);
+	}
+	invalidParentRect (_rect);
 }
 
 //-----------------------------------------------------------------------------
@@ -806,6 +833,48 @@ void CViewContainer::drawBackgroundRect (CDrawContext* pContext, const CRect& _u
  * @param updateRect the area which to draw
  */
 void CViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
+{
+	if (getCacheAsBitmap () && drawCachedBitmap (pContext, updateRect))
+	{
+		setDirty (false);
+		return;
+	}
+	drawRectUncached (pContext, updateRect);
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param pContext the context which to use to draw
+ * @param updateRect the area which to draw
+ * @return false if no offscreen context could be created
+ */
+bool CViewContainer::drawCachedBitmap (CDrawContext* pContext, const CRect& updateRect)
+{
+	auto& cache = pImpl->cachedBitmap;
+	if (!cache.update (pContext, getFrame (), getWidth (), getHeight ()))
+		return false;
+	cache.redrawDirty (pContext, getViewSize (), [this] (CDrawContext* context, const CRect& r) {
+		drawRectUncached (context, r);
+	});
+	auto bitmap = cache.context->getBitmap ();
+	if (!bitmap)
+		return false;
+
+	CRect destRect (updateRect);
+	destRect.bound (getViewSize ());
+	if (destRect.isEmpty ())
+		return true;
+	CPoint offset (destRect.left - getViewSize ().left, destRect.top - getViewSize ().top);
+	pContext->drawBitmap (bitmap, destRect, offset);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @param pContext the context which to use to draw
+ * @param updateRect the area which to draw
+ */
+void CViewContainer::drawRectUncached (CDrawContext* pContext, const CRect& updateRect)
 {
 	CPoint offset (getViewSize ().left, getViewSize ().top);
 	CDrawContext::Transform offsetTransform (*pContext, CGraphicsTransform ().translate (offset.x, offset.y));
@@ -872,14 +941,22 @@ void CViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
 
 				if (checkUpdateRect (pV, clientRect))
 				{
-					CRect viewSize = pV->getViewSize ();
+					CRect viewSize = pV->getCompositeViewSize ();
 					viewSize.bound (newClip);
 					if (viewSize.getWidth () == 0 || viewSize.getHeight () == 0)
 						continue;
 					pContext->setClipRect (viewSize);
 					float globalContextAlpha = pContext->getGlobalAlpha ();
 					pContext->setGlobalAlpha (globalContextAlpha * pV->getAlphaValue ());
-					pV->drawRect (pContext, viewSize);
+					auto profiler = pContext->getDrawProfiler ();
+					if (profiler)
+						profiler->beginView (pV);
+					if (pV->hasCompositeLayer ())
+						pV->drawCompositeLayer (pContext, viewSize);
+					else
+						pV->drawRect (pContext, viewSize);
+					if (profiler)
+						profiler->endView ();
 					pContext->setGlobalAlpha (globalContextAlpha);
 				}
 			}
@@ -930,6 +1007,8 @@ void CViewContainer::drawRect (CDrawContext* pContext, const CRect& updateRect)
  */
 bool CViewContainer::checkUpdateRect (CView* view, const CRect& rect)
 {
+	if (view->hasCompositeLayer ())
+		return rect.rectOverlap (view->getCompositeViewSize ()) && view->isVisible ();
 	return view->checkUpdate (rect) && view->isVisible ();
 }
 
@@ -1260,6 +1339,14 @@ bool CViewContainer::advanceNextFocusView (CView* oldFocus, bool reverse)
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+void CViewContainer::setDirty (bool state)
+{
+	if (state)
+		invalidCachedBitmapRect (CRect (0, 0, getWidth (), getHeight ()));
+	CView::setDirty (state);
+}
+
 //-----------------------------------------------------------------------------
 bool CViewContainer::isDirty () const
 {
@@ -1428,6 +1515,8 @@ bool CViewContainer::removed (CView* parent)
 	if (!isAttached ())
 		return false;
 
+	pImpl->cachedBitmap.reset ();
+
 	for (const auto& pV : pImpl->children)
 		pV->removed (this);
 	
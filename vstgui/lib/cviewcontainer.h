@@ -94,6 +94,12 @@ public:
 	virtual void setAutosizingEnabled (bool state);
 	bool getAutosizingEnabled () const { return hasViewFlag (kAutosizeSubviews); }
 
+	/** enable or disable caching the drawing of this container and its subviews in an offscreen
+	 *	bitmap. Only the invalidated areas are redrawn into the bitmap, all other drawing is
+	 *	a single blit. Per default this is disabled. */
+	void setCacheAsBitmap (bool state);
+	bool getCacheAsBitmap () const { return hasViewFlag (kCacheAsBitmap); }
+
 	/** get child views of type ViewClass. ContainerClass must be a stdc++ container */
 	template<class ViewClass, class ContainerClass>
 	uint32_t getChildViewsOfType (ContainerClass& result, bool deep = false) const;
@@ -156,6 +162,7 @@ public:
 	void takeFocus () override;
 
 	bool isDirty () const override;
+	void setDirty (bool state = true) override;
 
 	void invalid () override;
 	void invalidRect (const CRect& rect) override;
@@ -236,7 +243,8 @@ public:
 
 protected:
 	enum {
-		kAutosizeSubviews = 1 << (CView::kLastCViewFlag + 1)
+		kAutosizeSubviews = 1 << (CView::kLastCViewFlag + 1),
+		kCacheAsBitmap = 1 << (CView::kLastCViewFlag + 2)
 	};
 	
 	~CViewContainer () noexcept override;
@@ -250,6 +258,9 @@ protected:
 	const ViewList& getChildren () const;
 private:
 	void clearMouseDownView ();
+	void invalidCachedBitmapRect (const CRect& rect);
+	bool drawCachedBitmap (CDrawContext* pContext, const CRect& updateRect);
+	void drawRectUncached (CDrawContext* pContext, const CRect& updateRect);
 	CRect getLastDrawnFocus () const;
 	void setLastDrawnFocus (CRect r);
 
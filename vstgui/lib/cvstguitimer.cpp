@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "cvstguitimer.h"
+#include <chrono>
 
 #if DEBUG
 #define DEBUGLOG	0
@@ -10,13 +11,154 @@
 
 namespace VSTGUI {
 
+//-----------------------------------------------------------------------------
+/** drives the timer wheel with one platform timer which is started with the interval to the next
+ *	deadline and only restarted when its next fire does not hit the next deadline anymore. The
+ *	platform timers fire on the thread which created them, so every thread has its own scheduler.
+ */
+class TimerScheduler final : public IPlatformTimerCallback
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static TimerScheduler& instance ()
+	{
+		static thread_local TimerScheduler gInstance;
+		return gInstance;
+	}
+
+	bool add (TimerWheel::Entry& entry, uint32_t period)
+	{
+		auto now = getCurrentTick ();
+		if (wheel.empty ())
+			wheel.advance (now);
+		wheel.add (entry, now + period, period);
+		if (advanceDepth == 0 && !schedule (now))
+		{
+			wheel.remove (entry);
+			return false;
+		}
+		return true;
+	}
+
+	void remove (TimerWheel::Entry& entry)
+	{
+		wheel.remove (entry);
+		// a platform timer firing too early is cheaper than restarting it
+		if (advanceDepth == 0 && wheel.empty ())
+			stopPlatformTimer ();
+	}
+
+	void fire () override
+	{
+		auto now = getCurrentTick ();
+		++statistics.numWakeups;
+		platformTimerDeadline = now + platformTimerPeriod;
+		++advanceDepth;
+		statistics.numCallbacks += wheel.advance (now + coalescingWindow);
+		--advanceDepth;
+		if (advanceDepth == 0)
+			schedule (getCurrentTick ());
+	}
+
+	CVSTGUITimer::Statistics getStatistics () const
+	{
+		auto result = statistics;
+		result.numTimers = wheel.getNumEntries ();
+		std::chrono::duration<double> duration = Clock::now () - statisticsStart;
+		result.seconds = duration.count ();
+		return result;
+	}
+
+	void resetStatistics ()
+	{
+		statistics = {};
+		statisticsStart = Clock::now ();
+	}
+
+	void setClock (CVSTGUITimer::ClockFunc&& func)
+	{
+		auto now = getCurrentTick ();
+		clock = std::move (func);
+		clockOffset = 0;
+		clockOffset = static_cast<int64_t> (now) - static_cast<int64_t> (getCurrentTick ());
+		// the platform timer may belong to another run loop and its deadline to the other clock
+		stopPlatformTimer ();
+		if (advanceDepth == 0)
+			schedule (now);
+	}
+
+	uint32_t coalescingWindow {2};
+
+private:
+	TimerScheduler () : epoch (Clock::now ()), statisticsStart (epoch) {}
+
+	uint64_t getCurrentTick () const
+	{
+		int64_t ticks;
+		if (clock)
+			ticks = static_cast<int64_t> (clock ());
+		else
+			ticks = std::chrono::duration_cast<std::chrono::milliseconds> (Clock::now () - epoch)
+			            .count ();
+		return static_cast<uint64_t> (ticks + clockOffset);
+	}
+
+	bool schedule (uint64_t now)
+	{
+		if (wheel.empty ())
+		{
+			stopPlatformTimer ();
+			return true;
+		}
+		auto nextDeadline = wheel.getNextDeadline ();
+		if (platformTimer && platformTimerDeadline <= nextDeadline &&
+		    platformTimerDeadline + coalescingWindow >= nextDeadline)
+			return true;
+		auto delay = nextDeadline > now ? nextDeadline - now : 1;
+		if (delay > 0xFFFFFFFF)
+			delay = 0xFFFFFFFF;
+		if (platformTimer)
+			platformTimer->stop ();
+		else if (!(platformTimer = IPlatformTimer::create (this)))
+			return false;
+		platformTimerPeriod = static_cast<uint32_t> (delay);
+		platformTimerDeadline = now + delay;
+		++statistics.numPlatformTimerStarts;
+		if (platformTimer->start (platformTimerPeriod))
+			return true;
+		platformTimer = nullptr;
+		return false;
+	}
+
+	void stopPlatformTimer ()
+	{
+		if (platformTimer)
+		{
+			platformTimer->stop ();
+			platformTimer = nullptr;
+		}
+	}
+
+	TimerWheel wheel;
+	SharedPointer<IPlatformTimer> platformTimer;
+	uint32_t platformTimerPeriod {0};
+	uint64_t platformTimerDeadline {0};
+	uint32_t advanceDepth {0};
+	CVSTGUITimer::ClockFunc clock;
+	int64_t clockOffset {0};
+	Clock::time_point epoch;
+	Clock::time_point statisticsStart;
+	CVSTGUITimer::Statistics statistics;
+};
+
 //-----------------------------------------------------------------------------
 IdStringPtr CVSTGUITimer::kMsgTimer = "timer fired";
 
 //-----------------------------------------------------------------------------
 CVSTGUITimer::CVSTGUITimer (CBaseObject* timerObject, uint32_t fireTime, bool doStart)
 : fireTime (fireTime)
-, platformTimer (nullptr)
+, wheelEntry (this)
 {
 	callbackFunc = [timerObject](CVSTGUITimer* timer) {
 		timerObject->notify (timer, kMsgTimer);
@@ -29,7 +171,7 @@ CVSTGUITimer::CVSTGUITimer (CBaseObject* timerObject, uint32_t fireTime, bool do
 CVSTGUITimer::CVSTGUITimer (const CallbackFunc& callback, uint32_t fireTime, bool doStart)
 : fireTime (fireTime)
 , callbackFunc (callback)
-, platformTimer (nullptr)
+, wheelEntry (this)
 {
 	if (doStart)
 		start ();
@@ -39,7 +181,7 @@ CVSTGUITimer::CVSTGUITimer (const CallbackFunc& callback, uint32_t fireTime, boo
 CVSTGUITimer::CVSTGUITimer (CallbackFunc&& callback, uint32_t fireTime, bool doStart)
 : fireTime (fireTime)
 , callbackFunc (std::move (callback))
-, platformTimer (nullptr)
+, wheelEntry (this)
 {
 	if (doStart)
 		start ();
@@ -58,30 +200,31 @@ void CVSTGUITimer::beforeDelete ()
 //-----------------------------------------------------------------------------
 bool CVSTGUITimer::start ()
 {
-	if (platformTimer == nullptr)
+	if (!wheelEntry.isScheduled ())
 	{
-		platformTimer = IPlatformTimer::create (this);
-		if (platformTimer)
+		auto& threadScheduler = TimerScheduler::instance ();
+		if (threadScheduler.add (wheelEntry, fireTime ? fireTime : 1))
 		{
-			platformTimer->start (fireTime);
+			scheduler = &threadScheduler;
 		#if DEBUGLOG
-			DebugPrint ("Timer started (0x%x)\n", timerObject);
+			DebugPrint ("Timer started (0x%x)\n", this);
 		#endif
 		}
 	}
-	return (platformTimer != nullptr);
+	return wheelEntry.isScheduled ();
 }
 
 //-----------------------------------------------------------------------------
 bool CVSTGUITimer::stop ()
 {
-	if (platformTimer)
+	if (wheelEntry.isScheduled ())
 	{
-		platformTimer->stop ();
-		platformTimer = nullptr;
+		vstgui_assert (scheduler == &TimerScheduler::instance (),
+		               "timer must be stopped on the thread which started it");
+		scheduler->remove (wheelEntry);
 
 		#if DEBUGLOG
-		DebugPrint ("Timer stopped (0x%x)\n", timerObject);
+		DebugPrint ("Timer stopped (0x%x)\n", this);
 		#endif
 		return true;
 	}
@@ -110,5 +253,34 @@ void CVSTGUITimer::fire ()
 		callbackFunc (this);
 }
 
-} // VSTGUI
+//-----------------------------------------------------------------------------
+CVSTGUITimer::Statistics CVSTGUITimer::getStatistics ()
+{
+	return TimerScheduler::instance ().getStatistics ();
+}
 
+//-----------------------------------------------------------------------------
+void CVSTGUITimer::resetStatistics ()
+{
+	TimerScheduler::instance ().resetStatistics ();
+}
+
+//-----------------------------------------------------------------------------
+void CVSTGUITimer::setCoalescingWindow (uint32_t milliseconds)
+{
+	TimerScheduler::instance ().coalescingWindow = milliseconds;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t CVSTGUITimer::getCoalescingWindow ()
+{
+	return TimerScheduler::instance ().coalescingWindow;
+}
+
+//-----------------------------------------------------------------------------
+void CVSTGUITimer::setClock (ClockFunc&& clock)
+{
+	TimerScheduler::instance ().setClock (std::move (clock));
+}
+
+} // VSTGUI
@@ -5,14 +5,19 @@
 #pragma once
 
 #include "vstguibase.h"
+#include "timerwheel.h"
 #include "platform/iplatformtimer.h"
 #include <functional>
 
 namespace VSTGUI {
 
+class TimerScheduler;
+
 //-----------------------------------------------------------------------------
 // CVSTGUITimer Declaration
 //! A timer class, which posts timer messages to CBaseObjects or calls a lambda function (c++11 only).
+//! The timers of a thread are scheduled on one TimerWheel which is driven by a single platform timer
+//! of that thread. A timer fires on the thread which started it and must be stopped there.
 //-----------------------------------------------------------------------------
 class CVSTGUITimer final : public CBaseObject, public IPlatformTimerCallback
 {
@@ -33,6 +38,36 @@ public:
 	/** get fire time in milliseconds*/
 	uint32_t getFireTime () const { return fireTime; }
 
+	struct Statistics
+	{
+		/** number of running timers */
+		uint32_t numTimers {0};
+		/** number of times the platform timer woke up the timer wheel */
+		uint64_t numWakeups {0};
+		/** number of fired timers */
+		uint64_t numCallbacks {0};
+		/** number of times the platform timer was (re)started with a new interval */
+		uint64_t numPlatformTimerStarts {0};
+		/** seconds since the statistics were reset */
+		double seconds {0.};
+
+		double getWakeupsPerSecond () const { return seconds > 0. ? numWakeups / seconds : 0.; }
+	};
+	/** statistics of the timers of the calling thread */
+	static Statistics getStatistics ();
+	static void resetStatistics ();
+
+	/** timers of the calling thread due within this many milliseconds after a wakeup are fired
+	 *	with that wakeup */
+	static void setCoalescingWindow (uint32_t milliseconds);
+	static uint32_t getCoalescingWindow ();
+
+	using ClockFunc = std::function<uint64_t ()>;
+	/** replace the clock (in milliseconds) the timers of the calling thread are scheduled with,
+	 *	e.g. by a manual clock for deterministic headless runs. nullptr restores the system clock.
+	 *	The time of running timers continues seamlessly with the new clock. */
+	static void setClock (ClockFunc&& clock);
+
 //-----------------------------------------------------------------------------
 	/** message string posted to CBaseObject's notify method */
 	static IdStringPtr kMsgTimer;
@@ -47,7 +82,8 @@ protected:
 	uint32_t fireTime;
 	CallbackFunc callbackFunc;
 
-	SharedPointer<IPlatformTimer> platformTimer;
+	TimerWheel::Entry wheelEntry;
+	TimerScheduler* scheduler {nullptr};
 };
 
 namespace Call
@@ -0,0 +1,250 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "drawprofiler.h"
+#include "cview.h"
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+
+//------------------------------------------------------------------------
+namespace {
+
+//------------------------------------------------------------------------
+void writeJSONString (std::ostream& stream, const std::string& str)
+{
+	stream << '"';
+	for (auto c : str)
+	{
+		if (c == '"' || c == '\\')
+			stream << '\\';
+		stream << c;
+	}
+	stream << '"';
+}
+
+//------------------------------------------------------------------------
+const char* drawCallTypeNames[DrawProfiler::kNumDrawCallTypes] = {
+	"line", "lines", "polygon", "rect", "arc", "ellipse", "point", "bitmap", "clearRect",
+	"graphicsPath", "linearGradient", "radialGradient", "string"};
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+uint32_t DrawProfiler::FrameRecord::getNumDrawCalls () const
+{
+	return std::accumulate (drawCalls.begin (), drawCalls.end (), 0u);
+}
+
+//------------------------------------------------------------------------
+DrawProfiler::DrawProfiler (uint32_t frameCapacity, uint32_t viewCapacity)
+: frames (frameCapacity), views (viewCapacity), epoch (Clock::now ())
+{
+	viewStack.reserve (32);
+}
+
+//------------------------------------------------------------------------
+DrawProfiler::~DrawProfiler () noexcept = default;
+
+//------------------------------------------------------------------------
+uint64_t DrawProfiler::toMicroseconds (Clock::time_point time) const
+{
+	return static_cast<uint64_t> (
+		std::chrono::duration_cast<std::chrono::microseconds> (time - epoch).count ());
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::beginFrame (const CRect& updateRect)
+{
+	vstgui_assert (!inFrame, "frames can not be nested");
+	inFrame = true;
+	currentFrame = {};
+	currentFrame.frameNumber = frameCounter;
+	currentFrame.updateRect = updateRect;
+	currentFrame.numInvalidRects = numInvalidRects;
+	numInvalidRects = 0;
+	frameStart = Clock::now ();
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::endFrame ()
+{
+	vstgui_assert (inFrame && viewStack.empty ());
+	auto now = Clock::now ();
+	currentFrame.startTime = toMicroseconds (frameStart);
+	currentFrame.duration = static_cast<uint64_t> (
+		std::chrono::duration_cast<std::chrono::microseconds> (now - frameStart).count ());
+	frames.push (currentFrame);
+	++frameCounter;
+	inFrame = false;
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::beginView (const CView* view)
+{
+	++currentFrame.numViewsDrawn;
+	viewStack.push_back ({&typeid (*view), Clock::now (), Clock::duration::zero ()});
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::endView ()
+{
+	vstgui_assert (!viewStack.empty ());
+	auto now = Clock::now ();
+	const auto& entry = viewStack.back ();
+	auto duration = now - entry.start;
+
+	ViewRecord record;
+	record.viewClass = entry.viewClass;
+	record.frameNumber = currentFrame.frameNumber;
+	record.startTime = toMicroseconds (entry.start);
+	record.duration = static_cast<uint64_t> (
+		std::chrono::duration_cast<std::chrono::microseconds> (duration).count ());
+	record.selfDuration = static_cast<uint64_t> (
+		std::chrono::duration_cast<std::chrono::microseconds> (duration - entry.childDuration)
+			.count ());
+	record.depth = static_cast<uint32_t> (viewStack.size () - 1);
+	views.push (record);
+
+	viewStack.pop_back ();
+	if (!viewStack.empty ())
+		viewStack.back ().childDuration += duration;
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::onBitmapDraw (const CRect& dest, double scaleFactor)
+{
+	++currentFrame.drawCalls[kBitmap];
+	auto width = static_cast<uint64_t> (dest.getWidth () * scaleFactor);
+	auto height = static_cast<uint64_t> (dest.getHeight () * scaleFactor);
+	currentFrame.bitmapBytes += width * height * 4;
+}
+
+//------------------------------------------------------------------------
+std::vector<DrawProfiler::FrameRecord> DrawProfiler::getFrames () const
+{
+	return frames.copy ();
+}
+
+//------------------------------------------------------------------------
+std::vector<DrawProfiler::ViewRecord> DrawProfiler::getViewRecords () const
+{
+	return views.copy ();
+}
+
+//------------------------------------------------------------------------
+std::vector<DrawProfiler::ViewClassTime> DrawProfiler::getViewClassTimes () const
+{
+	std::unordered_map<const std::type_info*, ViewClassTime> classTimes;
+	for (const auto& record : views.copy ())
+	{
+		auto& classTime = classTimes[record.viewClass];
+		classTime.selfTime += record.selfDuration;
+		++classTime.numDraws;
+	}
+	std::vector<ViewClassTime> result;
+	result.reserve (classTimes.size ());
+	for (auto& entry : classTimes)
+	{
+		entry.second.className = getClassName (*entry.first);
+		result.emplace_back (std::move (entry.second));
+	}
+	std::sort (result.begin (), result.end (), [] (const auto& c1, const auto& c2) {
+		if (c1.selfTime == c2.selfTime)
+			return c1.className < c2.className;
+		return c1.selfTime > c2.selfTime;
+	});
+	return result;
+}
+
+//------------------------------------------------------------------------
+void DrawProfiler::writeChromeTrace (std::ostream& stream) const
+{
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool first = true;
+	auto beginEvent = [&] (const std::string& name, const char* category, uint64_t startTime,
+						   uint64_t duration) {
+		if (!first)
+			stream << ",";
+		first = false;
+		stream << "\n{\"name\":";
+		writeJSONString (stream, name);
+		stream << ",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+			   << startTime << ",\"dur\":" << duration;
+	};
+
+	for (const auto& frame : frames.copy ())
+	{
+		beginEvent ("Frame", "frame", frame.startTime, frame.duration);
+		stream << ",\"args\":{\"frame\":" << frame.frameNumber
+			   << ",\"invalidRects\":" << frame.numInvalidRects
+			   << ",\"viewsDrawn\":" << frame.numViewsDrawn
+			   << ",\"bitmapBytes\":" << frame.bitmapBytes
+			   << ",\"drawCalls\":" << frame.getNumDrawCalls ();
+		for (auto i = 0u; i < kNumDrawCallTypes; ++i)
+		{
+			if (frame.drawCalls[i])
+				stream << ",\"" << drawCallTypeNames[i] << "\":" << frame.drawCalls[i];
+		}
+		stream << "}}";
+	}
+
+	std::unordered_map<const std::type_info*, std::string> classNames;
+	for (const auto& view : views.copy ())
+	{
+		auto it = classNames.find (view.viewClass);
+		if (it == classNames.end ())
+			it = classNames.emplace (view.viewClass, getClassName (*view.viewClass)).first;
+		beginEvent (it->second, "view", view.startTime, view.duration);
+		stream << ",\"args\":{\"frame\":" << view.frameNumber << ",\"self\":" << view.selfDuration
+			   << "}}";
+	}
+	stream << "\n]}\n";
+}
+
+//------------------------------------------------------------------------
+std::string DrawProfiler::getChromeTrace () const
+{
+	std::ostringstream stream;
+	writeChromeTrace (stream);
+	return stream.str ();
+}
+
+//------------------------------------------------------------------------
+std::string DrawProfiler::getClassName (const std::type_info& type)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	int status = 0;
+	if (auto demangled = abi::__cxa_demangle (type.name (), nullptr, nullptr, &status))
+	{
+		std::string result (demangled);
+		std::free (demangled);
+		return result;
+	}
+	return type.name ();
+#else
+	// MSVC returns "class VSTGUI::CView"
+	std::string result (type.name ());
+	for (auto prefix : {"class ", "struct "})
+	{
+		auto length = strlen (prefix);
+		if (result.compare (0, length, prefix) == 0)
+			return result.substr (length);
+	}
+	return result;
+#endif
+}
+
+//------------------------------------------------------------------------
+} // VSTGUI
@@ -0,0 +1,195 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "vstguifwd.h"
+#include "crect.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+
+//------------------------------------------------------------------------
+/** Records where the paint time of a frame goes
+ *
+ *	Set it with CFrame::setDrawProfiler. Every CFrame::platformDrawRect call is recorded as one
+ *	frame with the rects invalidated since the previous frame, the views drawn, the draw calls of
+ *	the draw context by type and the bitmap bytes blitted. Every view drawn by a CViewContainer is
+ *	recorded with its class and draw time.
+ *
+ *	The records are written by the UI thread into fixed size ring buffers without locks, the
+ *	oldest records are overwritten. The query methods can be called from any thread.
+ */
+class DrawProfiler : public AtomicReferenceCounted
+{
+public:
+	enum DrawCallType : uint32_t
+	{
+		kLine,
+		kLines,
+		kPolygon,
+		kRect,
+		kArc,
+		kEllipse,
+		kPoint,
+		kBitmap,
+		kClearRect,
+		kGraphicsPath,
+		kLinearGradient,
+		kRadialGradient,
+		kString,
+
+		kNumDrawCallTypes
+	};
+
+	struct FrameRecord
+	{
+		uint64_t frameNumber {0};
+		/** microseconds since the profiler was created */
+		uint64_t startTime {0};
+		/** microseconds */
+		uint64_t duration {0};
+		/** the rect drawn */
+		CRect updateRect;
+		/** number of rects invalidated since the previous frame */
+		uint32_t numInvalidRects {0};
+		uint32_t numViewsDrawn {0};
+		uint64_t bitmapBytes {0};
+		std::array<uint32_t, kNumDrawCallTypes> drawCalls {};
+
+		uint32_t getNumDrawCalls () const;
+	};
+
+	struct ViewRecord
+	{
+		const std::type_info* viewClass {nullptr};
+		uint64_t frameNumber {0};
+		/** microseconds since the profiler was created */
+		uint64_t startTime {0};
+		/** microseconds including the children */
+		uint64_t duration {0};
+		/** microseconds without the children */
+		uint64_t selfDuration {0};
+		/** nesting level, the children of the frame have level 0 */
+		uint32_t depth {0};
+	};
+
+	struct ViewClassTime
+	{
+		std::string className;
+		/** microseconds without the children */
+		uint64_t selfTime {0};
+		uint32_t numDraws {0};
+	};
+
+	explicit DrawProfiler (uint32_t frameCapacity = 256, uint32_t viewCapacity = 16384);
+	~DrawProfiler () noexcept override;
+
+	/** the recorded frames, oldest first */
+	std::vector<FrameRecord> getFrames () const;
+	/** the recorded views, oldest first */
+	std::vector<ViewRecord> getViewRecords () const;
+	/** the self time of the recorded views summed up by class, most expensive first */
+	std::vector<ViewClassTime> getViewClassTimes () const;
+	/** write the recorded frames and views in the Chrome trace event format (chrome://tracing) */
+	void writeChromeTrace (std::ostream& stream) const;
+	std::string getChromeTrace () const;
+
+	static std::string getClassName (const std::type_info& type);
+
+	/// @name Recording, UI thread only
+	//-----------------------------------------------------------------------------
+	//@{
+	void beginFrame (const CRect& updateRect);
+	void endFrame ();
+	bool isInFrame () const { return inFrame; }
+
+	void beginView (const CView* view);
+	void endView ();
+
+	void onInvalidRect () { ++numInvalidRects; }
+	void onDrawCall (DrawCallType type) { ++currentFrame.drawCalls[type]; }
+	void onBitmapDraw (const CRect& dest, double scaleFactor);
+	//@}
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	/** single writer ring buffer, readers copy it and drop the entries overwritten meanwhile */
+	template<typename T>
+	class RingBuffer
+	{
+	public:
+		explicit RingBuffer (uint32_t capacity) : entries (std::max<uint32_t> (capacity, 2)) {}
+
+		void push (const T& entry)
+		{
+			auto index = writeIndex.load (std::memory_order_relaxed);
+			// announce the entry before it is overwritten, see copy ()
+			startIndex.store (index + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence (std::memory_order_release);
+			entries[index % entries.size ()] = entry;
+			writeIndex.store (index + 1, std::memory_order_release);
+		}
+
+		std::vector<T> copy () const
+		{
+			uint64_t capacity = entries.size ();
+			auto end = writeIndex.load (std::memory_order_acquire);
+			auto begin = end > capacity ? end - capacity : 0;
+			std::vector<T> result;
+			result.reserve (static_cast<size_t> (end - begin));
+			for (auto index = begin; index < end; ++index)
+				result.push_back (entries[index % capacity]);
+			std::atomic_thread_fence (std::memory_order_acquire);
+			// drop the entries the writer started to overwrite while they were copied
+			auto started = startIndex.load (std::memory_order_relaxed);
+			if (started != end)
+			{
+				auto firstValid = started > capacity ? started - capacity : 0;
+				if (firstValid > begin)
+					result.erase (result.begin (), result.begin () +
+					                                   static_cast<std::ptrdiff_t> (
+					                                       std::min (firstValid, end) - begin));
+			}
+			return result;
+		}
+
+	private:
+		std::vector<T> entries;
+		std::atomic<uint64_t> startIndex {0};
+		std::atomic<uint64_t> writeIndex {0};
+	};
+
+	struct ViewStackEntry
+	{
+		const std::type_info* viewClass;
+		Clock::time_point start;
+		Clock::duration childDuration;
+	};
+
+	uint64_t toMicroseconds (Clock::time_point time) const;
+
+	RingBuffer<FrameRecord> frames;
+	RingBuffer<ViewRecord> views;
+	std::vector<ViewStackEntry> viewStack;
+	FrameRecord currentFrame;
+	Clock::time_point epoch;
+	Clock::time_point frameStart;
+	uint64_t frameCounter {0};
+	uint32_t numInvalidRects {0};
+	bool inFrame {false};
+};
+
+//------------------------------------------------------------------------
+} // VSTGUI
@@ -9,8 +9,7 @@
 #if VSTGUI_ENABLE_DEPRECATED_METHODS
 
 #include "vstguidebug.h"
-#include <list>
-#include <set>
+#include <vector>
 #include <algorithm>
 #include <cassert>
 
@@ -55,12 +54,20 @@ protected:
 	static void rememberObject (CBaseObject* obj) { obj->remember (); }
 	static void forgetObject (CBaseObject* obj) { obj->forget (); }
 
-	using DeferedChangesSet = std::set<IdStringPtr>;
-	using DependentList = std::list<CBaseObject*>;
+	using DeferedChangesList = std::vector<IdStringPtr>;
+	/** removed dependents are set to nullptr while notifications are dispatched */
+	using DependentList = std::vector<CBaseObject*>;
 
 	int32_t deferChangeCount {0};
-	DeferedChangesSet deferedChanges;
+	DeferedChangesList deferedChanges;
 	DependentList dependents;
+
+private:
+	CBaseObject* getBaseObject ();
+
+	CBaseObject* baseObject {nullptr};
+	uint32_t dispatchDepth {0};
+	bool hasRemovedDependents {false};
 } VSTGUI_DEPRECATED_ATTRIBUTE;
 
 //----------------------------------------------------------------------------------------------------
@@ -72,7 +79,28 @@ inline void IDependency::addDependency (CBaseObject* obj)
 //----------------------------------------------------------------------------------------------------
 inline void IDependency::removeDependency (CBaseObject* obj)
 {
-	dependents.remove (obj);
+	if (dispatchDepth)
+	{
+		for (auto& dependent : dependents)
+		{
+			if (dependent == obj)
+			{
+				dependent = nullptr;
+				hasRemovedDependents = true;
+			}
+		}
+	}
+	else
+		dependents.erase (std::remove (dependents.begin (), dependents.end (), obj), dependents.end ());
+}
+
+//----------------------------------------------------------------------------------------------------
+inline CBaseObject* IDependency::getBaseObject ()
+{
+	// the dynamic_cast is not possible in the constructor, the object is not complete there
+	if (baseObject == nullptr)
+		baseObject = dynamic_cast<CBaseObject*> (this);
+	return baseObject;
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -80,16 +108,34 @@ inline void IDependency::changed (IdStringPtr message)
 {
 	if (deferChangeCount)
 	{
-		deferedChanges.emplace (message);
+		if (std::find (deferedChanges.begin (), deferedChanges.end (), message) == deferedChanges.end ())
+			deferedChanges.emplace_back (message);
 	}
 	else if (dependents.empty () == false)
 	{
-		CBaseObject* This = dynamic_cast<CBaseObject*> (this);
-		DependentList localList (dependents);
-		std::for_each (localList.begin (), localList.end (), rememberObject);
-		for (auto& obj : localList)
-			obj->notify (This, message);
-		std::for_each (localList.begin (), localList.end (), forgetObject);
+		CBaseObject* This = getBaseObject ();
+		// a dependent may release this object or itself while it is notified
+		if (This)
+			rememberObject (This);
+		// dependents added while dispatching are not notified, removed ones are skipped
+		auto numDependents = dependents.size ();
+		++dispatchDepth;
+		for (size_t i = 0; i < numDependents; ++i)
+		{
+			if (auto obj = dependents[i])
+			{
+				rememberObject (obj);
+				obj->notify (This, message);
+				forgetObject (obj);
+			}
+		}
+		if (--dispatchDepth == 0 && hasRemovedDependents)
+		{
+			dependents.erase (std::remove (dependents.begin (), dependents.end (), nullptr), dependents.end ());
+			hasRemovedDependents = false;
+		}
+		if (This)
+			forgetObject (This);
 	}
 }
 
@@ -102,9 +148,17 @@ inline void IDependency::deferChanges (bool state)
 	}
 	else if (--deferChangeCount == 0)
 	{
-		for (auto& msg : deferedChanges)
+		// changes deferred by the dependents while dispatching go into the then empty list
+		DeferedChangesList changes;
+		changes.swap (deferedChanges);
+		for (auto& msg : changes)
 			changed (msg);
-		deferedChanges.clear ();
+		// keep the capacity for the next time
+		if (deferedChanges.empty ())
+		{
+			changes.clear ();
+			deferedChanges.swap (changes);
+		}
 	}
 }
 
@@ -29,6 +29,9 @@ public:
 	Buffer (Buffer&& other) { *this = std::move (other); }
 	Buffer& operator= (Buffer&& other)
 	{
+		if (this == &other)
+			return *this;
+		deallocate ();
 		buffer = other.buffer;
 		count = other.count;
 		other.buffer = nullptr;
@@ -58,17 +58,29 @@ public:
 	{
 		if (maxWidth >= 0.)
 			return maxWidth;
-		auto context = COffscreenContext::create (frame, 1, 1);
 		maxWidth = 0.;
 		maxTitleWidth = 0.;
 		hasRightMargin = false;
+		SharedPointer<COffscreenContext> context;
 		for (auto& item : *menu->getItems ())
 		{
 			if (item->isSeparator ())
 				continue;
-			auto width = context->getStringWidth (item->getTitle ());
 			hasRightMargin |= item->getSubmenu () ? true : false;
 			hasRightMargin |= item->getIcon () ? true : false;
+			// the width is cached per font, only new titles or fonts are measured. The first open
+			// measures every title, an estimate from the longest titles may be too narrow
+			auto width = item->getCachedTitleWidth (theme.font);
+			if (width < 0.)
+			{
+				if (!context)
+				{
+					context = COffscreenContext::create (frame, 1, 1);
+					context->setFont (theme.font);
+				}
+				width = context->getStringWidth (item->getTitle ());
+				item->setCachedTitleWidth (theme.font, width);
+			}
 			if (maxTitleWidth < width)
 				maxTitleWidth = width;
 		}
@@ -86,6 +86,10 @@ private:
 	void onStateChanged ();
 	void onTextChange ();
 	void fillCharWidthCache ();
+	void updateCharWidthCache (size_t start, size_t end);
+	void insertIntoCharWidthCache (size_t pos, size_t num);
+	void removeFromCharWidthCache (size_t pos, size_t num);
+	void updateText (const UTF8String& txt);
 	void calcCursorSizes ();
 	CCoord getCharWidth (STB_CharT c, STB_CharT pc) const;
 
@@ -535,6 +539,12 @@ void STBTextEditView::onStateChanged ()
 void STBTextEditView::setText (const UTF8String& txt)
 {
 	charWidthCache.clear ();
+	updateText (txt);
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::updateText (const UTF8String& txt)
+{
 	CTextLabel::setText (txt);
 	if (editState.select_start != editState.select_end)
 		selectAll ();
@@ -582,18 +592,41 @@ void STBTextEditView::fillCharWidthCache ()
 {
 	if (!charWidthCache.empty ())
 		return;
-#if VSTGUI_STB_TEXTEDIT_USE_UNICODE
-	auto num = uString.size ();
-	charWidthCache.resize (num);
-	for (auto i = 0u; i < num; ++i)
-		charWidthCache[i] = getCharWidth (uString[i], i == 0 ? 0 : uString[i - 1]);
-#else
-	auto num = getText ().length ();
+	auto num = static_cast<size_t> (getLength (this));
 	charWidthCache.resize (num);
-	const auto& str = getText ().getString ();
-	for (auto i = 0u; i < num; ++i)
-		charWidthCache[i] = getCharWidth (str[i], i == 0 ? 0 : str[i - 1]);
-#endif
+	updateCharWidthCache (0, num);
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::updateCharWidthCache (size_t start, size_t end)
+{
+	end = std::min (end, charWidthCache.size ());
+	for (auto i = start; i < end; ++i)
+	{
+		auto pos = static_cast<int> (i);
+		charWidthCache[i] = getCharWidth (getChar (this, pos), i == 0 ? 0 : getChar (this, pos - 1));
+	}
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::insertIntoCharWidthCache (size_t pos, size_t num)
+{
+	// an empty cache is filled completely on the next use
+	if (charWidthCache.empty ())
+		return;
+	charWidthCache.insert (charWidthCache.begin () + pos, num, 0.);
+	// the character after the inserted ones is kerned against a new predecessor
+	updateCharWidthCache (pos, pos + num + 1);
+}
+
+//-----------------------------------------------------------------------------
+void STBTextEditView::removeFromCharWidthCache (size_t pos, size_t num)
+{
+	if (charWidthCache.empty ())
+		return;
+	auto first = charWidthCache.begin () + pos;
+	charWidthCache.erase (first, first + num);
+	updateCharWidthCache (pos, pos + 1);
 }
 
 //-----------------------------------------------------------------------------
@@ -693,13 +726,15 @@ int STBTextEditView::deleteChars (STBTextEditView* self, size_t pos, size_t num)
 {
 #if VSTGUI_STB_TEXTEDIT_USE_UNICODE
 	self->uString.erase (pos, num);
-	self->setText (StringConvert{}.to_bytes (self->uString));
+	self->removeFromCharWidthCache (pos, num);
+	self->updateText (StringConvert{}.to_bytes (self->uString));
 	self->onTextChange ();
 	return true;
 #else
 	auto str = self->text.getString ();
 	str.erase (pos, num);
-	self->setText (str.data ());
+	self->updateText (str.data ());
+	self->removeFromCharWidthCache (pos, num);
 	self->onTextChange ();
 	return true; // success
 #endif
@@ -713,13 +748,15 @@ int STBTextEditView::insertChars (STBTextEditView* self,
 {
 #if VSTGUI_STB_TEXTEDIT_USE_UNICODE
 	self->uString.insert (pos, text, num);
-	self->setText (StringConvert{}.to_bytes (self->uString));
+	self->insertIntoCharWidthCache (pos, num);
+	self->updateText (StringConvert{}.to_bytes (self->uString));
 	self->onTextChange ();
 	return true;
 #else
 	auto str = self->text.getString ();
 	str.insert (pos, text, num);
-	self->setText (str.data ());
+	self->updateText (str.data ());
+	self->insertIntoCharWidthCache (pos, num);
 	self->onTextChange ();
 	return true; // success
 #endif
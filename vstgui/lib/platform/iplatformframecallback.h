@@ -21,6 +21,7 @@ enum PlatformType {
 	kHWNDTopLevel,	// Windows HWDN Top Level (non child)
 	kX11EmbedWindowID,	// X11 XID
 	kGdkWindow, // GdkWindow
+	kHeadless,	// no parent, the frame draws into an offscreen surface (Linux only)
 
 	kDefaultNative = -1
 };
@@ -255,6 +255,7 @@ void Context::draw (CDrawStyle drawStyle)
 //-----------------------------------------------------------------------------
 void Context::drawLine (const CDrawContext::LinePair& line)
 {
+	profileDrawCall (DrawProfiler::kLine);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		setupCurrentStroke ();
@@ -279,6 +280,7 @@ void Context::drawLine (const CDrawContext::LinePair& line)
 //-----------------------------------------------------------------------------
 void Context::drawLines (const CDrawContext::LineList& lines)
 {
+	profileDrawCall (DrawProfiler::kLines);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		setupCurrentStroke ();
@@ -312,6 +314,7 @@ void Context::drawPolygon (const CDrawContext::PointList& polygonPointList,
 {
 	if (polygonPointList.size () < 2)
 		return;
+	profileDrawCall (DrawProfiler::kPolygon);
 
 	if (auto cd = DrawBlock::begin (*this))
 	{
@@ -327,6 +330,7 @@ void Context::drawPolygon (const CDrawContext::PointList& polygonPointList,
 //-----------------------------------------------------------------------------
 void Context::drawRect (const CRect& rect, const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kRect);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		CRect r (rect);
@@ -346,6 +350,7 @@ void Context::drawRect (const CRect& rect, const CDrawStyle drawStyle)
 void Context::drawArc (const CRect& rect, const float startAngle1, const float endAngle2,
 					   const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kArc);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		CPoint center = rect.getCenter ();
@@ -359,6 +364,7 @@ void Context::drawArc (const CRect& rect, const float startAngle1, const float e
 //-----------------------------------------------------------------------------
 void Context::drawEllipse (const CRect& rect, const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kEllipse);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		CPoint center = rect.getCenter ();
@@ -372,6 +378,7 @@ void Context::drawEllipse (const CRect& rect, const CDrawStyle drawStyle)
 //-----------------------------------------------------------------------------
 void Context::drawPoint (const CPoint& point, const CColor& color)
 {
+	profileDrawCall (DrawProfiler::kPoint);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		setSourceColor (color);
@@ -384,6 +391,7 @@ void Context::drawPoint (const CPoint& point, const CColor& color)
 //-----------------------------------------------------------------------------
 void Context::drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offset, float alpha)
 {
+	profileBitmapDraw (dest);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		double transformedScaleFactor = getScaleFactor();
@@ -426,6 +434,7 @@ void Context::drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoint& offs
 //-----------------------------------------------------------------------------
 void Context::clearRect (const CRect& rect)
 {
+	profileDrawCall (DrawProfiler::kClearRect);
 	if (auto cd = DrawBlock::begin (*this))
 	{
 		cairo_set_operator (cr, CAIRO_OPERATOR_CLEAR);
@@ -452,6 +461,7 @@ CGraphicsPath* Context::createTextPath (const CFontRef font, UTF8StringPtr text)
 void Context::drawGraphicsPath (CGraphicsPath* path, CDrawContext::PathDrawMode mode,
 								CGraphicsTransform* transformation)
 {
+	profileDrawCall (DrawProfiler::kGraphicsPath);
 	if (auto cairoPath = dynamic_cast<Path*> (path))
 	{
 		if (auto cd = DrawBlock::begin (*this))
@@ -501,6 +511,7 @@ void Context::fillLinearGradient (CGraphicsPath* path, const CGradient& gradient
 								  const CPoint& startPoint, const CPoint& endPoint, bool evenOdd,
 								  CGraphicsTransform* transformation)
 {
+	profileDrawCall (DrawProfiler::kLinearGradient);
 	if (auto cairoPath = dynamic_cast<Path*> (path))
 	{
 		if (auto cairoGradient = dynamic_cast<const Gradient*> (&gradient))
@@ -529,6 +540,7 @@ void Context::fillRadialGradient (CGraphicsPath* path, const CGradient& gradient
 								  const CPoint& center, CCoord radius, const CPoint& originOffset,
 								  bool evenOdd, CGraphicsTransform* transformation)
 {
+	profileDrawCall (DrawProfiler::kRadialGradient);
 #warning TODO: Implementation
 	auto cd = DrawBlock::begin (*this);
 	if (cd)
@@ -0,0 +1,443 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "headlessframe.h"
+#include "../../cframe.h"
+#include "../../cvstguitimer.h"
+#include "../../dragging.h"
+#include "../../vstkeycode.h"
+#include "../iplatformopenglview.h"
+#include "../iplatformviewlayer.h"
+#include "../iplatformtextedit.h"
+#include "../iplatformoptionmenu.h"
+#include "../common/generictextedit.h"
+#include "../common/genericoptionmenu.h"
+#include "cairocontext.h"
+#include "x11platform.h"
+#include <algorithm>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace X11 {
+
+//------------------------------------------------------------------------
+void ManualRunLoop::advance (uint64_t milliseconds)
+{
+	auto endTime = time + milliseconds;
+	while (true)
+	{
+		// timers may register or unregister timers while they are fired, so search every time
+		auto it = std::min_element (
+			timers.begin (), timers.end (),
+			[] (const TimerEntry& e1, const TimerEntry& e2) { return e1.nextFire < e2.nextFire; });
+		if (it == timers.end () || it->nextFire > endTime)
+			break;
+		time = std::max (time, it->nextFire);
+		it->nextFire += it->interval;
+		it->handler->onTimer ();
+	}
+	time = endTime;
+}
+
+//------------------------------------------------------------------------
+bool ManualRunLoop::registerTimer (uint64_t interval, ITimerHandler* handler)
+{
+	interval = std::max<uint64_t> (interval, 1);
+	timers.push_back ({handler, interval, time + interval});
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool ManualRunLoop::unregisterTimer (ITimerHandler* handler)
+{
+	auto it = std::find_if (timers.begin (), timers.end (),
+							[&] (const TimerEntry& e) { return e.handler == handler; });
+	if (it == timers.end ())
+		return false;
+	timers.erase (it);
+	return true;
+}
+
+//------------------------------------------------------------------------
+struct HeadlessFrame::Impl
+{
+	using RectList = std::vector<CRect>;
+
+	IPlatformFrameCallback* frame;
+	SharedPointer<ManualRunLoop> runLoop;
+	SharedPointer<Cairo::Bitmap> backBuffer;
+	SharedPointer<Cairo::Context> drawContext;
+	std::unique_ptr<GenericOptionMenuTheme> genericOptionMenuTheme;
+	SharedPointer<CVSTGUITimer> redrawTimer;
+	RectList dirtyRects;
+	CRect size;
+	double scaleFactor {1.};
+	CPoint mousePosition;
+	CButtonState mouseButtons;
+	int32_t lastKeyCharacter {0};
+
+	static uint32_t numInstances;
+
+	//------------------------------------------------------------------------
+	Impl (IPlatformFrameCallback* frame, const CRect& size, HeadlessFrameConfig* config)
+	: frame (frame), size (size)
+	{
+		if (config)
+		{
+			runLoop = config->runLoop;
+			scaleFactor = config->scaleFactor;
+		}
+		if (!runLoop)
+			runLoop = makeOwned<ManualRunLoop> ();
+		RunLoop::initHeadless (runLoop);
+		if (numInstances++ == 0)
+		{
+			// the timers follow the run loop installed by the first frame
+			auto clockRunLoop = runLoop;
+			CVSTGUITimer::setClock ([clockRunLoop] () { return clockRunLoop->getTime (); });
+		}
+		createBackBuffer ();
+	}
+
+	//------------------------------------------------------------------------
+	~Impl () noexcept
+	{
+		redrawTimer = nullptr;
+		if (--numInstances == 0)
+			CVSTGUITimer::setClock (nullptr);
+		RunLoop::exit ();
+	}
+
+	//------------------------------------------------------------------------
+	void createBackBuffer ()
+	{
+		CPoint bufferSize (size.getWidth () * scaleFactor, size.getHeight () * scaleFactor);
+		backBuffer = makeOwned<Cairo::Bitmap> (&bufferSize);
+		backBuffer->setScaleFactor (scaleFactor);
+		drawContext = makeOwned<Cairo::Context> (backBuffer);
+		if (!drawContext->valid ())
+			drawContext = nullptr;
+		dirtyRects.clear ();
+		dirtyRects.emplace_back (CRect (0, 0, size.getWidth (), size.getHeight ()));
+	}
+
+	//------------------------------------------------------------------------
+	uint32_t render ()
+	{
+		if (dirtyRects.empty () || !drawContext)
+			return 0;
+		// the frame may invalidate while drawing, these rects are drawn with the next render
+		RectList rects;
+		rects.swap (dirtyRects);
+		drawContext->beginDraw ();
+		for (const auto& rect : rects)
+		{
+			drawContext->setClipRect (rect);
+			drawContext->saveGlobalState ();
+			frame->platformDrawRect (drawContext, rect);
+			drawContext->restoreGlobalState ();
+		}
+		drawContext->endDraw ();
+		auto numRects = static_cast<uint32_t> (rects.size ());
+		// keep the capacity for the next time
+		if (dirtyRects.empty ())
+		{
+			rects.clear ();
+			dirtyRects.swap (rects);
+		}
+		return numRects;
+	}
+
+	//------------------------------------------------------------------------
+	void invalidRect (const CRect& rect)
+	{
+		dirtyRects.emplace_back (rect);
+		if (redrawTimer)
+			return;
+		redrawTimer = makeOwned<CVSTGUITimer> (
+			[this] (CVSTGUITimer*) {
+				if (dirtyRects.empty ())
+				{
+					redrawTimer = nullptr;
+					return;
+				}
+				render ();
+			},
+			16);
+	}
+};
+uint32_t HeadlessFrame::Impl::numInstances = 0;
+
+//------------------------------------------------------------------------
+HeadlessFrame::HeadlessFrame (IPlatformFrameCallback* frame,
+							  const CRect& size,
+							  IPlatformFrameConfig* config)
+	: IPlatformFrame (frame)
+{
+	impl = std::unique_ptr<Impl> (
+		new Impl (frame, size, dynamic_cast<HeadlessFrameConfig*> (config)));
+	if (impl->scaleFactor != 1.)
+		frame->platformScaleFactorChanged (impl->scaleFactor);
+	frame->platformOnActivate (true);
+}
+
+//------------------------------------------------------------------------
+HeadlessFrame::~HeadlessFrame () noexcept = default;
+
+//------------------------------------------------------------------------
+uint32_t HeadlessFrame::render ()
+{
+	return impl->render ();
+}
+
+//------------------------------------------------------------------------
+const SharedPointer<Cairo::Bitmap>& HeadlessFrame::getBackBuffer () const
+{
+	return impl->backBuffer;
+}
+
+//------------------------------------------------------------------------
+ManualRunLoop& HeadlessFrame::getRunLoop () const
+{
+	return *impl->runLoop;
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::injectMouseDown (CPoint where, CButtonState buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = buttons;
+	return frame->platformOnMouseDown (where, buttons);
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::injectMouseMoved (CPoint where, CButtonState buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = buttons;
+	return frame->platformOnMouseMoved (where, buttons);
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::injectMouseUp (CPoint where, CButtonState buttons)
+{
+	impl->mousePosition = where;
+	impl->mouseButtons = 0;
+	return frame->platformOnMouseUp (where, buttons);
+}
+
+//------------------------------------------------------------------------
+CMouseEventResult HeadlessFrame::injectMouseExited (CPoint where, CButtonState buttons)
+{
+	impl->mousePosition = where;
+	return frame->platformOnMouseExited (where, buttons);
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::injectMouseWheel (CPoint where, CMouseWheelAxis axis, float distance,
+									  CButtonState buttons)
+{
+	impl->mousePosition = where;
+	return frame->platformOnMouseWheel (where, axis, distance, buttons);
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::injectKeyDown (VstKeyCode keyCode)
+{
+	impl->lastKeyCharacter = keyCode.character;
+	auto result = frame->platformOnKeyDown (keyCode);
+	impl->lastKeyCharacter = 0;
+	return result;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::injectKeyUp (VstKeyCode keyCode)
+{
+	impl->lastKeyCharacter = keyCode.character;
+	auto result = frame->platformOnKeyUp (keyCode);
+	impl->lastKeyCharacter = 0;
+	return result;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getGlobalPosition (CPoint& pos) const
+{
+	pos = impl->size.getTopLeft ();
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::setSize (const CRect& newSize)
+{
+	if (newSize.getSize () == impl->size.getSize ())
+	{
+		impl->size = newSize;
+		return true;
+	}
+	impl->size = newSize;
+	impl->createBackBuffer ();
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getSize (CRect& size) const
+{
+	size = impl->size;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getCurrentMousePosition (CPoint& mousePosition) const
+{
+	mousePosition = impl->mousePosition;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::getCurrentMouseButtons (CButtonState& buttons) const
+{
+	buttons = impl->mouseButtons;
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::setMouseCursor (CCursorType type)
+{
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::invalidRect (const CRect& rect)
+{
+	impl->invalidRect (rect);
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::scrollRect (const CRect& src, const CPoint& distance)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::showTooltip (const CRect& rect, const char* utf8Text)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::hideTooltip ()
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+void* HeadlessFrame::getPlatformRepresentation () const
+{
+	return nullptr;
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformTextEdit> HeadlessFrame::createPlatformTextEdit (
+	IPlatformTextEditCallback* textEdit)
+{
+	return makeOwned<GenericTextEdit> (textEdit);
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformOptionMenu> HeadlessFrame::createPlatformOptionMenu ()
+{
+	auto cFrame = dynamic_cast<CFrame*> (frame);
+	GenericOptionMenuTheme theme;
+	if (impl->genericOptionMenuTheme)
+		theme = *impl->genericOptionMenuTheme.get ();
+	return makeOwned<GenericOptionMenu> (cFrame, 0, theme);
+}
+
+#if VSTGUI_OPENGL_SUPPORT
+//------------------------------------------------------------------------
+SharedPointer<IPlatformOpenGLView> HeadlessFrame::createPlatformOpenGLView ()
+{
+	return nullptr;
+}
+#endif
+
+//------------------------------------------------------------------------
+SharedPointer<IPlatformViewLayer> HeadlessFrame::createPlatformViewLayer (
+	IPlatformViewLayerDelegate* drawDelegate, IPlatformViewLayer* parentLayer)
+{
+	return nullptr;
+}
+
+//------------------------------------------------------------------------
+SharedPointer<COffscreenContext> HeadlessFrame::createOffscreenContext (CCoord width,
+																		CCoord height,
+																		double scaleFactor)
+{
+	CPoint size (width * scaleFactor, height * scaleFactor);
+	auto bitmap = new Cairo::Bitmap (&size);
+	bitmap->setScaleFactor (scaleFactor);
+	auto context = owned (new Cairo::Context (bitmap));
+	bitmap->forget ();
+	if (context->valid ())
+		return context;
+	return nullptr;
+}
+
+#if VSTGUI_ENABLE_DEPRECATED_METHODS
+//------------------------------------------------------------------------
+DragResult HeadlessFrame::doDrag (IDataPackage* source, const CPoint& offset, CBitmap* dragBitmap)
+{
+	return kDragError;
+}
+#endif
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::doDrag (const DragDescription& dragDescription,
+							const SharedPointer<IDragCallback>& callback)
+{
+	return false;
+}
+
+//------------------------------------------------------------------------
+void HeadlessFrame::setClipboard (const SharedPointer<IDataPackage>& data)
+{
+}
+
+//------------------------------------------------------------------------
+SharedPointer<IDataPackage> HeadlessFrame::getClipboard ()
+{
+	return nullptr;
+}
+
+//------------------------------------------------------------------------
+PlatformType HeadlessFrame::getPlatformType () const
+{
+	return kHeadless;
+}
+
+//------------------------------------------------------------------------
+Optional<UTF8String> HeadlessFrame::convertCurrentKeyEventToText ()
+{
+	// injected key codes only carry ASCII characters
+	if (impl->lastKeyCharacter <= 0 || impl->lastKeyCharacter > 0x7F)
+		return {};
+	return Optional<UTF8String> (
+		UTF8String (std::string (1, static_cast<char> (impl->lastKeyCharacter))));
+}
+
+//------------------------------------------------------------------------
+bool HeadlessFrame::setupGenericOptionMenu (bool use, GenericOptionMenuTheme* theme)
+{
+	if (theme)
+		impl->genericOptionMenuTheme =
+			std::unique_ptr<GenericOptionMenuTheme> (new GenericOptionMenuTheme (*theme));
+	else
+		impl->genericOptionMenuTheme = nullptr;
+	return true;
+}
+
+//------------------------------------------------------------------------
+} // X11
+} // VSTGUI
@@ -0,0 +1,129 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+#pragma once
+
+#include "../../cbuttonstate.h"
+#include "../../crect.h"
+#include "../iplatformframe.h"
+#include "../platform_x11.h"
+#include "cairobitmap.h"
+#include <memory>
+#include <vector>
+
+struct VstKeyCode;
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace X11 {
+
+//------------------------------------------------------------------------
+/** A run loop which never waits. Its time only advances with advance () which fires the due
+ *	timers in deadline order, so timer driven code runs deterministically.
+ */
+class ManualRunLoop
+	: public IRunLoop
+	, public AtomicReferenceCounted
+{
+public:
+	/** current time in milliseconds */
+	uint64_t getTime () const { return time; }
+	/** advance the time by milliseconds and fire all timers which get due */
+	void advance (uint64_t milliseconds);
+
+	bool registerEventHandler (int fd, IEventHandler* handler) override { return false; }
+	bool unregisterEventHandler (IEventHandler* handler) override { return false; }
+	bool registerTimer (uint64_t interval, ITimerHandler* handler) override;
+	bool unregisterTimer (ITimerHandler* handler) override;
+
+private:
+	struct TimerEntry
+	{
+		ITimerHandler* handler;
+		uint64_t interval;
+		uint64_t nextFire;
+	};
+	std::vector<TimerEntry> timers;
+	uint64_t time {0};
+};
+
+//------------------------------------------------------------------------
+class HeadlessFrameConfig : public IPlatformFrameConfig
+{
+public:
+	/** the run loop driving the timers, one is created if not set */
+	SharedPointer<ManualRunLoop> runLoop;
+	double scaleFactor {1.};
+};
+
+//------------------------------------------------------------------------
+/** A frame without window which draws into a cairo image surface
+ *
+ *	Create it by opening a CFrame with PlatformType::kHeadless. While a headless frame exists the
+ *	CVSTGUITimers run on the clock of its ManualRunLoop, so it can not be mixed with X11 frames.
+ *	Invalidated rects are drawn when the redraw timer fires or when render () is called.
+ */
+class HeadlessFrame : public IPlatformFrame
+{
+public:
+	HeadlessFrame (IPlatformFrameCallback* frame, const CRect& size, IPlatformFrameConfig* config);
+	~HeadlessFrame () noexcept;
+
+	/** draw the invalidated rects, returns the number of drawn rects */
+	uint32_t render ();
+	/** the back buffer of the frame, its size is the frame size multiplied with the scale factor */
+	const SharedPointer<Cairo::Bitmap>& getBackBuffer () const;
+	ManualRunLoop& getRunLoop () const;
+
+	CMouseEventResult injectMouseDown (CPoint where, CButtonState buttons);
+	CMouseEventResult injectMouseMoved (CPoint where, CButtonState buttons);
+	CMouseEventResult injectMouseUp (CPoint where, CButtonState buttons);
+	CMouseEventResult injectMouseExited (CPoint where, CButtonState buttons);
+	bool injectMouseWheel (CPoint where, CMouseWheelAxis axis, float distance,
+						   CButtonState buttons);
+	bool injectKeyDown (VstKeyCode keyCode);
+	bool injectKeyUp (VstKeyCode keyCode);
+
+	bool getGlobalPosition (CPoint& pos) const override;
+	bool setSize (const CRect& newSize) override;
+	bool getSize (CRect& size) const override;
+	bool getCurrentMousePosition (CPoint& mousePosition) const override;
+	bool getCurrentMouseButtons (CButtonState& buttons) const override;
+	bool setMouseCursor (CCursorType type) override;
+	bool invalidRect (const CRect& rect) override;
+	bool scrollRect (const CRect& src, const CPoint& distance) override;
+	bool showTooltip (const CRect& rect, const char* utf8Text) override;
+	bool hideTooltip () override;
+	void* getPlatformRepresentation () const override;
+	SharedPointer<IPlatformTextEdit>
+	createPlatformTextEdit (IPlatformTextEditCallback* textEdit) override;
+	SharedPointer<IPlatformOptionMenu> createPlatformOptionMenu () override;
+#if VSTGUI_OPENGL_SUPPORT
+	SharedPointer<IPlatformOpenGLView> createPlatformOpenGLView () override;
+#endif
+	SharedPointer<IPlatformViewLayer> createPlatformViewLayer (
+		IPlatformViewLayerDelegate* drawDelegate, IPlatformViewLayer* parentLayer) override;
+	SharedPointer<COffscreenContext> createOffscreenContext (CCoord width,
+															 CCoord height,
+															 double scaleFactor) override;
+#if VSTGUI_ENABLE_DEPRECATED_METHODS
+	DragResult doDrag (IDataPackage* source, const CPoint& offset, CBitmap* dragBitmap) override;
+#endif
+	bool doDrag (const DragDescription& dragDescription,
+				 const SharedPointer<IDragCallback>& callback) override;
+	void setClipboard (const SharedPointer<IDataPackage>& data) override;
+	SharedPointer<IDataPackage> getClipboard () override;
+
+	PlatformType getPlatformType () const override;
+	void onFrameClosed () override {}
+	Optional<UTF8String> convertCurrentKeyEventToText () override;
+	bool setupGenericOptionMenu (bool use, GenericOptionMenuTheme* theme = nullptr) override;
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> impl;
+};
+
+//------------------------------------------------------------------------
+} // X11
+} // VSTGUI
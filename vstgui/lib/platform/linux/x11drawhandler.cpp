@@ -0,0 +1,371 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "x11drawhandler.h"
+#include "cairocontext.h"
+#include "x11platform.h"
+#include "x11utils.h"
+#include <algorithm>
+#include <cmath>
+#include <xcb/xcb.h>
+#include <xcb/shm.h>
+#include <cairo/cairo-xcb.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace X11 {
+namespace {
+
+//------------------------------------------------------------------------
+bool isSharedMemoryAvailable (xcb_connection_t* xcb)
+{
+	auto extension = xcb_get_extension_data (xcb, &xcb_shm_id);
+	if (!extension || !extension->present)
+		return false;
+	auto cookie = xcb_shm_query_version (xcb);
+	if (auto reply = xcb_shm_query_version_reply (xcb, cookie, nullptr))
+	{
+		free (reply);
+		return true;
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------
+uint8_t getWindowDepth (xcb_connection_t* xcb, xcb_window_t window)
+{
+	uint8_t depth = 0;
+	auto cookie = xcb_get_geometry (xcb, window);
+	if (auto reply = xcb_get_geometry_reply (xcb, cookie, nullptr))
+	{
+		depth = reply->depth;
+		free (reply);
+	}
+	return depth;
+}
+
+//------------------------------------------------------------------------
+/** returns the cairo image format matching the pixel layout of the window or CAIRO_FORMAT_INVALID
+ *	if there is none */
+cairo_format_t getImageFormat (xcb_connection_t* xcb, const xcb_visualtype_t* visual, uint8_t depth)
+{
+	if (!visual || visual->_class != XCB_VISUAL_CLASS_TRUE_COLOR || visual->red_mask != 0xff0000 ||
+		visual->green_mask != 0x00ff00 || visual->blue_mask != 0x0000ff)
+		return CAIRO_FORMAT_INVALID;
+	auto setup = xcb_get_setup (xcb);
+	// cairo image surfaces use native endian 32 bit pixels
+	const uint32_t one = 1;
+	auto nativeByteOrder = *reinterpret_cast<const uint8_t*> (&one) == 1 ?
+							   XCB_IMAGE_ORDER_LSB_FIRST :
+							   XCB_IMAGE_ORDER_MSB_FIRST;
+	if (setup->image_byte_order != nativeByteOrder)
+		return CAIRO_FORMAT_INVALID;
+	auto formatIter = xcb_setup_pixmap_formats_iterator (setup);
+	for (; formatIter.rem; xcb_format_next (&formatIter))
+	{
+		if (formatIter.data->depth != depth)
+			continue;
+		if (formatIter.data->bits_per_pixel != 32)
+			return CAIRO_FORMAT_INVALID;
+		if (depth == 24)
+			return CAIRO_FORMAT_RGB24;
+		if (depth == 32)
+			return CAIRO_FORMAT_ARGB32;
+		break;
+	}
+	return CAIRO_FORMAT_INVALID;
+}
+
+//------------------------------------------------------------------------
+struct SharedMemoryImage
+{
+	SharedMemoryImage (xcb_connection_t* xcb) : xcb (xcb) {}
+	~SharedMemoryImage () noexcept { release (); }
+
+	bool allocate (cairo_format_t format, int width, int height)
+	{
+		release ();
+		stride = cairo_format_stride_for_width (format, width);
+		if (stride <= 0 || width <= 0 || height <= 0)
+			return false;
+		auto shmId = shmget (IPC_PRIVATE, static_cast<size_t> (stride) * height, IPC_CREAT | 0600);
+		if (shmId == -1)
+			return false;
+		auto ptr = shmat (shmId, nullptr, 0);
+		if (ptr == reinterpret_cast<void*> (-1))
+		{
+			shmctl (shmId, IPC_RMID, nullptr);
+			return false;
+		}
+		segment = xcb_generate_id (xcb);
+		auto cookie = xcb_shm_attach_checked (xcb, segment, shmId, 0);
+		auto error = xcb_request_check (xcb, cookie);
+		// the segment is destroyed as soon as the last process (including the X server) detached
+		shmctl (shmId, IPC_RMID, nullptr);
+		if (error)
+		{
+			free (error);
+			shmdt (ptr);
+			segment = 0;
+			return false;
+		}
+		data = static_cast<uint8_t*> (ptr);
+		surface.assign (cairo_image_surface_create_for_data (data, format, width, height, stride));
+		if (cairo_surface_status (surface) != CAIRO_STATUS_SUCCESS)
+		{
+			release ();
+			return false;
+		}
+		size = CPoint (width, height);
+		return true;
+	}
+
+	void release ()
+	{
+		if (!data)
+			return;
+		waitForPendingPut ();
+		surface.reset ();
+		xcb_shm_detach (xcb, segment);
+		// make sure the X server detached before we unmap the memory
+		free (xcb_get_input_focus_reply (xcb, xcb_get_input_focus (xcb), nullptr));
+		shmdt (data);
+		data = nullptr;
+		segment = 0;
+	}
+
+	void put (xcb_drawable_t drawable, xcb_gcontext_t gc, uint8_t depth, const CRect& rect)
+	{
+		auto left = static_cast<int> (std::max (0., std::floor (rect.left)));
+		auto top = static_cast<int> (std::max (0., std::floor (rect.top)));
+		auto right = static_cast<int> (std::min (size.x, std::ceil (rect.right)));
+		auto bottom = static_cast<int> (std::min (size.y, std::ceil (rect.bottom)));
+		if (right <= left || bottom <= top)
+			return;
+		xcb_shm_put_image (xcb, drawable, gc, static_cast<uint16_t> (size.x),
+						   static_cast<uint16_t> (size.y), left, top, right - left, bottom - top,
+						   left, top, depth, XCB_IMAGE_FORMAT_Z_PIXMAP, 0, segment, 0);
+		putPending = true;
+	}
+
+	void finishPuts ()
+	{
+		if (!putPending)
+			return;
+		// the reply to this request arrives after the X server processed the puts before it, so
+		// waiting for it before the next draw does not stall the pipeline in the common case
+		syncCookie = xcb_get_input_focus (xcb);
+		syncPending = true;
+		putPending = false;
+	}
+
+	void waitForPendingPut ()
+	{
+		finishPuts ();
+		if (!syncPending)
+			return;
+		free (xcb_get_input_focus_reply (xcb, syncCookie, nullptr));
+		syncPending = false;
+	}
+
+	xcb_connection_t* xcb;
+	Cairo::SurfaceHandle surface;
+	uint8_t* data {nullptr};
+	int stride {0};
+	CPoint size;
+	xcb_shm_seg_t segment {0};
+	xcb_get_input_focus_cookie_t syncCookie {};
+	bool putPending {false};
+	bool syncPending {false};
+};
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+struct DrawHandler::Impl
+{
+	const ChildWindow& window;
+	xcb_connection_t* xcb {RunLoop::instance ().getXcbConnection ()};
+	BackBufferMode mode {BackBufferMode::XServer};
+	cairo_device_t* device {nullptr};
+	Cairo::SurfaceHandle windowSurface;
+	Cairo::SurfaceHandle backBuffer;
+	SharedPointer<Cairo::Context> drawContext;
+
+	std::unique_ptr<SharedMemoryImage> shmImage;
+	cairo_format_t shmFormat {CAIRO_FORMAT_INVALID};
+	xcb_gcontext_t gc {0};
+	uint8_t depth {0};
+
+	Impl (const ChildWindow& window, BackBufferMode requestedMode) : window (window)
+	{
+		if (requestedMode == BackBufferMode::SharedMemory)
+			setupSharedMemory ();
+		if (mode == BackBufferMode::XServer)
+			setupWindowSurface ();
+	}
+
+	~Impl () noexcept
+	{
+		drawContext = nullptr;
+		if (shmImage)
+		{
+			shmImage = nullptr;
+			xcb_free_gc (xcb, gc);
+			xcb_flush (xcb);
+		}
+		if (device)
+		{
+			backBuffer.reset ();
+			windowSurface.reset ();
+			cairo_device_finish (device);
+			cairo_device_destroy (device);
+		}
+	}
+
+	void setupSharedMemory ()
+	{
+		if (!isSharedMemoryAvailable (xcb))
+			return;
+		depth = getWindowDepth (xcb, window.getID ());
+		shmFormat = getImageFormat (xcb, window.getVisual (), depth);
+		if (shmFormat == CAIRO_FORMAT_INVALID)
+			return;
+		shmImage = std::unique_ptr<SharedMemoryImage> (new SharedMemoryImage (xcb));
+		if (!shmImage->allocate (shmFormat, window.getSize ().x, window.getSize ().y))
+		{
+			shmImage = nullptr;
+			return;
+		}
+		gc = xcb_generate_id (xcb);
+		uint32_t values[] = {0};
+		xcb_create_gc (xcb, gc, window.getID (), XCB_GC_GRAPHICS_EXPOSURES, values);
+		mode = BackBufferMode::SharedMemory;
+		createDrawContext (shmImage->surface, window.getSize ());
+	}
+
+	void setupWindowSurface ()
+	{
+		auto s = cairo_xcb_surface_create (xcb, window.getID (), window.getVisual (),
+										   window.getSize ().x, window.getSize ().y);
+		windowSurface.assign (s);
+		device = cairo_device_reference (cairo_surface_get_device (s));
+		onSizeChanged (window.getSize ());
+	}
+
+	void fallbackToWindowSurface ()
+	{
+		drawContext = nullptr;
+		shmImage = nullptr;
+		xcb_free_gc (xcb, gc);
+		gc = 0;
+		mode = BackBufferMode::XServer;
+		setupWindowSurface ();
+	}
+
+	void createDrawContext (const Cairo::SurfaceHandle& surface, const CPoint& size)
+	{
+		CRect r;
+		r.setSize (size);
+		drawContext = makeOwned<Cairo::Context> (r, surface);
+	}
+
+	void onSizeChanged (const CPoint& size)
+	{
+		if (mode == BackBufferMode::SharedMemory)
+		{
+			drawContext = nullptr;
+			if (!shmImage->allocate (shmFormat, size.x, size.y))
+			{
+				fallbackToWindowSurface ();
+				return;
+			}
+			createDrawContext (shmImage->surface, size);
+			return;
+		}
+		cairo_xcb_surface_set_size (windowSurface, size.x, size.y);
+		backBuffer = Cairo::SurfaceHandle (
+			cairo_surface_create_similar (windowSurface, CAIRO_CONTENT_COLOR_ALPHA, size.x, size.y));
+		createDrawContext (backBuffer, size);
+	}
+
+	void draw (const RectList& dirtyRects, const DrawProc& proc)
+	{
+		// the X server may still read the image of the last draw
+		if (shmImage)
+			shmImage->waitForPendingPut ();
+		CRect copyRect;
+		drawContext->beginDraw ();
+		for (auto rect : dirtyRects)
+		{
+			drawContext->setClipRect (rect);
+			drawContext->saveGlobalState ();
+			proc (drawContext, rect);
+			drawContext->restoreGlobalState ();
+			if (copyRect.isEmpty ())
+				copyRect = rect;
+			else
+				copyRect.unite (rect);
+		}
+		drawContext->endDraw ();
+		if (mode == BackBufferMode::SharedMemory)
+			putDirtyRects (dirtyRects);
+		else
+			blitBackbufferToWindow (copyRect);
+		xcb_flush (xcb);
+	}
+
+	void putDirtyRects (const RectList& dirtyRects)
+	{
+		cairo_surface_flush (shmImage->surface);
+		for (const auto& rect : dirtyRects)
+			shmImage->put (window.getID (), gc, depth, rect);
+		shmImage->finishPuts ();
+	}
+
+	void blitBackbufferToWindow (const CRect& rect)
+	{
+		Cairo::ContextHandle windowContext (cairo_create (windowSurface));
+		cairo_rectangle (windowContext, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
+		cairo_clip (windowContext);
+		cairo_set_source_surface (windowContext, backBuffer, 0, 0);
+		cairo_rectangle (windowContext, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
+		cairo_fill (windowContext);
+		cairo_surface_flush (windowSurface);
+	}
+};
+
+//------------------------------------------------------------------------
+DrawHandler::DrawHandler (const ChildWindow& window, BackBufferMode mode)
+{
+	impl = std::unique_ptr<Impl> (new Impl (window, mode));
+}
+
+//------------------------------------------------------------------------
+DrawHandler::~DrawHandler () noexcept = default;
+
+//------------------------------------------------------------------------
+void DrawHandler::onSizeChanged (const CPoint& size)
+{
+	impl->onSizeChanged (size);
+}
+
+//------------------------------------------------------------------------
+void DrawHandler::draw (const RectList& dirtyRects, const DrawProc& proc)
+{
+	impl->draw (dirtyRects, proc);
+}
+
+//------------------------------------------------------------------------
+BackBufferMode DrawHandler::getMode () const
+{
+	return impl->mode;
+}
+
+//------------------------------------------------------------------------
+} // X11
+} // VSTGUI
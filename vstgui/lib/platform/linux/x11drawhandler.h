@@ -0,0 +1,52 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "../../crect.h"
+#include "x11frame.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+class CDrawContext;
+
+namespace X11 {
+
+struct ChildWindow;
+
+//------------------------------------------------------------------------
+/** Draws into a back buffer and copies the dirty parts of it to a child window
+ *
+ *	In BackBufferMode::XServer the back buffer is a surface on the X server and all drawing is
+ *	sent via the RENDER extension. In BackBufferMode::SharedMemory cairo renders into a client
+ *	side image living in a MIT-SHM segment and only the dirty rects are transferred to the window.
+ *	If the X server does not support MIT-SHM (e.g. remote displays) the draw handler falls back to
+ *	BackBufferMode::XServer.
+ */
+class DrawHandler
+{
+public:
+	using RectList = std::vector<CRect>;
+	using DrawProc = std::function<void (CDrawContext* context, const CRect& rect)>;
+
+	DrawHandler (const ChildWindow& window, BackBufferMode mode = BackBufferMode::XServer);
+	~DrawHandler () noexcept;
+
+	void onSizeChanged (const CPoint& size);
+	void draw (const RectList& dirtyRects, const DrawProc& proc);
+
+	/** the mode in use, may differ from the requested mode if shared memory is unavailable */
+	BackBufferMode getMode () const;
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> impl;
+};
+
+//------------------------------------------------------------------------
+} // X11
+} // VSTGUI
@@ -5,6 +5,7 @@
 #include "x11frame.h"
 #include "../../cbuttonstate.h"
 #include "../../cframe.h"
+#include "../../cvstguitimer.h"
 #include "../../crect.h"
 #include "../../dragging.h"
 #include "../../vstkeycode.h"
@@ -17,6 +18,8 @@
 #include "../common/genericoptionmenu.h"
 #include "cairobitmap.h"
 #include "cairocontext.h"
+#include "headlessframe.h"
+#include "x11drawhandler.h"
 #include "x11platform.h"
 #include "x11utils.h"
 #include <cassert>
@@ -95,97 +98,6 @@ inline uint32_t translateModifiers (int state)
 //------------------------------------------------------------------------
 } // anonymous
 
-//------------------------------------------------------------------------
-struct RedrawTimerHandler
-	: ITimerHandler
-	, NonAtomicReferenceCounted
-{
-	using RedrawCallback = std::function<void()>;
-
-	RedrawTimerHandler (uint64_t delay, RedrawCallback&& redrawCallback)
-		: redrawCallback (std::move (redrawCallback))
-	{
-		RunLoop::instance ().get ()->registerTimer (delay, this);
-	}
-	~RedrawTimerHandler () noexcept { RunLoop::instance ().get ()->unregisterTimer (this); }
-
-	void onTimer () override
-	{
-		SharedPointer<RedrawTimerHandler> Self (this);
-		Self->redrawCallback ();
-	}
-
-	RedrawCallback redrawCallback;
-};
-
-//------------------------------------------------------------------------
-struct DrawHandler
-{
-	DrawHandler (const ChildWindow& window)
-	{
-		auto s = cairo_xcb_surface_create (RunLoop::instance ().getXcbConnection (),
-										   window.getID (), window.getVisual (),
-										   window.getSize ().x, window.getSize ().y);
-		windowSurface.assign (s);
-		onSizeChanged (window.getSize ());
-		device = cairo_device_reference(cairo_surface_get_device(s));
-	}
-
-	~DrawHandler()
-	{
-		cairo_device_finish(device);
-		cairo_device_destroy(device);
-	}
-
-	void onSizeChanged (const CPoint& size)
-	{
-		cairo_xcb_surface_set_size (windowSurface, size.x, size.y);
-		backBuffer = Cairo::SurfaceHandle (cairo_surface_create_similar (
-			windowSurface, CAIRO_CONTENT_COLOR_ALPHA, size.x, size.y));
-		CRect r;
-		r.setSize (size);
-		drawContext = makeOwned<Cairo::Context> (r, backBuffer);
-	}
-
-	template<typename RectList, typename Proc>
-	void draw (const RectList& dirtyRects, Proc proc)
-	{
-		CRect copyRect;
-		drawContext->beginDraw ();
-		for (auto rect : dirtyRects)
-		{
-			drawContext->setClipRect (rect);
-			drawContext->saveGlobalState ();
-			proc (drawContext, rect);
-			drawContext->restoreGlobalState ();
-			if (copyRect.isEmpty ())
-				copyRect = rect;
-			else
-				copyRect.unite (rect);
-		}
-		drawContext->endDraw ();
-		blitBackbufferToWindow (copyRect);
-		xcb_flush (RunLoop::instance ().getXcbConnection ());
-	}
-
-private:
-	cairo_device_t *device = nullptr;
-	Cairo::SurfaceHandle windowSurface;
-	Cairo::SurfaceHandle backBuffer;
-	SharedPointer<Cairo::Context> drawContext;
-
-	void blitBackbufferToWindow (const CRect& rect)
-	{
-		Cairo::ContextHandle windowContext (cairo_create (windowSurface));
-		cairo_rectangle (windowContext, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
-		cairo_clip (windowContext);
-		cairo_set_source_surface (windowContext, backBuffer, 0, 0);
-		cairo_rectangle (windowContext, rect.left, rect.top, rect.getWidth (), rect.getHeight ());
-		cairo_fill (windowContext);
-		cairo_surface_flush (windowSurface);
-	}
-};
-
 //------------------------------------------------------------------------
 struct DoubleClickDetector
 {
@@ -267,14 +179,16 @@ struct Frame::Impl : IFrameEventHandler
 	DoubleClickDetector doubleClickDetector;
 	IPlatformFrameCallback* frame;
 	std::unique_ptr<GenericOptionMenuTheme> genericOptionMenuTheme;
-	SharedPointer<RedrawTimerHandler> redrawTimer;
+	SharedPointer<CVSTGUITimer> redrawTimer;
 	RectList dirtyRects;
 	CCursorType currentCursor{kCursorDefault};
 	uint32_t pointerGrabed{0};
+	uint64_t inputEventReceiveTime{0};
+	uint64_t unpaintedInputEventReceiveTime{0};
 
 	//------------------------------------------------------------------------
 	Impl (::Window parent, CPoint size, IPlatformFrameCallback* frame)
-		: window (parent, size), drawHandler (window), frame (frame)
+		: window (parent, size), drawHandler (window, Frame::backBufferMode), frame (frame)
 	{
 		RunLoop::instance ().registerWindowEventHandler (window.getID (), this);
 	}
@@ -318,19 +232,32 @@ struct Frame::Impl : IFrameEventHandler
 			frame->platformDrawRect (context, rect);
 		});
 		dirtyRects.clear ();
+		if (unpaintedInputEventReceiveTime)
+		{
+			RunLoop::instance ().onInputEventPainted (unpaintedInputEventReceiveTime);
+			unpaintedInputEventReceiveTime = 0;
+		}
 	}
 
 	//------------------------------------------------------------------------
 	void invalidRect (CRect r)
 	{
+		if (inputEventReceiveTime && !unpaintedInputEventReceiveTime)
+			unpaintedInputEventReceiveTime = inputEventReceiveTime;
 		dirtyRects.emplace_back (r);
 		if (redrawTimer)
 			return;
-		redrawTimer = makeOwned<RedrawTimerHandler> (16, [this]() {
-			if (dirtyRects.empty ())
-				return;
-			redraw ();
-		});
+		redrawTimer = makeOwned<CVSTGUITimer> (
+			[this] (CVSTGUITimer*) {
+				// stop once nothing is invalidated, so an idle frame does not wake up
+				if (dirtyRects.empty ())
+				{
+					redrawTimer = nullptr;
+					return;
+				}
+				redraw ();
+			},
+			16);
 	}
 
 	//------------------------------------------------------------------------
@@ -370,9 +297,24 @@ struct Frame::Impl : IFrameEventHandler
 	//------------------------------------------------------------------------
 	void onEvent (xcb_map_notify_event_t& event) override {}
 
+	//------------------------------------------------------------------------
+	// tracks the input event currently handled, to measure the time until its redraw
+	struct InputEventScope
+	{
+		InputEventScope (Impl& impl) : impl (impl)
+		{
+			impl.inputEventReceiveTime = RunLoop::instance ().getCurrentEventReceiveTime ();
+		}
+		~InputEventScope () noexcept { impl.inputEventReceiveTime = 0; }
+
+	private:
+		Impl& impl;
+	};
+
 	//------------------------------------------------------------------------
 	void onEvent (xcb_key_press_event_t& event) override
 	{
+		InputEventScope inputEventScope (*this);
 		auto type = (event.response_type & ~0x80);
 		auto keyCode = RunLoop::instance ().getCurrentKeyEvent ();
 		if (type == XCB_KEY_PRESS)
@@ -388,6 +330,7 @@ struct Frame::Impl : IFrameEventHandler
 	//------------------------------------------------------------------------
 	void onEvent (xcb_button_press_event_t& event) override
 	{
+		InputEventScope inputEventScope (*this);
 		CPoint where (event.event_x, event.event_y);
 		if ((event.response_type & ~0x80) == XCB_BUTTON_PRESS) // mouse down or wheel
 		{
@@ -452,13 +395,19 @@ struct Frame::Impl : IFrameEventHandler
 	//------------------------------------------------------------------------
 	void onEvent (xcb_motion_notify_event_t& event) override
 	{
+		InputEventScope inputEventScope (*this);
 		CPoint where (event.event_x, event.event_y);
 		auto buttons = translateMouseButtons (event.state);
 		doubleClickDetector.onMouseMove (where, buttons, event.time);
 		frame->platformOnMouseMoved (where, buttons);
-		// make sure we get more motion events
-		auto xcb = RunLoop::instance ().getXcbConnection ();
-		xcb_get_motion_events (xcb, window.getID (), event.time, event.time + 10000000);
+		if (event.detail == XCB_MOTION_HINT)
+		{
+			// the window selects XCB_EVENT_MASK_POINTER_MOTION_HINT, the server only sends the next
+			// motion event after the pointer was queried
+			auto xcb = RunLoop::instance ().getXcbConnection ();
+			auto cookie = xcb_query_pointer (xcb, window.getID ());
+			xcb_discard_reply (xcb, cookie.sequence);
+		}
 	}
 
 	//------------------------------------------------------------------------
@@ -796,6 +745,9 @@ Frame::CreateIResourceInputStreamFunc Frame::createResourceInputStreamFunc =
 //------------------------------------------------------------------------
 UTF8String Frame::resourcePath = Platform::getInstance ().getPath () + "/Contents/Resources/";
 
+//------------------------------------------------------------------------
+BackBufferMode Frame::backBufferMode = BackBufferMode::XServer;
+
 //------------------------------------------------------------------------
 } // X11
 
@@ -813,12 +765,17 @@ IPlatformFrame* IPlatformFrame::createPlatformFrame (IPlatformFrameCallback* fra
 		auto x11Parent = reinterpret_cast<XID> (parent);
 		return new X11::Frame (frame, size, x11Parent, config);
 	}
+	if (parentType == kHeadless)
+		return new X11::HeadlessFrame (frame, size, config);
 	return nullptr;
 }
 
 //------------------------------------------------------------------------
 uint32_t IPlatformFrame::getTicks ()
 {
+	// animations follow the manual clock of headless frames
+	if (auto runLoop = dynamic_cast<X11::ManualRunLoop*> (X11::RunLoop::get ().get ()))
+		return static_cast<uint32_t> (runLoop->getTime ());
 	return static_cast<uint32_t> (X11::Platform::getCurrentTimeMs ());
 }
 
@@ -16,6 +16,15 @@
 namespace VSTGUI {
 namespace X11 {
 
+//------------------------------------------------------------------------
+enum class BackBufferMode
+{
+	/** the back buffer is a surface on the X server */
+	XServer,
+	/** the back buffer is a client side image shared with the X server via MIT-SHM */
+	SharedMemory,
+};
+
 //------------------------------------------------------------------------
 class Frame
 	: public IPlatformFrame
@@ -36,6 +45,9 @@ public:
 
 	static UTF8String resourcePath;
 
+	/** back buffer mode of frames created afterwards */
+	static BackBufferMode backBufferMode;
+
 private:
 	bool getGlobalPosition (CPoint& pos) const override;
 	bool setSize (const CRect& newSize) override;
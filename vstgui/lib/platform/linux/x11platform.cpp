@@ -11,6 +11,7 @@
 #include <cassert>
 #include <chrono>
 #include <array>
+#include <algorithm>
 #include <dlfcn.h>
 #include <iostream>
 #include <locale>
@@ -139,6 +140,13 @@ uint64_t Platform::getCurrentTimeMs ()
 	return duration_cast<milliseconds> (steady_clock::now ().time_since_epoch ()).count ();
 }
 
+//------------------------------------------------------------------------
+uint64_t Platform::getCurrentTimeUs ()
+{
+	using namespace std::chrono;
+	return duration_cast<microseconds> (steady_clock::now ().time_since_epoch ()).count ();
+}
+
 //------------------------------------------------------------------------
 std::string Platform::getPath ()
 {
@@ -184,12 +192,16 @@ struct RunLoop::Impl : IEventHandler
 	std::array<xcb_cursor_t, CCursorType::kCursorIBeam + 1> cursors{{XCB_CURSOR_NONE}};
 	VstKeyCode lastUnprocessedKeyEvent;
 	uint32_t lastUtf32KeyEventChar{0};
+	EventStatistics eventStatistics;
+	uint64_t currentEventReceiveTime{0};
 
-	void init (const SharedPointer<IRunLoop>& inRunLoop)
+	void init (const SharedPointer<IRunLoop>& inRunLoop, bool connectToXServer = true)
 	{
 		if (++useCount != 1)
 			return;
 		runLoop = inRunLoop;
+		if (!connectToXServer)
+			return;
 		int screenNo;
 		xcbConnection = xcb_connect (nullptr, &screenNo);
 		runLoop->registerEventHandler (xcb_get_file_descriptor (xcbConnection), this);
@@ -235,8 +247,9 @@ struct RunLoop::Impl : IEventHandler
 			}
 
 			xcb_disconnect (xcbConnection);
+			xcbConnection = nullptr;
+			runLoop->unregisterEventHandler (this);
 		}
-		runLoop->unregisterEventHandler (this);
 		runLoop = nullptr;
 	}
 
@@ -246,6 +259,7 @@ struct RunLoop::Impl : IEventHandler
 		auto it = windowEventHandlerMap.find (windowId);
 		if (it == windowEventHandlerMap.end ())
 			return;
+		++eventStatistics.eventsDispatched;
 		it->second->onEvent (event);
 	}
 
@@ -277,11 +291,62 @@ struct RunLoop::Impl : IEventHandler
 		lastUnprocessedKeyEvent = code;
 	}
 
+	//------------------------------------------------------------------------
+	struct PendingMotionEvent
+	{
+		xcb_motion_notify_event_t* event{nullptr};
+		uint64_t receiveTime{0};
+	};
+
+	void dispatchMotionEvent (PendingMotionEvent& pending)
+	{
+		if (!pending.event)
+			return;
+		currentEventReceiveTime = pending.receiveTime;
+		dispatchEvent (*pending.event, pending.event->event);
+		std::free (pending.event);
+		pending.event = nullptr;
+	}
+
+	// A motion event is only dispatched when no further motion event of the same window with the
+	// same button state follows in the same batch of events. Any other event dispatches the
+	// pending motion event first, so the event order is kept.
+	void coalesceMotionEvent (PendingMotionEvent& pending, xcb_motion_notify_event_t* event,
+							  uint64_t receiveTime)
+	{
+		if (pending.event)
+		{
+			if (pending.event->event == event->event && pending.event->state == event->state)
+			{
+				// keep the receive time of the first event for the latency statistics
+				++eventStatistics.motionEventsCoalesced;
+				std::free (pending.event);
+				pending.event = event;
+				return;
+			}
+			dispatchMotionEvent (pending);
+		}
+		pending.event = event;
+		pending.receiveTime = receiveTime;
+	}
+
 	void onEvent () override
 	{
+		PendingMotionEvent pendingMotionEvent;
 		while (auto event = xcb_poll_for_event (xcbConnection))
 		{
+			++eventStatistics.eventsReceived;
+			auto receiveTime = Platform::getCurrentTimeUs ();
 			auto type = event->response_type & ~0x80;
+			if (type == XCB_MOTION_NOTIFY)
+			{
+				coalesceMotionEvent (pendingMotionEvent,
+									 reinterpret_cast<xcb_motion_notify_event_t*> (event),
+									 receiveTime);
+				continue;
+			}
+			dispatchMotionEvent (pendingMotionEvent);
+			currentEventReceiveTime = receiveTime;
 			switch (type)
 			{
 				case XCB_KEY_PRESS:
@@ -310,12 +375,6 @@ struct RunLoop::Impl : IEventHandler
 					dispatchEvent (*ev, ev->event);
 					break;
 				}
-				case XCB_MOTION_NOTIFY:
-				{
-					auto ev = reinterpret_cast<xcb_motion_notify_event_t*> (event);
-					dispatchEvent (*ev, ev->event);
-					break;
-				}
 				case XCB_ENTER_NOTIFY:
 				{
 					auto ev = reinterpret_cast<xcb_enter_notify_event_t*> (event);
@@ -372,6 +431,8 @@ struct RunLoop::Impl : IEventHandler
 			}
 			std::free (event);
 		}
+		dispatchMotionEvent (pendingMotionEvent);
+		currentEventReceiveTime = 0;
 		xcb_aux_sync (xcbConnection);
 		xcb_flush (xcbConnection);
 	}
@@ -390,6 +451,12 @@ void RunLoop::init (const SharedPointer<IRunLoop>& runLoop)
 	instance ().impl->init (runLoop);
 }
 
+//------------------------------------------------------------------------
+void RunLoop::initHeadless (const SharedPointer<IRunLoop>& runLoop)
+{
+	instance ().impl->init (runLoop, false);
+}
+
 //------------------------------------------------------------------------
 void RunLoop::exit ()
 {
@@ -432,6 +499,37 @@ xcb_connection_t* RunLoop::getXcbConnection () const
 	return impl->xcbConnection;
 }
 
+//------------------------------------------------------------------------
+uint64_t RunLoop::getCurrentEventReceiveTime () const
+{
+	return impl->currentEventReceiveTime;
+}
+
+//------------------------------------------------------------------------
+void RunLoop::onInputEventPainted (uint64_t eventReceiveTime)
+{
+	auto now = Platform::getCurrentTimeUs ();
+	if (now < eventReceiveTime)
+		return;
+	auto latency = now - eventReceiveTime;
+	auto& statistics = impl->eventStatistics;
+	++statistics.inputEventPaints;
+	statistics.totalEventToPaintLatency += latency;
+	statistics.maxEventToPaintLatency = std::max (statistics.maxEventToPaintLatency, latency);
+}
+
+//------------------------------------------------------------------------
+const EventStatistics& RunLoop::getEventStatistics () const
+{
+	return impl->eventStatistics;
+}
+
+//------------------------------------------------------------------------
+void RunLoop::resetEventStatistics ()
+{
+	impl->eventStatistics = {};
+}
+
 //------------------------------------------------------------------------
 namespace {
 
@@ -44,6 +44,22 @@ struct IFrameEventHandler
 	virtual void onEvent (xcb_client_message_event_t& event) = 0;
 };
 
+//------------------------------------------------------------------------
+struct EventStatistics
+{
+	/** events read from the X server connection */
+	uint64_t eventsReceived {0};
+	/** events delivered to a frame */
+	uint64_t eventsDispatched {0};
+	/** motion events dropped in favor of a later motion event of the same window */
+	uint64_t motionEventsCoalesced {0};
+	/** redraws caused by input events */
+	uint64_t inputEventPaints {0};
+	/** time from reading an input event until its redraw was on screen (in microseconds) */
+	uint64_t totalEventToPaintLatency {0};
+	uint64_t maxEventToPaintLatency {0};
+};
+
 //------------------------------------------------------------------------
 class Platform
 {
@@ -52,6 +68,7 @@ public:
 
 	static Platform& getInstance ();
 	static uint64_t getCurrentTimeMs ();
+	static uint64_t getCurrentTimeUs ();
 
 	std::string getPath ();
 
@@ -66,6 +83,8 @@ private:
 struct RunLoop
 {
 	static void init (const SharedPointer<IRunLoop>& runLoop);
+	/** init without a connection to the X server, only the timers of the run loop are used */
+	static void initHeadless (const SharedPointer<IRunLoop>& runLoop);
 	static void exit ();
 	static const SharedPointer<IRunLoop> get ();
 
@@ -78,6 +97,13 @@ struct RunLoop
 	VstKeyCode getCurrentKeyEvent () const;
 	Optional<UTF8String> convertCurrentKeyEventToText () const;
 
+	/** time (see Platform::getCurrentTimeUs) the currently dispatched event was received */
+	uint64_t getCurrentEventReceiveTime () const;
+	void onInputEventPainted (uint64_t eventReceiveTime);
+
+	const EventStatistics& getEventStatistics () const;
+	void resetEventStatistics ();
+
 	static RunLoop& instance ();
 
 private:
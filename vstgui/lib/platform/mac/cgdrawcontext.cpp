@@ -116,6 +116,7 @@ void CGDrawContext::drawGraphicsPath (CGraphicsPath* _path, PathDrawMode mode,
 	QuartzGraphicsPath* path = dynamic_cast<QuartzGraphicsPath*> (_path);
 	if (path == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kGraphicsPath);
 
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
@@ -176,6 +177,7 @@ void CGDrawContext::fillLinearGradient (CGraphicsPath* _path, const CGradient& g
 	const QuartzGradient* cgGradient = dynamic_cast<const QuartzGradient*> (&gradient);
 	if (cgGradient == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kLinearGradient);
 
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
@@ -224,6 +226,7 @@ void CGDrawContext::fillRadialGradient (CGraphicsPath* _path, const CGradient& g
 	const QuartzGradient* cgGradient = dynamic_cast<const QuartzGradient*> (&gradient);
 	if (cgGradient == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kRadialGradient);
 
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
@@ -323,6 +326,7 @@ void CGDrawContext::resetClipRect ()
 //-----------------------------------------------------------------------------
 void CGDrawContext::drawLine (const LinePair& line)
 {
+	profileDrawCall (DrawProfiler::kLine);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		applyLineStyle (context);
@@ -351,6 +355,7 @@ void CGDrawContext::drawLines (const LineList& lines)
 {
 	if (lines.size () == 0)
 		return;
+	profileDrawCall (DrawProfiler::kLines);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		applyLineStyle (context);
@@ -398,6 +403,7 @@ void CGDrawContext::drawPolygon (const PointList& polygonPointList, const CDrawS
 {
 	if (polygonPointList.size () == 0)
 		return;
+	profileDrawCall (DrawProfiler::kPolygon);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		CGPathDrawingMode m;
@@ -437,6 +443,7 @@ void CGDrawContext::applyLineWidthCTM (CGContextRef context) const
 //-----------------------------------------------------------------------------
 void CGDrawContext::drawRect (const CRect& rect, const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kRect);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		CGRect r = CGRectFromCRect (rect);
@@ -473,6 +480,7 @@ void CGDrawContext::drawRect (const CRect& rect, const CDrawStyle drawStyle)
 //-----------------------------------------------------------------------------
 void CGDrawContext::drawEllipse (const CRect& rect, const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kEllipse);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		CGRect r = CGRectFromCRect (rect);
@@ -507,13 +515,14 @@ void CGDrawContext::drawEllipse (const CRect& rect, const CDrawStyle drawStyle)
 //-----------------------------------------------------------------------------
 void CGDrawContext::drawPoint (const CPoint& point, const CColor& color)
 {
+	profileDrawCall (DrawProfiler::kPoint);
 	saveGlobalState ();
 
 	setLineWidth (1);
 	setFrameColor (color);
 	CPoint point2 (point);
 	point2.x++;
-	COffscreenContext::drawLine (point, point2);
+	drawUnprofiled ([&] () { COffscreenContext::drawLine (point, point2); });
 
 	restoreGlobalState ();
 }
@@ -544,6 +553,7 @@ void CGDrawContext::addOvalToPath (CGContextRef c, CPoint center, CGFloat a, CGF
 void CGDrawContext::drawArc (const CRect& rect, const float _startAngle, const float _endAngle,
                              const CDrawStyle drawStyle)
 {
+	profileDrawCall (DrawProfiler::kArc);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		CGPathDrawingMode m;
@@ -613,6 +623,7 @@ void CGDrawContext::fillRectWithBitmap (CBitmap* bitmap, const CRect& srcRect, c
 
 			setCGDrawContextQuality (context);
 
+			profileBitmapDraw (dstRect);
 			CGContextDrawTiledImage (context, r, image);
 
 			releaseCGContext (context);
@@ -626,6 +637,7 @@ void CGDrawContext::drawBitmap (CBitmap* bitmap, const CRect& inRect, const CPoi
 {
 	if (bitmap == nullptr || alpha == 0.f)
 		return;
+	profileBitmapDraw (inRect);
 	double transformedScaleFactor = scaleFactor;
 	CGraphicsTransform t = getCurrentTransform ();
 	if (t.m11 == t.m22 && t.m12 == 0 && t.m21 == 0)
@@ -742,6 +754,7 @@ void CGDrawContext::setCGDrawContextQuality (CGContextRef context)
 //-----------------------------------------------------------------------------
 void CGDrawContext::clearRect (const CRect& rect)
 {
+	profileDrawCall (DrawProfiler::kClearRect);
 	if (auto context = beginCGContext (true, getDrawMode ().integralMode ()))
 	{
 		CGRect cgRect = CGRectFromCRect (rect);
@@ -259,6 +259,7 @@ void D2DDrawContext::drawGraphicsPath (CGraphicsPath* _path, PathDrawMode mode,
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kGraphicsPath);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -299,6 +300,7 @@ void D2DDrawContext::fillLinearGradient (CGraphicsPath* _path, const CGradient&
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kLinearGradient);
 
 	D2DApplyClip ac (this, true);
 	if (ac.isEmpty ())
@@ -335,6 +337,7 @@ void D2DDrawContext::fillRadialGradient (CGraphicsPath* _path, const CGradient&
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kRadialGradient);
 
 	D2DApplyClip ac (this, true);
 	if (ac.isEmpty ())
@@ -385,6 +388,7 @@ void D2DDrawContext::fillRadialGradient (CGraphicsPath* _path, const CGradient&
 //-----------------------------------------------------------------------------
 void D2DDrawContext::clearRect (const CRect& rect)
 {
+	profileDrawCall (DrawProfiler::kClearRect);
 	if (renderTarget)
 	{
 		CRect oldClip = getCurrentState ().clipRect;
@@ -400,6 +404,7 @@ void D2DDrawContext::drawBitmap (CBitmap* bitmap, const CRect& dest, const CPoin
 {
 	if (renderTarget == nullptr)
 		return;
+	profileBitmapDraw (dest);
 	ConcatClip concatClip (*this, dest);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
@@ -470,6 +475,7 @@ void D2DDrawContext::drawLine (const LinePair& line)
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kLine);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -494,6 +500,7 @@ void D2DDrawContext::drawLines (const LineList& lines)
 {
 	if (lines.size () == 0 || renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kLines);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -523,6 +530,7 @@ void D2DDrawContext::drawPolygon (const PointList& polygonPointList, const CDraw
 {
 	if (renderTarget == nullptr || polygonPointList.size () == 0)
 		return;
+	profileDrawCall (DrawProfiler::kPolygon);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -533,14 +541,12 @@ void D2DDrawContext::drawPolygon (const PointList& polygonPointList, const CDraw
 	{
 		path.addLine (polygonPointList[i]);
 	}
-	if (drawStyle == kDrawFilled || drawStyle == kDrawFilledAndStroked)
-	{
-		drawGraphicsPath (&path, kPathFilled);
-	}
-	if (drawStyle == kDrawStroked || drawStyle == kDrawFilledAndStroked)
-	{
-		drawGraphicsPath (&path, kPathStroked);
-	}
+	drawUnprofiled ([&] () {
+		if (drawStyle == kDrawFilled || drawStyle == kDrawFilledAndStroked)
+			drawGraphicsPath (&path, kPathFilled);
+		if (drawStyle == kDrawStroked || drawStyle == kDrawFilledAndStroked)
+			drawGraphicsPath (&path, kPathStroked);
+	});
 }
 
 //-----------------------------------------------------------------------------
@@ -548,6 +554,7 @@ void D2DDrawContext::drawRect (const CRect &_rect, const CDrawStyle drawStyle)
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kRect);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -576,14 +583,17 @@ void D2DDrawContext::drawArc (const CRect& _rect, const float _startAngle, const
 {
 	if (auto path = owned (createGraphicsPath ()))
 	{
+		profileDrawCall (DrawProfiler::kArc);
 		CRect rect (_rect);
 		if (getDrawMode ().integralMode ())
 			pixelAllign (rect);
 		path->addArc (rect, _startAngle, _endAngle, true);
-		if (drawStyle == kDrawFilled || drawStyle == kDrawFilledAndStroked)
-			drawGraphicsPath (path, kPathFilled);
-		if (drawStyle == kDrawStroked || drawStyle == kDrawFilledAndStroked)
-			drawGraphicsPath (path, kPathStroked);
+		drawUnprofiled ([&] () {
+			if (drawStyle == kDrawFilled || drawStyle == kDrawFilledAndStroked)
+				drawGraphicsPath (path, kPathFilled);
+			if (drawStyle == kDrawStroked || drawStyle == kDrawFilledAndStroked)
+				drawGraphicsPath (path, kPathStroked);
+		});
 	}
 }
 
@@ -592,6 +602,7 @@ void D2DDrawContext::drawEllipse (const CRect &_rect, const CDrawStyle drawStyle
 {
 	if (renderTarget == nullptr)
 		return;
+	profileDrawCall (DrawProfiler::kEllipse);
 	D2DApplyClip ac (this);
 	if (ac.isEmpty ())
 		return;
@@ -619,12 +630,13 @@ void D2DDrawContext::drawEllipse (const CRect &_rect, const CDrawStyle drawStyle
 //-----------------------------------------------------------------------------
 void D2DDrawContext::drawPoint (const CPoint &point, const CColor& color)
 {
+	profileDrawCall (DrawProfiler::kPoint);
 	saveGlobalState ();
 	setLineWidth (1);
 	setFrameColor (color);
 	CPoint point2 (point);
 	point2.x++;
-	COffscreenContext::drawLine (point, point2);
+	drawUnprofiled ([&] () { COffscreenContext::drawLine (point, point2); });
 	restoreGlobalState ();
 }
 
@@ -0,0 +1,268 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "timerwheel.h"
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace {
+
+//------------------------------------------------------------------------
+// entries further away are placed at the last slot of the top level and placed again once the
+// wheel reaches that slot
+constexpr uint64_t kMaxDistance = static_cast<uint64_t> (TimerWheel::kNumSlots - 1)
+                                  << (TimerWheel::kSlotBits * (TimerWheel::kNumLevels - 1));
+
+//------------------------------------------------------------------------
+inline uint32_t slotIndex (uint64_t tick, uint32_t level)
+{
+	return static_cast<uint32_t> (tick >> (TimerWheel::kSlotBits * level)) &
+	       (TimerWheel::kNumSlots - 1);
+}
+
+//------------------------------------------------------------------------
+inline uint32_t countTrailingZeros (uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<uint32_t> (__builtin_ctzll (value));
+#else
+	uint32_t result = 0;
+	while ((value & 1) == 0)
+	{
+		value >>= 1;
+		++result;
+	}
+	return result;
+#endif
+}
+
+//------------------------------------------------------------------------
+inline uint64_t rotateRight (uint64_t value, uint32_t shift)
+{
+	shift &= 63;
+	return shift ? (value >> shift) | (value << (64 - shift)) : value;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+TimerWheel::TimerWheel (uint64_t currentTick)
+: currentTick (currentTick)
+{
+	for (auto& level : slots)
+	{
+		for (auto& list : level)
+			initList (list);
+	}
+	occupied.fill (0);
+	initList (pending);
+}
+
+//------------------------------------------------------------------------
+TimerWheel::~TimerWheel () noexcept
+{
+	auto unlinkAll = [] (Link& list) {
+		while (!isListEmpty (list))
+			unlink (*list.next);
+	};
+	for (auto& level : slots)
+	{
+		for (auto& list : level)
+			unlinkAll (list);
+	}
+	unlinkAll (pending);
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::initList (Link& list)
+{
+	list.prev = list.next = &list;
+}
+
+//------------------------------------------------------------------------
+bool TimerWheel::isListEmpty (const Link& list)
+{
+	return list.next == &list;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::pushBack (Link& list, Link& link)
+{
+	link.prev = list.prev;
+	link.next = &list;
+	list.prev->next = &link;
+	list.prev = &link;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::unlink (Link& link)
+{
+	link.prev->next = link.next;
+	link.next->prev = link.prev;
+	link.prev = link.next = nullptr;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::moveList (Link& from, Link& to)
+{
+	if (isListEmpty (from))
+		return;
+	from.next->prev = to.prev;
+	to.prev->next = from.next;
+	from.prev->next = &to;
+	to.prev = from.prev;
+	initList (from);
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::add (Entry& entry, uint64_t deadline, uint32_t period)
+{
+	remove (entry);
+	entry.deadline = deadline > currentTick ? deadline : currentTick + 1;
+	entry.period = period;
+	insert (entry);
+	++numEntries;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::remove (Entry& entry)
+{
+	if (!entry.isScheduled ())
+		return;
+	unlink (entry);
+	if (entry.level >= 0)
+	{
+		if (isListEmpty (slots[entry.level][entry.slot]))
+			occupied[entry.level] &= ~(static_cast<uint64_t> (1) << entry.slot);
+		entry.level = -1;
+	}
+	--numEntries;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::insert (Entry& entry)
+{
+	auto tick = entry.deadline - currentTick > kMaxDistance ? currentTick + kMaxDistance
+	                                                         : entry.deadline;
+	uint32_t level = 0;
+	while (level + 1 < kNumLevels &&
+	       (tick >> (kSlotBits * (level + 1))) != (currentTick >> (kSlotBits * (level + 1))))
+		++level;
+	auto slot = slotIndex (tick, level);
+	pushBack (slots[level][slot], entry);
+	occupied[level] |= static_cast<uint64_t> (1) << slot;
+	entry.level = static_cast<int32_t> (level);
+	entry.slot = slot;
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::cascade (uint32_t level, uint32_t slot)
+{
+	Link list;
+	initList (list);
+	moveList (slots[level][slot], list);
+	occupied[level] &= ~(static_cast<uint64_t> (1) << slot);
+	while (!isListEmpty (list))
+	{
+		auto& entry = static_cast<Entry&> (*list.next);
+		unlink (entry);
+		insert (entry);
+	}
+}
+
+//------------------------------------------------------------------------
+void TimerWheel::fireSlot (uint32_t slot, uint64_t tick, uint32_t& numFired)
+{
+	auto& list = slots[0][slot];
+	if (isListEmpty (list))
+		return;
+	for (auto link = list.next; link != &list; link = link->next)
+		static_cast<Entry*> (link)->level = -1;
+	moveList (list, pending);
+	occupied[0] &= ~(static_cast<uint64_t> (1) << slot);
+
+	// the callbacks may add and remove any entry, including the ones still pending
+	while (!isListEmpty (pending))
+	{
+		auto& entry = static_cast<Entry&> (*pending.next);
+		unlink (entry);
+		if (entry.deadline > currentTick)
+		{
+			insert (entry);
+			continue;
+		}
+		if (entry.period)
+		{
+			// periods missed until tick are skipped instead of fired in a burst
+			auto missed = entry.deadline < tick ? (tick - entry.deadline) / entry.period : 0;
+			entry.deadline += (missed + 1) * entry.period;
+			insert (entry);
+		}
+		else
+			--numEntries;
+		++numFired;
+		if (entry.callback)
+			entry.callback->fire ();
+	}
+}
+
+//------------------------------------------------------------------------
+uint32_t TimerWheel::advance (uint64_t tick)
+{
+	uint32_t numFired = 0;
+	while (currentTick < tick)
+	{
+		auto nextDeadline = getNextDeadline ();
+		auto step = nextDeadline < tick ? nextDeadline : tick;
+		auto previousTick = currentTick;
+		currentTick = step;
+		for (auto level = kNumLevels - 1; level > 0; --level)
+		{
+			auto shift = kSlotBits * level;
+			if ((previousTick >> shift) != (step >> shift))
+				cascade (level, slotIndex (step, level));
+		}
+		fireSlot (slotIndex (step, 0), tick, numFired);
+	}
+	return numFired;
+}
+
+//------------------------------------------------------------------------
+uint64_t TimerWheel::getNextDeadline () const
+{
+	for (auto level = 0u; level < kNumLevels; ++level)
+	{
+		auto mask = occupied[level];
+		if (mask == 0)
+			continue;
+		auto current = slotIndex (currentTick, level);
+		auto slot = (current + 1 + countTrailingZeros (rotateRight (mask, current + 1))) &
+		            (kNumSlots - 1);
+		auto shift = kSlotBits * level;
+		auto blockSize = static_cast<uint64_t> (1) << shift;
+		auto blockStart = ((currentTick >> (shift + kSlotBits)) << (shift + kSlotBits)) +
+		                  (static_cast<uint64_t> (slot) << shift);
+		if (slot <= current)
+			blockStart += blockSize << kSlotBits;
+		if (level == 0)
+			return blockStart;
+		// all entries of lower levels and earlier slots are due before the entries of this slot
+		auto result = kNoDeadline;
+		const auto& list = slots[level][slot];
+		for (auto link = list.next; link != &list; link = link->next)
+		{
+			auto deadline = static_cast<const Entry*> (link)->deadline;
+			// entries beyond kMaxDistance need to be placed again at the start of the slot
+			if (deadline >= blockStart + blockSize)
+				deadline = blockStart;
+			if (deadline < result)
+				result = deadline;
+		}
+		return result;
+	}
+	return kNoDeadline;
+}
+
+} // VSTGUI
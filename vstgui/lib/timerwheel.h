@@ -0,0 +1,104 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "vstguibase.h"
+#include "platform/iplatformtimer.h"
+#include <array>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+
+//------------------------------------------------------------------------
+/** Hierarchical timer wheel
+ *
+ *	Schedules periodic and one shot callbacks with millisecond ticks. The wheel has kNumLevels
+ *	levels of kNumSlots slots, an entry is placed in the level of the highest tick bit in which its
+ *	deadline differs from the current tick, so adding and removing is constant time and finding the
+ *	next deadline only scans one occupancy mask per level. Entries are intrusive and owned by the
+ *	caller, the wheel does not know about time, it is advanced with the current tick by its owner.
+ */
+class TimerWheel
+{
+public:
+	static constexpr uint32_t kSlotBits = 6;
+	static constexpr uint32_t kNumSlots = 1 << kSlotBits;
+	static constexpr uint32_t kNumLevels = 4;
+	static constexpr uint64_t kNoDeadline = ~static_cast<uint64_t> (0);
+
+	struct Link
+	{
+		Link* prev {nullptr};
+		Link* next {nullptr};
+	};
+
+	class Entry : private Link
+	{
+	public:
+		Entry (IPlatformTimerCallback* callback = nullptr) : callback (callback) {}
+		~Entry () noexcept { vstgui_assert (!isScheduled ()); }
+
+		Entry (const Entry&) = delete;
+		Entry& operator= (const Entry&) = delete;
+
+		bool isScheduled () const { return next != nullptr; }
+		uint64_t getDeadline () const { return deadline; }
+		uint32_t getPeriod () const { return period; }
+
+	private:
+		friend class TimerWheel;
+
+		IPlatformTimerCallback* callback;
+		uint64_t deadline {0};
+		uint32_t period {0};
+		int32_t level {-1};
+		uint32_t slot {0};
+	};
+
+	TimerWheel (uint64_t currentTick = 0);
+	~TimerWheel () noexcept;
+
+	TimerWheel (const TimerWheel&) = delete;
+	TimerWheel& operator= (const TimerWheel&) = delete;
+
+	/** schedule the entry to fire at deadline and then every period ticks if period is not zero.
+	 *	Deadlines not after the current tick are moved to the next tick.
+	 */
+	void add (Entry& entry, uint64_t deadline, uint32_t period = 0);
+	/** unschedule the entry, it is safe to remove entries while the wheel is advanced */
+	void remove (Entry& entry);
+
+	/** advance the current tick to tick and fire all entries that are due, returns the number of
+	 *	fired entries. Periodic entries fire at most once per call.
+	 */
+	uint32_t advance (uint64_t tick);
+
+	/** the tick of the earliest scheduled entry or kNoDeadline */
+	uint64_t getNextDeadline () const;
+	uint64_t getCurrentTick () const { return currentTick; }
+	uint32_t getNumEntries () const { return numEntries; }
+	bool empty () const { return numEntries == 0; }
+
+private:
+	using SlotArray = std::array<Link, kNumSlots>;
+
+	static void initList (Link& list);
+	static bool isListEmpty (const Link& list);
+	static void pushBack (Link& list, Link& link);
+	static void unlink (Link& link);
+	static void moveList (Link& from, Link& to);
+
+	void insert (Entry& entry);
+	void cascade (uint32_t level, uint32_t slot);
+	void fireSlot (uint32_t slot, uint64_t tick, uint32_t& numFired);
+
+	std::array<SlotArray, kNumLevels> slots;
+	std::array<uint64_t, kNumLevels> occupied;
+	Link pending;
+	uint64_t currentTick;
+	uint32_t numEntries {0};
+};
+
+} // VSTGUI
@@ -181,6 +181,7 @@ class CGradient;
 class UTF8String;
 class UTF8StringView;
 class CVSTGUITimer;
+class DrawProfiler;
 class CMenuItem;
 class CCommandMenuItem;
 class GenericStringListDataBrowserSource;
@@ -246,6 +247,8 @@ class IAnimationTarget;
 class ITimingFunction;
 class AlphaValueAnimation;
 class ViewSizeAnimation;
+class CompositeAlphaAnimation;
+class CompositeViewSizeAnimation;
 class ExchangeViewAnimation;
 class ControlValueAnimation;
 class Animator;
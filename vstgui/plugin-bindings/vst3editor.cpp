@@ -301,7 +301,7 @@ protected:
 				else
 					c->setValueNormalized ((float)value);
 			}
-			c->invalid ();
+			c->invalidDirtyRect ();
 		}
 	}
 	Steinberg::Vst::EditController* editController;
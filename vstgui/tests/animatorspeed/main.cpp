@@ -0,0 +1,86 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/animation/animator.h"
+#include "vstgui/lib/animation/ianimationtarget.h"
+#include "vstgui/lib/animation/timingfunctions.h"
+#include "vstgui/lib/cview.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace VSTGUI;
+using namespace VSTGUI::Animation;
+
+//------------------------------------------------------------------------
+// measures the animator and not the views
+struct NullTarget : IAnimationTarget
+{
+	void animationStart (CView* view, IdStringPtr name) override {}
+	void animationTick (CView* view, IdStringPtr name, float pos) override { ++numTicks; }
+	void animationFinished (CView* view, IdStringPtr name, bool wasCanceled) override {}
+
+	static uint64_t numTicks;
+};
+uint64_t NullTarget::numTicks = 0;
+
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measureMicroseconds (uint32_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+		proc (i);
+	std::chrono::duration<double, std::micro> duration = Clock::now () - start;
+	return duration.count () / repetitions;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numViews = 10000;
+	constexpr uint32_t numTicks = 100;
+	constexpr uint32_t numHoverChanges = 100000;
+	constexpr uint32_t animationLength = 60 * 60 * 1000;
+	static const IdStringPtr names[] = {"hover", "press", "value", "fade"};
+
+	std::vector<SharedPointer<CView>> views;
+	std::vector<SharedPointer<CView>> otherViews;
+	for (auto i = 0u; i < numViews; ++i)
+	{
+		views.emplace_back (makeOwned<CView> (CRect (0, 0, 10, 10)));
+		otherViews.emplace_back (makeOwned<CView> (CRect (0, 0, 10, 10)));
+	}
+
+	auto animator = makeOwned<Animator> ();
+	auto addTime = measureMicroseconds (numViews, [&] (uint32_t i) {
+		animator->addAnimation (views[i], names[i % 4], new NullTarget,
+		                        new LinearTimingFunction (animationLength));
+	});
+	auto tickTime = measureMicroseconds (numTicks, [&] (uint32_t) { animator->onTimer (); });
+	// hover effects over a pad grid replace the animation of the same view and name
+	auto replaceTime = measureMicroseconds (numHoverChanges, [&] (uint32_t i) {
+		auto index = (i * 7919) % numViews;
+		animator->addAnimation (views[index], names[index % 4], new NullTarget,
+		                        new LinearTimingFunction (animationLength));
+	});
+	// every view removed from a frame removes its animations, most views have none
+	auto removeViewTime = measureMicroseconds (numViews, [&] (uint32_t i) {
+		animator->removeAnimations (otherViews[i]);
+	});
+	auto cancelTime = measureMicroseconds (numViews, [&] (uint32_t i) {
+		animator->removeAnimation (views[i], names[i % 4]);
+	});
+
+	printf ("%u concurrent animations, %llu ticks delivered\n", numViews,
+	        static_cast<unsigned long long> (NullTarget::numTicks));
+	printf ("add animation:              %8.3f us\n", addTime);
+	printf ("tick all animations:        %8.3f us\n", tickTime);
+	printf ("replace animation:          %8.3f us\n", replaceTime);
+	printf ("remove view w/o animations: %8.3f us\n", removeViewTime);
+	printf ("cancel animation:           %8.3f us\n", cancelTime);
+	return 0;
+}
@@ -5,25 +5,98 @@
 #include "vstgui/uidescription/base64codec.h"
 #include "vstgui/lib/malloc.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
 #include <random>
 
 using namespace VSTGUI;
 
-int main ()
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measure (size_t bytesPerRun, size_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+		proc ();
+	std::chrono::duration<double> duration = Clock::now () - start;
+	return (static_cast<double> (bytesPerRun * repetitions) / (1024. * 1024.)) / duration.count ();
+}
+
+//------------------------------------------------------------------------
+static bool isEqual (const Buffer<uint8_t>& data, const Base64Codec::Result& result)
+{
+	if (data.size () != result.dataSize)
+		return false;
+	return memcmp (data.get (), result.data.get (), data.size ()) == 0;
+}
+
+//------------------------------------------------------------------------
+static bool runBenchmark (size_t dataSize, size_t repetitions, bool simd)
 {
+	Base64Codec::setSIMDEnabled (simd);
+
 	Buffer<uint8_t> origData;
-	origData.allocate (1024*1024*500);
+	origData.allocate (dataSize);
 
 	std::independent_bits_engine<std::default_random_engine, sizeof (uint16_t) * 8, uint16_t> rbe;
 	std::generate (origData.get (), origData.get () + origData.size (), std::ref (rbe));
 
 	auto encoderResult = Base64Codec::encode (origData.get (), origData.size ());
+	auto encodeSpeed = measure (dataSize, repetitions, [&] () {
+		encoderResult = Base64Codec::encode (origData.get (), origData.size ());
+	});
+
 	auto decoderResult = Base64Codec::decode (encoderResult.data.get (), encoderResult.dataSize);
+	if (!isEqual (origData, decoderResult))
+		return false;
+	auto decodeSpeed = measure (encoderResult.dataSize, repetitions, [&] () {
+		decoderResult = Base64Codec::decode (encoderResult.data.get (), encoderResult.dataSize);
+	});
 
-	if (origData.size () != decoderResult.dataSize)
-		return -1;
+	// feed the decoder in chunks like a parser delivers character data
+	static constexpr size_t kChunkSize = 4096 + 3;
+	auto streamDecode = [&] () {
+		Base64Codec::StreamDecoder decoder;
+		decoder.reserve (encoderResult.dataSize);
+		for (size_t pos = 0; pos < encoderResult.dataSize; pos += kChunkSize)
+			decoder.decode (encoderResult.data.get () + pos,
+			                std::min (kChunkSize, encoderResult.dataSize - pos));
+		return decoder.finish ();
+	};
+	if (!isEqual (origData, streamDecode ()))
+		return false;
+	auto streamDecodeSpeed =
+	    measure (encoderResult.dataSize, repetitions, [&] () { decoderResult = streamDecode (); });
+
+	printf ("%-6s %10zu bytes: encode %8.1f MB/s, decode %8.1f MB/s, stream decode %8.1f MB/s\n",
+	        simd ? "simd" : "scalar", dataSize, encodeSpeed, decodeSpeed, streamDecodeSpeed);
+	return true;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	struct Run
+	{
+		size_t dataSize;
+		size_t repetitions;
+	};
+	static constexpr Run runs[] = {
+		{64, 200000}, {1024, 50000}, {64 * 1024, 1000}, {4 * 1024 * 1024, 20}, {128 * 1024 * 1024, 1}};
 
-	if (memcmp (origData.get (), decoderResult.data.get (), origData.size ()) != 0)
-		return -1;
+	for (auto simd : {false, true})
+	{
+		for (const auto& run : runs)
+		{
+			if (!runBenchmark (run.dataSize, run.repetitions, simd))
+			{
+				printf ("Base64Codec result mismatch\n");
+				return -1;
+			}
+		}
+	}
 	return 0;
 }
@@ -0,0 +1,156 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/idependency.h"
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <set>
+#include <vector>
+
+using namespace VSTGUI;
+
+#if VSTGUI_ENABLE_DEPRECATED_METHODS
+
+//------------------------------------------------------------------------
+static IdStringPtr kMsgParameterChanged = "kMsgParameterChanged";
+static IdStringPtr kMsgParameterNameChanged = "kMsgParameterNameChanged";
+
+//------------------------------------------------------------------------
+struct Listener : CBaseObject
+{
+	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override
+	{
+		++numNotifications;
+		return kMessageNotified;
+	}
+
+	static uint64_t numNotifications;
+};
+uint64_t Listener::numNotifications = 0;
+
+//------------------------------------------------------------------------
+struct Parameter : CBaseObject, IDependency
+{
+};
+
+//------------------------------------------------------------------------
+// the dispatch IDependency used before, it copied the dependents for every notification
+struct LegacyParameter : CBaseObject
+{
+	void changed (IdStringPtr message)
+	{
+		if (deferChangeCount)
+		{
+			deferedChanges.emplace (message);
+		}
+		else if (dependents.empty () == false)
+		{
+			CBaseObject* This = dynamic_cast<CBaseObject*> (this);
+			std::list<CBaseObject*> localList (dependents);
+			for (auto& obj : localList)
+				obj->remember ();
+			for (auto& obj : localList)
+				obj->notify (This, message);
+			for (auto& obj : localList)
+				obj->forget ();
+		}
+	}
+
+	void deferChanges (bool state)
+	{
+		if (state)
+		{
+			deferChangeCount++;
+		}
+		else if (--deferChangeCount == 0)
+		{
+			for (auto& msg : deferedChanges)
+				changed (msg);
+			deferedChanges.clear ();
+		}
+	}
+
+	int32_t deferChangeCount {0};
+	std::set<IdStringPtr> deferedChanges;
+	std::list<CBaseObject*> dependents;
+};
+
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measureNotificationsPerSecond (uint32_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	Listener::numNotifications = 0;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+		proc ();
+	std::chrono::duration<double> duration = Clock::now () - start;
+	return static_cast<double> (Listener::numNotifications) / duration.count ();
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	// a parameter is typically observed by a few controls and the controller
+	constexpr uint32_t numDependents = 4;
+	constexpr uint32_t numChanges = 1000000;
+
+	std::vector<SharedPointer<Listener>> listeners;
+	for (auto i = 0u; i < numDependents; ++i)
+		listeners.emplace_back (makeOwned<Listener> ());
+
+	auto parameter = makeOwned<Parameter> ();
+	auto legacyParameter = makeOwned<LegacyParameter> ();
+	for (auto& listener : listeners)
+	{
+		parameter->addDependency (listener);
+		legacyParameter->dependents.emplace_back (listener);
+	}
+
+	auto legacyChanged = measureNotificationsPerSecond (
+	    numChanges, [&] () { legacyParameter->changed (kMsgParameterChanged); });
+	auto changed = measureNotificationsPerSecond (
+	    numChanges, [&] () { parameter->changed (kMsgParameterChanged); });
+
+	// an automation block changes value and name of a parameter a few times
+	auto legacyDeferred = measureNotificationsPerSecond (numChanges / 4, [&] () {
+		legacyParameter->deferChanges (true);
+		for (auto i = 0; i < 4; ++i)
+		{
+			legacyParameter->changed (kMsgParameterChanged);
+			legacyParameter->changed (kMsgParameterNameChanged);
+		}
+		legacyParameter->deferChanges (false);
+	});
+	auto deferred = measureNotificationsPerSecond (numChanges / 4, [&] () {
+		IDependency::DeferChanges dc (parameter);
+		for (auto i = 0; i < 4; ++i)
+		{
+			parameter->changed (kMsgParameterChanged);
+			parameter->changed (kMsgParameterNameChanged);
+		}
+	});
+
+	for (auto& listener : listeners)
+		parameter->removeDependency (listener);
+
+	printf ("%u dependents, notifications per second\n", numDependents);
+	printf ("changed (before):          %12.0f\n", legacyChanged);
+	printf ("changed:                   %12.0f\n", changed);
+	printf ("deferred changes (before): %12.0f\n", legacyDeferred);
+	printf ("deferred changes:          %12.0f\n", deferred);
+	return 0;
+}
+
+#else
+
+int main ()
+{
+	printf ("IDependency is only available with VSTGUI_ENABLE_DEPRECATED_METHODS\n");
+	return 0;
+}
+
+#endif // VSTGUI_ENABLE_DEPRECATED_METHODS
@@ -0,0 +1,347 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/coffscreencontext.h"
+#include "vstgui/lib/controls/cbuttons.h"
+#include "vstgui/lib/controls/cknob.h"
+#include "vstgui/lib/controls/ctextlabel.h"
+#include "vstgui/lib/platform/linux/headlessframe.h"
+#include "vstgui/tests/gfxtest/source/drawroutines.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace VSTGUI { void* soHandle = nullptr; }
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+// Renders the gfxtest draw routines and complete view trees into offscreen surfaces of a headless
+// frame at 1x and 2x. Every benchmark is repeated, each repetition runs for a minimum time and
+// reports operations per second, the statistics of the repetitions are printed and can be
+// written as JSON to compare library versions.
+//
+//	gfxspeed [--repetitions N] [--min-time SECONDS] [--filter SUBSTRING] [--json FILE]
+//------------------------------------------------------------------------
+
+static const CPoint surfaceSize (400, 300);
+static const double scaleFactors[] = {1., 2.};
+
+//------------------------------------------------------------------------
+struct Options
+{
+	uint32_t repetitions {10};
+	double minSeconds {0.1};
+	std::string filter;
+	std::string jsonPath;
+};
+
+//------------------------------------------------------------------------
+struct Statistics
+{
+	double median {0.};
+	double mean {0.};
+	double stddev {0.};
+	double min {0.};
+	double max {0.};
+
+	static Statistics make (std::vector<double> values)
+	{
+		Statistics s;
+		if (values.empty ())
+			return s;
+		std::sort (values.begin (), values.end ());
+		auto count = values.size ();
+		s.min = values.front ();
+		s.max = values.back ();
+		s.median = count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.;
+		for (auto v : values)
+			s.mean += v;
+		s.mean /= count;
+		for (auto v : values)
+			s.stddev += (v - s.mean) * (v - s.mean);
+		s.stddev = count > 1 ? std::sqrt (s.stddev / (count - 1)) : 0.;
+		return s;
+	}
+};
+
+//------------------------------------------------------------------------
+struct Result
+{
+	std::string name;
+	double scaleFactor;
+	uint64_t operations {0};
+	Statistics opsPerSecond;
+};
+
+//------------------------------------------------------------------------
+struct Benchmark
+{
+	std::string name;
+	/** prepare the operation for the scale factor, returns nullptr if it is not supported */
+	std::function<std::function<void ()> (double scaleFactor)> prepare;
+};
+
+//------------------------------------------------------------------------
+static Result run (const Benchmark& benchmark, double scaleFactor, const Options& options)
+{
+	using Clock = std::chrono::steady_clock;
+
+	Result result;
+	result.name = benchmark.name;
+	result.scaleFactor = scaleFactor;
+	auto operation = benchmark.prepare (scaleFactor);
+	if (!operation)
+		return result;
+
+	auto runRepetition = [&] () {
+		uint64_t numOperations = 0;
+		auto start = Clock::now ();
+		std::chrono::duration<double> elapsed {};
+		do
+		{
+			operation ();
+			++numOperations;
+			elapsed = Clock::now () - start;
+		} while (elapsed.count () < options.minSeconds);
+		result.operations += numOperations;
+		return numOperations / elapsed.count ();
+	};
+
+	// warm up caches, fonts and platform bitmaps
+	runRepetition ();
+	result.operations = 0;
+
+	std::vector<double> opsPerSecond;
+	for (auto i = 0u; i < options.repetitions; ++i)
+		opsPerSecond.push_back (runRepetition ());
+	result.opsPerSecond = Statistics::make (std::move (opsPerSecond));
+	return result;
+}
+
+//------------------------------------------------------------------------
+static std::function<void ()> makeOffscreenOperation (
+	CFrame* frame, double scaleFactor, std::function<void (CDrawContext&, CPoint)> draw)
+{
+	auto offscreen = COffscreenContext::create (frame, surfaceSize.x, surfaceSize.y, scaleFactor);
+	if (!offscreen)
+		return nullptr;
+	return [offscreen, draw] () {
+		offscreen->beginDraw ();
+		draw (*offscreen, surfaceSize);
+		offscreen->endDraw ();
+	};
+}
+
+//------------------------------------------------------------------------
+static void addControls (CViewContainer* container, uint32_t numControls)
+{
+	constexpr CCoord cellSize = 40.;
+	auto columns = static_cast<uint32_t> (container->getWidth () / cellSize);
+	for (auto i = 0u; i < numControls; ++i)
+	{
+		CRect r (0, 0, cellSize - 4., cellSize - 4.);
+		r.offset ((i % columns) * cellSize + 2., (i / columns) * cellSize + 2.);
+		CControl* control = nullptr;
+		switch (i % 4)
+		{
+			case 0:
+				control = new CKnob (r, nullptr, -1, nullptr, nullptr, CPoint (),
+									 CKnob::kCoronaDrawing | CKnob::kHandleCircleDrawing);
+				break;
+			case 1: control = new CTextLabel (r, "-3.5 dB"); break;
+			case 2: control = new CTextButton (r, nullptr, -1, "On"); break;
+			case 3: control = new CCheckBox (r, nullptr, -1, "Sync"); break;
+		}
+		control->setValueNormalized ((i % 10) / 10.f);
+		container->addView (control);
+	}
+}
+
+//------------------------------------------------------------------------
+/** a headless frame with numControls controls, every operation repaints all of them */
+static std::function<void ()> makeViewTreeOperation (double scaleFactor, uint32_t numControls)
+{
+	X11::HeadlessFrameConfig config;
+	config.scaleFactor = scaleFactor;
+	auto frame = owned (new CFrame (CRect (0, 0, 800, 600), nullptr));
+	frame->setBackgroundColor (kGreyCColor);
+	auto container = new CViewContainer (CRect (0, 0, 800, 600));
+	container->setBackgroundColor (kWhiteCColor);
+	addControls (container, numControls);
+	frame->addView (container);
+	if (!frame->open (nullptr, PlatformType::kHeadless, &config))
+		return nullptr;
+	// close releases the frame, keep it alive while the operation exists
+	frame->remember ();
+	struct Closer
+	{
+		SharedPointer<CFrame> frame;
+		~Closer () noexcept { frame->close (); }
+	};
+	auto closer = std::make_shared<Closer> ();
+	closer->frame = frame;
+	auto platformFrame = dynamic_cast<X11::HeadlessFrame*> (frame->getPlatformFrame ());
+	if (!platformFrame)
+		return nullptr;
+	return [closer, platformFrame] () {
+		closer->frame->invalid ();
+		platformFrame->render ();
+	};
+}
+
+//------------------------------------------------------------------------
+static std::vector<Benchmark> makeBenchmarks (CFrame* frame, CBitmap* bitmap,
+											  CBitmap* ninePartBitmap)
+{
+	auto offscreen = [frame] (std::function<void (CDrawContext&, CPoint)> draw) {
+		return [frame, draw] (double scaleFactor) {
+			return makeOffscreenOperation (frame, scaleFactor, draw);
+		};
+	};
+	return {
+		{"rects", offscreen (GFXTest::drawRects)},
+		{"lines", offscreen (GFXTest::drawLines)},
+		{"ellipses", offscreen (GFXTest::drawEllipses)},
+		{"bitmaps", offscreen ([bitmap] (CDrawContext& context, CPoint size) {
+			 GFXTest::drawBitmaps (context, size, bitmap);
+		 })},
+		{"ninePartTiled", offscreen ([ninePartBitmap] (CDrawContext& context, CPoint size) {
+			 GFXTest::drawNinePartTiledBitmaps (context, size, ninePartBitmap);
+		 })},
+		{"gradients", offscreen (GFXTest::drawGradients)},
+		{"paths", offscreen (GFXTest::drawPaths)},
+		{"strings", offscreen (GFXTest::drawStrings)},
+		{"viewTree100", [] (double scaleFactor) { return makeViewTreeOperation (scaleFactor, 100); }},
+		{"viewTree300", [] (double scaleFactor) { return makeViewTreeOperation (scaleFactor, 300); }},
+	};
+}
+
+//------------------------------------------------------------------------
+static void writeJSON (std::ostream& stream, const std::vector<Result>& results,
+					   const Options& options)
+{
+	stream << "{\n  \"vstgui\": \"" << VSTGUI_VERSION_MAJOR << "." << VSTGUI_VERSION_MINOR
+		   << "\",\n  \"surface\": [" << surfaceSize.x << ", " << surfaceSize.y
+		   << "],\n  \"repetitions\": " << options.repetitions
+		   << ",\n  \"minTime\": " << options.minSeconds << ",\n  \"benchmarks\": [";
+	bool first = true;
+	for (const auto& result : results)
+	{
+		const auto& s = result.opsPerSecond;
+		stream << (first ? "\n" : ",\n") << "    {\"name\": \"" << result.name
+			   << "\", \"scale\": " << result.scaleFactor
+			   << ", \"operations\": " << result.operations << ", \"opsPerSecond\": {\"median\": "
+			   << s.median << ", \"mean\": " << s.mean << ", \"stddev\": " << s.stddev
+			   << ", \"min\": " << s.min << ", \"max\": " << s.max << "}}";
+		first = false;
+	}
+	stream << "\n  ]\n}\n";
+}
+
+//------------------------------------------------------------------------
+static bool parseOptions (int argc, char* argv[], Options& options)
+{
+	for (auto i = 1; i < argc; ++i)
+	{
+		auto hasValue = i + 1 < argc;
+		if (std::strcmp (argv[i], "--repetitions") == 0 && hasValue)
+			options.repetitions = std::max (1, std::atoi (argv[++i]));
+		else if (std::strcmp (argv[i], "--min-time") == 0 && hasValue)
+			options.minSeconds = std::max (0.001, std::atof (argv[++i]));
+		else if (std::strcmp (argv[i], "--filter") == 0 && hasValue)
+			options.filter = argv[++i];
+		else if (std::strcmp (argv[i], "--json") == 0 && hasValue)
+			options.jsonPath = argv[++i];
+		else
+		{
+			printf ("usage: %s [--repetitions N] [--min-time SECONDS] [--filter SUBSTRING] "
+					"[--json FILE|-]\n",
+					argv[0]);
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------
+int main (int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions (argc, argv, options))
+		return -1;
+
+	// the offscreen surfaces are created by this frame
+	auto frame = new CFrame (CRect (0, 0, surfaceSize.x, surfaceSize.y), nullptr);
+	if (!frame->open (nullptr, PlatformType::kHeadless))
+	{
+		printf ("could not open a headless frame\n");
+		frame->forget ();
+		return -1;
+	}
+
+	auto bitmap = GFXTest::createTestBitmap (CPoint (64, 64));
+	auto ninePartBitmap = GFXTest::createTestBitmap (CPoint (32, 32));
+	if (!bitmap || !ninePartBitmap)
+	{
+		printf ("could not create the bitmaps\n");
+		frame->close ();
+		return -1;
+	}
+
+	// the table goes to stderr when the JSON is written to stdout
+	auto table = options.jsonPath == "-" ? stderr : stdout;
+	std::vector<Result> results;
+	fprintf (table, "%-14s %5s %14s %14s %8s %14s\n", "benchmark", "scale", "median ops/s",
+			 "mean ops/s", "stddev", "min ops/s");
+	for (const auto& benchmark : makeBenchmarks (frame, bitmap, ninePartBitmap))
+	{
+		if (!options.filter.empty () && benchmark.name.find (options.filter) == std::string::npos)
+			continue;
+		for (auto scaleFactor : scaleFactors)
+		{
+			auto result = run (benchmark, scaleFactor, options);
+			if (result.operations == 0)
+			{
+				fprintf (table, "%-14s %4.0fx not supported\n", benchmark.name.data (), scaleFactor);
+				continue;
+			}
+			const auto& s = result.opsPerSecond;
+			fprintf (table, "%-14s %4.0fx %14.1f %14.1f %7.1f%% %14.1f\n", benchmark.name.data (),
+					 scaleFactor, s.median, s.mean, s.mean > 0. ? s.stddev / s.mean * 100. : 0.,
+					 s.min);
+			results.emplace_back (std::move (result));
+		}
+	}
+
+	frame->close ();
+
+	if (!options.jsonPath.empty ())
+	{
+		if (options.jsonPath == "-")
+			writeJSON (std::cout, results, options);
+		else
+		{
+			std::ofstream stream (options.jsonPath);
+			if (!stream)
+			{
+				printf ("could not write %s\n", options.jsonPath.data ());
+				return -1;
+			}
+			writeJSON (stream, results, options);
+		}
+	}
+	return 0;
+}
@@ -3,6 +3,7 @@
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
 #include "drawdevicetests.h"
+#include "drawroutines.h"
 #include "vstgui/lib/cbitmap.h"
 #include "vstgui/lib/cbitmapfilter.h"
 #include "vstgui/lib/cfileselector.h"
@@ -107,100 +108,6 @@ private:
 	DrawFunction func;
 };
 
-//------------------------------------------------------------------------
-void drawRects (CDrawContext& context, CPoint size)
-{
-	context.setDrawMode (kAliasing);
-	context.setFillColor (MakeCColor (0, 0, 0, 100));
-	context.drawRect (CRect ().setSize (size), kDrawFilled);
-
-	//--
-	context.setDrawMode (kAliasing);
-	context.setFrameColor (kBlackCColor);
-	context.setLineStyle (kLineSolid);
-	context.setLineWidth (1);
-	context.drawRect (CRect (5, 5, 10, 10), kDrawStroked);
-	context.setFrameColor (MakeCColor (0, 0, 0, 150));
-	context.drawLine ({10, 5}, {25, 5});
-	context.drawLine ({5, 10}, {5, 25});
-	//--
-	context.setDrawMode (kAliasing);
-	auto hairline = context.getHairlineSize ();
-	CRect r2 (40, 5, 50, 15);
-	context.setLineWidth (5);
-	context.setFrameColor (CColor (0, 0, 255, 100));
-	context.drawRect (r2);
-	context.setLineWidth (3);
-	context.setFrameColor (CColor (255, 0, 0, 100));
-	context.drawRect (r2);
-	context.setLineWidth (1);
-	context.setFrameColor (CColor (0, 255, 0, 100));
-	context.drawRect (r2);
-	//--
-	r2 = {60, 5, 70, 15};
-	context.setLineWidth (hairline);
-	context.setFrameColor (CColor (0, 255, 0, 200));
-	context.drawRect (r2);
-	r2.inset (hairline, hairline);
-	context.setFrameColor (CColor (255, 0, 0, 200));
-	context.drawRect (r2);
-	r2.inset (hairline, hairline);
-	context.setFrameColor (CColor (0, 0, 255, 200));
-	context.drawRect (r2);
-	//--
-	CRect r {5, 50, 0, 0};
-	r.setSize ({20, 20});
-	context.setLineWidth (1);
-	context.setDrawMode (kAliasing);
-	context.setFillColor (MakeCColor (255, 0, 0, 255));
-	context.drawRect (r, kDrawFilled);
-	context.setFillColor (MakeCColor (0, 0, 0, 200));
-	context.drawEllipse (r, kDrawFilled);
-	context.setFrameColor (CColor (0, 255, 0, 100));
-	context.drawRect (r, kDrawStroked);
-	//--
-	r = {50, 50, 80, 80};
-	context.setDrawMode (kAliasing);
-	context.setLineWidth (1);
-	context.setFrameColor (CColor (0, 255, 255, 100));
-	context.drawLine (r.getTopLeft (), r.getTopRight ());
-	context.drawLine (r.getBottomLeft (), r.getBottomRight ());
-	r.inset (10, -10);
-	context.drawLine (r.getTopRight (), r.getBottomRight ());
-	context.drawLine (r.getTopLeft (), r.getBottomLeft ());
-	r.left++;
-	r.top += 11;
-	r.bottom -= 10;
-	context.setFillColor (CColor (255, 0, 0, 100));
-	context.drawRect (r, kDrawFilled);
-	//--
-	r = {90, 90, 120, 120};
-	context.setDrawMode (kAliasing);
-	context.setLineWidth (1);
-	context.setFrameColor (CColor (0, 0, 255, 100));
-	context.setFillColor (CColor (255, 0, 0, 100));
-	context.drawEllipse (r, kDrawFilledAndStroked);
-	r.offset (40, 0);
-	context.setDrawMode (kAntiAliasing);
-	context.drawEllipse (r, kDrawFilledAndStroked);
-	//--
-	r = {90, 130, 120, 160};
-	context.setDrawMode (kAliasing);
-	context.setLineWidth (1);
-	context.setFrameColor (CColor (0, 0, 255, 100));
-	context.setFillColor (CColor (255, 0, 0, 100));
-	context.drawEllipse (r, kDrawFilled);
-	r2 = r;
-	r2.extend (1, 1);
-	context.drawEllipse (r2, kDrawStroked);
-	r.offset (40, 0);
-	context.setDrawMode (kAntiAliasing);
-	context.drawEllipse (r, kDrawFilled);
-	r2 = r;
-	r2.extend (1, 1);
-	context.drawEllipse (r2, kDrawStroked);
-}
-
 //------------------------------------------------------------------------
 void drawBitmapFilter (CustomDrawView* view, CDrawContext& context, CPoint size)
 {
@@ -330,7 +237,8 @@ public:
 		{
 			if (*customViewName == "RectsView")
 			{
-				return new CustomDrawView ([] (auto view, auto& ctx, auto size) { drawRects (ctx, size); });
+				return new CustomDrawView (
+				    [] (auto view, auto& ctx, auto size) { GFXTest::drawRects (ctx, size); });
 			}
 			if (*customViewName == "BitmapsFilterView")
 			{
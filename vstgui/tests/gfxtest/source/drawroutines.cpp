@@ -0,0 +1,277 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "drawroutines.h"
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/lib/cdrawcontext.h"
+#include "vstgui/lib/cgradient.h"
+#include "vstgui/lib/cgraphicspath.h"
+#include "vstgui/lib/cstring.h"
+#include <cmath>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace GFXTest {
+
+//------------------------------------------------------------------------
+void drawRects (CDrawContext& context, CPoint size)
+{
+	context.setDrawMode (kAliasing);
+	context.setFillColor (MakeCColor (0, 0, 0, 100));
+	context.drawRect (CRect ().setSize (size), kDrawFilled);
+
+	//--
+	context.setDrawMode (kAliasing);
+	context.setFrameColor (kBlackCColor);
+	context.setLineStyle (kLineSolid);
+	context.setLineWidth (1);
+	context.drawRect (CRect (5, 5, 10, 10), kDrawStroked);
+	context.setFrameColor (MakeCColor (0, 0, 0, 150));
+	context.drawLine ({10, 5}, {25, 5});
+	context.drawLine ({5, 10}, {5, 25});
+	//--
+	context.setDrawMode (kAliasing);
+	auto hairline = context.getHairlineSize ();
+	CRect r2 (40, 5, 50, 15);
+	context.setLineWidth (5);
+	context.setFrameColor (CColor (0, 0, 255, 100));
+	context.drawRect (r2);
+	context.setLineWidth (3);
+	context.setFrameColor (CColor (255, 0, 0, 100));
+	context.drawRect (r2);
+	context.setLineWidth (1);
+	context.setFrameColor (CColor (0, 255, 0, 100));
+	context.drawRect (r2);
+	//--
+	r2 = {60, 5, 70, 15};
+	context.setLineWidth (hairline);
+	context.setFrameColor (CColor (0, 255, 0, 200));
+	context.drawRect (r2);
+	r2.inset (hairline, hairline);
+	context.setFrameColor (CColor (255, 0, 0, 200));
+	context.drawRect (r2);
+	r2.inset (hairline, hairline);
+	context.setFrameColor (CColor (0, 0, 255, 200));
+	context.drawRect (r2);
+	//--
+	CRect r {5, 50, 0, 0};
+	r.setSize ({20, 20});
+	context.setLineWidth (1);
+	context.setDrawMode (kAliasing);
+	context.setFillColor (MakeCColor (255, 0, 0, 255));
+	context.drawRect (r, kDrawFilled);
+	context.setFillColor (MakeCColor (0, 0, 0, 200));
+	context.drawEllipse (r, kDrawFilled);
+	context.setFrameColor (CColor (0, 255, 0, 100));
+	context.drawRect (r, kDrawStroked);
+	//--
+	r = {50, 50, 80, 80};
+	context.setDrawMode (kAliasing);
+	context.setLineWidth (1);
+	context.setFrameColor (CColor (0, 255, 255, 100));
+	context.drawLine (r.getTopLeft (), r.getTopRight ());
+	context.drawLine (r.getBottomLeft (), r.getBottomRight ());
+	r.inset (10, -10);
+	context.drawLine (r.getTopRight (), r.getBottomRight ());
+	context.drawLine (r.getTopLeft (), r.getBottomLeft ());
+	r.left++;
+	r.top += 11;
+	r.bottom -= 10;
+	context.setFillColor (CColor (255, 0, 0, 100));
+	context.drawRect (r, kDrawFilled);
+	//--
+	r = {90, 90, 120, 120};
+	context.setDrawMode (kAliasing);
+	context.setLineWidth (1);
+	context.setFrameColor (CColor (0, 0, 255, 100));
+	context.setFillColor (CColor (255, 0, 0, 100));
+	context.drawEllipse (r, kDrawFilledAndStroked);
+	r.offset (40, 0);
+	context.setDrawMode (kAntiAliasing);
+	context.drawEllipse (r, kDrawFilledAndStroked);
+	//--
+	r = {90, 130, 120, 160};
+	context.setDrawMode (kAliasing);
+	context.setLineWidth (1);
+	context.setFrameColor (CColor (0, 0, 255, 100));
+	context.setFillColor (CColor (255, 0, 0, 100));
+	context.drawEllipse (r, kDrawFilled);
+	r2 = r;
+	r2.extend (1, 1);
+	context.drawEllipse (r2, kDrawStroked);
+	r.offset (40, 0);
+	context.setDrawMode (kAntiAliasing);
+	context.drawEllipse (r, kDrawFilled);
+	r2 = r;
+	r2.extend (1, 1);
+	context.drawEllipse (r2, kDrawStroked);
+}
+
+//------------------------------------------------------------------------
+void drawLines (CDrawContext& context, CPoint size)
+{
+	context.setLineWidth (1);
+	context.setLineStyle (kLineSolid);
+	context.setDrawMode (kAliasing);
+	context.setFrameColor (CColor (0, 0, 0, 200));
+	for (auto x = 0.; x < size.x; x += 8.)
+		context.drawLine ({x, 0}, {size.x - x, size.y});
+
+	context.setDrawMode (kAntiAliasing);
+	context.setFrameColor (CColor (0, 0, 255, 150));
+	context.setLineWidth (2);
+	CDrawContext::LineList lines;
+	for (auto y = 0.; y < size.y; y += 8.)
+		lines.emplace_back (CPoint (0, y), CPoint (size.x, size.y - y));
+	context.drawLines (lines);
+
+	context.setLineStyle (kLineOnOffDash);
+	context.setFrameColor (CColor (255, 0, 0, 150));
+	context.drawPolygon ({{10, 10}, {size.x - 10, 20}, {size.x / 2, size.y - 10}, {10, 10}});
+}
+
+//------------------------------------------------------------------------
+void drawEllipses (CDrawContext& context, CPoint size)
+{
+	context.setLineWidth (1);
+	context.setLineStyle (kLineSolid);
+	context.setFrameColor (CColor (0, 0, 255, 100));
+	context.setFillColor (CColor (255, 0, 0, 100));
+	auto index = 0u;
+	for (auto y = 0.; y + 30. <= size.y; y += 30.)
+	{
+		for (auto x = 0.; x + 30. <= size.x; x += 30., ++index)
+		{
+			context.setDrawMode (index % 2 ? kAntiAliasing : kAliasing);
+			CRect r (x, y, x + 28., y + 28.);
+			if (index % 3 == 0)
+				context.drawArc (r, 0.f, 270.f, kDrawFilledAndStroked);
+			else
+				context.drawEllipse (r, index % 3 == 1 ? kDrawFilled : kDrawFilledAndStroked);
+		}
+	}
+}
+
+//------------------------------------------------------------------------
+void drawBitmaps (CDrawContext& context, CPoint size, CBitmap* bitmap)
+{
+	auto bitmapSize = bitmap->getSize ();
+	auto index = 0u;
+	for (auto y = 0.; y < size.y; y += bitmapSize.y)
+	{
+		for (auto x = 0.; x < size.x; x += bitmapSize.x, ++index)
+		{
+			CRect r (x, y, x + bitmapSize.x, y + bitmapSize.y);
+			// every other bitmap uses the offset and alpha paths of the platforms
+			if (index % 2)
+				context.drawBitmap (bitmap, r, CPoint (2, 2), 0.5f);
+			else
+				context.drawBitmap (bitmap, r);
+		}
+	}
+}
+
+//------------------------------------------------------------------------
+void drawNinePartTiledBitmaps (CDrawContext& context, CPoint size, CBitmap* bitmap)
+{
+	auto bitmapSize = bitmap->getSize ();
+	CNinePartTiledDescription desc (bitmapSize.x / 4., bitmapSize.y / 4., bitmapSize.x / 4.,
+									bitmapSize.y / 4.);
+	CRect r (0, 0, size.x, size.y);
+	for (auto i = 0; i < 4; ++i)
+	{
+		context.drawBitmapNinePartTiled (bitmap, r, desc);
+		r.inset (size.x / 10., size.y / 10.);
+	}
+}
+
+//------------------------------------------------------------------------
+void drawGradients (CDrawContext& context, CPoint size)
+{
+	auto gradient = owned (CGradient::create (0., 1., kRedCColor, CColor (0, 0, 255, 128)));
+	gradient->addColorStop (0.5, kGreenCColor);
+	CRect r (0, 0, size.x / 2., size.y / 2.);
+	for (auto i = 0; i < 4; ++i)
+	{
+		auto path = owned (context.createRoundRectGraphicsPath (r, 8.));
+		if (!path)
+			return;
+		if (i % 2)
+			context.fillRadialGradient (path, *gradient, r.getCenter (), r.getWidth () / 2.);
+		else
+			context.fillLinearGradient (path, *gradient, r.getTopLeft (), r.getBottomRight ());
+		r.offset (i % 2 ? -r.getWidth () : r.getWidth (), i % 2 ? r.getHeight () : 0.);
+	}
+}
+
+//------------------------------------------------------------------------
+void drawPaths (CDrawContext& context, CPoint size)
+{
+	auto path = owned (context.createGraphicsPath ());
+	if (!path)
+		return;
+	path->beginSubpath (0, size.y / 2.);
+	constexpr auto numSegments = 32;
+	auto segmentWidth = size.x / numSegments;
+	for (auto i = 0; i < numSegments; ++i)
+	{
+		auto x = i * segmentWidth;
+		auto amplitude = (i % 2 ? 1. : -1.) * size.y / 3.;
+		path->addBezierCurve (x + segmentWidth / 3., size.y / 2. + amplitude,
+							  x + segmentWidth * 2. / 3., size.y / 2. - amplitude,
+							  x + segmentWidth, size.y / 2.);
+	}
+	path->addEllipse (CRect (size.x / 4., size.y / 4., size.x * 3. / 4., size.y * 3. / 4.));
+	path->addRect (CRect (10, 10, size.x - 10, size.y - 10));
+
+	context.setDrawMode (kAntiAliasing);
+	context.setFillColor (CColor (0, 128, 0, 100));
+	context.drawGraphicsPath (path, CDrawContext::kPathFilledEvenOdd);
+	context.setLineWidth (2);
+	context.setFrameColor (kBlackCColor);
+	context.drawGraphicsPath (path, CDrawContext::kPathStroked);
+}
+
+//------------------------------------------------------------------------
+void drawStrings (CDrawContext& context, CPoint size)
+{
+	static const char* strings[] = {"VSTGUI", "Cutoff 440.0 Hz", "Resonance 0.25", "-12.5 dB",
+									"The quick brown fox jumps over the lazy dog"};
+	context.setFont (kNormalFont);
+	context.setFontColor (kBlackCColor);
+	context.setDrawMode (kAntiAliasing);
+	auto lineHeight = kNormalFont->getSize () + 4.;
+	auto index = 0u;
+	for (auto y = 0.; y + lineHeight <= size.y; y += lineHeight, ++index)
+	{
+		CRect r (0, y, size.x, y + lineHeight);
+		auto align = index % 3 == 0 ? kLeftText : index % 3 == 1 ? kCenterText : kRightText;
+		context.drawString (strings[index % 5], r, align);
+	}
+}
+
+//------------------------------------------------------------------------
+SharedPointer<CBitmap> createTestBitmap (CPoint size)
+{
+	auto bitmap = makeOwned<CBitmap> (size);
+	auto accessor = owned (CBitmapPixelAccess::create (bitmap));
+	if (!accessor)
+		return nullptr;
+	auto width = static_cast<uint32_t> (size.x);
+	auto height = static_cast<uint32_t> (size.y);
+	for (auto y = 0u; y < height; ++y)
+	{
+		for (auto x = 0u; x < width; ++x)
+		{
+			accessor->setPosition (x, y);
+			accessor->setColor (CColor (static_cast<uint8_t> (x * 4), static_cast<uint8_t> (y * 4),
+										static_cast<uint8_t> (x ^ y), 128 + (x + y) % 128));
+		}
+	}
+	return bitmap;
+}
+
+//------------------------------------------------------------------------
+} // GFXTest
+} // VSTGUI
@@ -0,0 +1,32 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "vstgui/lib/cpoint.h"
+#include "vstgui/lib/vstguifwd.h"
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace GFXTest {
+
+//------------------------------------------------------------------------
+// draw routines shared by the gfxtest application and the gfxspeed benchmark. They only use the
+// passed context, so they can draw into a view as well as into an offscreen context.
+
+void drawRects (CDrawContext& context, CPoint size);
+void drawLines (CDrawContext& context, CPoint size);
+void drawEllipses (CDrawContext& context, CPoint size);
+void drawBitmaps (CDrawContext& context, CPoint size, CBitmap* bitmap);
+void drawNinePartTiledBitmaps (CDrawContext& context, CPoint size, CBitmap* bitmap);
+void drawGradients (CDrawContext& context, CPoint size);
+void drawPaths (CDrawContext& context, CPoint size);
+void drawStrings (CDrawContext& context, CPoint size);
+
+/** a bitmap with a pixel pattern and varying alpha */
+SharedPointer<CBitmap> createTestBitmap (CPoint size);
+
+//------------------------------------------------------------------------
+} // GFXTest
+} // VSTGUI
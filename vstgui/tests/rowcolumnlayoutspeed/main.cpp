@@ -0,0 +1,117 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/crowcolumnview.h"
+#include "vstgui/uidescription/uidescription.h"
+#include "vstgui/uidescription/xmlparser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+static constexpr CCoord kRowHeight = 20.;
+
+//------------------------------------------------------------------------
+// a row column view counting its layouts
+class PresetListView : public CRowColumnView
+{
+public:
+	explicit PresetListView (uint32_t numRows)
+	: CRowColumnView (CRect (0, 0, 400, numRows * kRowHeight), kRowStyle, kStretchEqualy)
+	{
+	}
+
+	void layoutViews () override
+	{
+		++numLayouts;
+		CRowColumnView::layoutViews ();
+	}
+
+	uint32_t numLayouts {0};
+};
+
+//------------------------------------------------------------------------
+// creates a description with a template of a row column view with numRows preset rows
+static std::string createDescription (uint32_t numRows)
+{
+	std::string xml;
+	xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	xml += "<vstgui-ui-description version=\"1\">\n";
+	xml += "\t<template class=\"CRowColumnView\" name=\"presets\" origin=\"0, 0\" size=\"400, " +
+	       std::to_string (numRows * kRowHeight) +
+	       "\" row-style=\"true\" equal-size-layout=\"stretch\">\n";
+	for (auto i = 0u; i < numRows; ++i)
+		xml += "\t\t<view class=\"CView\" origin=\"0, 0\" size=\"400, 20\"/>\n";
+	xml += "\t</template>\n";
+	xml += "</vstgui-ui-description>\n";
+	return xml;
+}
+
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measureMilliseconds (Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	proc ();
+	std::chrono::duration<double, std::milli> duration = Clock::now () - start;
+	return duration.count ();
+}
+
+//------------------------------------------------------------------------
+// fills a preset list which is already shown, like a preset browser does when the folder changes
+static double populate (CFrame* frame, uint32_t numRows, bool batched, uint32_t& numLayouts)
+{
+	auto list = new PresetListView (numRows);
+	frame->addView (list);
+	list->numLayouts = 0;
+	auto time = measureMilliseconds ([&] () {
+		if (batched)
+			list->beginLayoutUpdates ();
+		for (auto i = 0u; i < numRows; ++i)
+			list->addView (new CView (CRect (0, 0, 400, kRowHeight)));
+		if (batched)
+			list->endLayoutUpdates ();
+	});
+	numLayouts = list->numLayouts;
+	frame->removeView (list);
+	return time;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numRows = 5000;
+
+	auto frame = makeOwned<CFrame> (CRect (0, 0, 400, 400), nullptr);
+	frame->attached (frame);
+
+	uint32_t numLayouts = 0;
+	printf ("%u rows\n", numRows);
+	auto time = populate (frame, numRows, false, numLayouts);
+	printf ("populate shown list:          %10.2f ms (%u layouts)\n", time, numLayouts);
+	time = populate (frame, numRows, true, numLayouts);
+	printf ("populate shown list, batched: %10.2f ms (%u layouts)\n", time, numLayouts);
+
+	auto xml = createDescription (numRows);
+	Xml::MemoryContentProvider provider (xml.data (), static_cast<uint32_t> (xml.size ()));
+	UIDescription desc (&provider);
+	if (!desc.parse ())
+		return -1;
+	CView* view = nullptr;
+	time = measureMilliseconds ([&] () {
+		view = desc.createView ("presets", nullptr);
+		if (view)
+			frame->addView (view);
+	});
+	if (!view)
+		return -1;
+	printf ("create and attach template:   %10.2f ms\n", time);
+	frame->removeView (view);
+	return 0;
+}
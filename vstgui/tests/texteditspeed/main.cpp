@@ -0,0 +1,92 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/lib/controls/ctextedit.h"
+#include "vstgui/lib/platform/common/generictextedit.h"
+#include "vstgui/lib/vstkeycode.h"
+
+#if LINUX
+#include "vstgui/lib/platform/linux/x11platform.h"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using namespace VSTGUI;
+
+#if LINUX
+//------------------------------------------------------------------------
+// the generic text edit starts a caret blink timer, which needs a run loop on X11. The X11 platform
+// still connects to the X server, so this benchmark needs a display (i.e. Xvfb)
+struct NoopRunLoop : X11::IRunLoop, AtomicReferenceCounted
+{
+	bool registerEventHandler (int fd, X11::IEventHandler* handler) override { return true; }
+	bool unregisterEventHandler (X11::IEventHandler* handler) override { return true; }
+	bool registerTimer (uint64_t interval, X11::ITimerHandler* handler) override { return true; }
+	bool unregisterTimer (X11::ITimerHandler* handler) override { return true; }
+};
+#endif
+
+//------------------------------------------------------------------------
+static VstKeyCode makeVirtualKey (unsigned char virt)
+{
+	VstKeyCode key {};
+	key.virt = virt;
+	return key;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+#if LINUX
+	X11::RunLoop::init (makeOwned<NoopRunLoop> ());
+#endif
+	constexpr auto numChars = 10000;
+	constexpr auto numKeyStrokes = 1000;
+
+	{
+		auto frame = owned (new CFrame (CRect (0, 0, 1000, 100), nullptr));
+		auto textEdit = new CTextEdit (CRect (0, 0, 1000, 20), nullptr, -1);
+		frame->addView (textEdit);
+		frame->attached (frame);
+
+		std::string text;
+		for (auto i = 0; i < numChars; ++i)
+			text += static_cast<char> ('a' + (i % 26));
+
+		auto edit = makeOwned<GenericTextEdit> (textEdit);
+		edit->setText (text.data ());
+
+		// move the cursor to the end, the edit starts with everything selected
+		auto endKey = makeVirtualKey (VKEY_END);
+		frame->onKeyDown (endKey);
+
+		// the virtual space key is converted without the platform frame
+		auto spaceKey = makeVirtualKey (VKEY_SPACE);
+		auto backKey = makeVirtualKey (VKEY_BACK);
+
+		auto start = std::chrono::high_resolution_clock::now ();
+		for (auto i = 0; i < numKeyStrokes; ++i)
+		{
+			frame->onKeyDown (spaceKey);
+			frame->onKeyDown (backKey);
+		}
+		auto end = std::chrono::high_resolution_clock::now ();
+
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds> (end - start);
+		printf ("Typing into a %d character field: %d key strokes in %lld us (%.2f us per key)\n",
+		        numChars, numKeyStrokes * 2, static_cast<long long> (duration.count ()),
+		        static_cast<double> (duration.count ()) / (numKeyStrokes * 2));
+
+		edit = nullptr;
+		frame->removeAll ();
+	}
+
+#if LINUX
+	X11::RunLoop::exit ();
+#endif
+	return 0;
+}
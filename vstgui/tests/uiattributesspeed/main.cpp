@@ -0,0 +1,186 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/uidescription/cstream.h"
+#include "vstgui/uidescription/uiattributes.h"
+#include "vstgui/uidescription/xmlparser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+// counts the bytes of all live heap allocations
+static size_t liveBytes = 0;
+
+void* operator new (size_t size)
+{
+	auto ptr = static_cast<size_t*> (std::malloc (size + sizeof (max_align_t)));
+	if (!ptr)
+		throw std::bad_alloc ();
+	*ptr = size;
+	liveBytes += size;
+	return reinterpret_cast<uint8_t*> (ptr) + sizeof (max_align_t);
+}
+
+void operator delete (void* ptr) noexcept
+{
+	if (!ptr)
+		return;
+	auto block = reinterpret_cast<size_t*> (static_cast<uint8_t*> (ptr) - sizeof (max_align_t));
+	liveBytes -= *block;
+	std::free (block);
+}
+
+void operator delete (void* ptr, size_t) noexcept
+{
+	operator delete (ptr);
+}
+
+//------------------------------------------------------------------------
+// collects the attributes of every element of the description
+struct AttributeCollector : Xml::IHandler
+{
+	using Attributes = std::vector<std::pair<std::string, std::string>>;
+
+	void startXmlElement (Xml::Parser*, IdStringPtr, UTF8StringPtr* attributes) override
+	{
+		Attributes element;
+		for (auto i = 0; attributes[i] && attributes[i + 1]; i += 2)
+			element.emplace_back (attributes[i], attributes[i + 1]);
+		elements.emplace_back (std::move (element));
+	}
+	void endXmlElement (Xml::Parser*, IdStringPtr) override {}
+	void xmlCharData (Xml::Parser*, const int8_t*, int32_t) override {}
+	void xmlComment (Xml::Parser*, IdStringPtr) override {}
+
+	std::vector<Attributes> elements;
+};
+
+// the previous storage of UIAttributes
+using AttributesMap = std::unordered_map<std::string, std::string>;
+
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measureMilliseconds (uint32_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+		proc ();
+	std::chrono::duration<double, std::milli> duration = Clock::now () - start;
+	return duration.count () / repetitions;
+}
+
+//------------------------------------------------------------------------
+int main (int argc, char* argv[])
+{
+	constexpr uint32_t repetitions = 2000;
+	auto fileName = argc > 1 ? argv[1] : UIDESC_FILE;
+
+	AttributeCollector collector;
+	{
+		CFileStream stream;
+		if (!stream.open (fileName, CFileStream::kReadMode))
+		{
+			printf ("could not open %s\n", fileName);
+			return -1;
+		}
+		Xml::InputStreamContentProvider provider (stream);
+		Xml::Parser parser;
+		if (!parser.parse (&provider, &collector))
+			return -1;
+	}
+	size_t numAttributes = 0;
+	for (auto& element : collector.elements)
+		numAttributes += element.size ();
+
+	// names the view creators and UIDescription look up for every node
+	const std::vector<std::string> lookupNames = {
+		"class", "name", "origin", "size", "control-tag", "font", "font-color",
+		"background-color", "transparent", "bitmap", "title", "custom-view-name"};
+	std::vector<UIAttributeName> lookupAtoms;
+	for (auto& name : lookupNames)
+		lookupAtoms.emplace_back (name);
+
+	auto bytesBefore = liveBytes;
+	std::vector<std::unique_ptr<AttributesMap>> maps;
+	maps.reserve (collector.elements.size ());
+	for (auto& element : collector.elements)
+	{
+		maps.emplace_back (new AttributesMap);
+		for (auto& a : element)
+			maps.back ()->emplace (a.first, a.second);
+	}
+	auto mapBytes = liveBytes - bytesBefore;
+
+	// created the way the parser creates them
+	std::vector<std::vector<UTF8StringPtr>> attributeArrays;
+	for (auto& element : collector.elements)
+	{
+		std::vector<UTF8StringPtr> array;
+		for (auto& a : element)
+		{
+			array.emplace_back (a.first.data ());
+			array.emplace_back (a.second.data ());
+		}
+		array.emplace_back (nullptr);
+		attributeArrays.emplace_back (std::move (array));
+	}
+	bytesBefore = liveBytes;
+	std::vector<SharedPointer<UIAttributes>> attributes;
+	attributes.reserve (collector.elements.size ());
+	for (auto& array : attributeArrays)
+		attributes.emplace_back (makeOwned<UIAttributes> (array.data ()));
+	auto attributesBytes = liveBytes - bytesBefore;
+
+	size_t found = 0;
+	auto mapTime = measureMilliseconds (repetitions, [&] () {
+		for (auto& map : maps)
+		{
+			for (auto& name : lookupNames)
+				found += map->find (name) != map->end ();
+		}
+	});
+	auto stringTime = measureMilliseconds (repetitions, [&] () {
+		for (auto& attr : attributes)
+		{
+			for (auto& name : lookupNames)
+				found += attr->getAttributeValue (name) != nullptr;
+		}
+	});
+	auto atomTime = measureMilliseconds (repetitions, [&] () {
+		for (auto& attr : attributes)
+		{
+			for (auto& name : lookupAtoms)
+				found += attr->getAttributeValue (name) != nullptr;
+		}
+	});
+	if (found == 0)
+		return -1;
+
+	auto numElements = collector.elements.size ();
+	auto numLookups = static_cast<double> (numElements * lookupNames.size ());
+	printf ("%zu elements, %zu attributes (%.1f per element)\n", numElements, numAttributes,
+	        static_cast<double> (numAttributes) / numElements);
+	printf ("memory unordered_map:        %8zu bytes (%6.1f per element)\n",
+	        mapBytes + numElements * sizeof (AttributesMap),
+	        static_cast<double> (mapBytes) / numElements + sizeof (AttributesMap));
+	printf ("memory UIAttributes:         %8zu bytes (%6.1f per element)\n", attributesBytes,
+	        static_cast<double> (attributesBytes) / numElements);
+	printf ("lookup unordered_map:        %8.3f ms (%6.1f ns per lookup)\n", mapTime,
+	        mapTime * 1000000. / numLookups);
+	printf ("lookup UIAttributes string:  %8.3f ms (%6.1f ns per lookup)\n", stringTime,
+	        stringTime * 1000000. / numLookups);
+	printf ("lookup UIAttributes atom:    %8.3f ms (%6.1f ns per lookup)\n", atomTime,
+	        atomTime * 1000000. / numLookups);
+	return 0;
+}
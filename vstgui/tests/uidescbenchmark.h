@@ -0,0 +1,128 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "vstgui/uidescription/base64codec.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// shared helpers of the uidesc*speed benchmarks
+
+namespace VSTGUI {
+namespace UIDescBenchmark {
+
+//------------------------------------------------------------------------
+struct DescriptionSpec
+{
+	using NodeFunc = std::function<std::string (uint32_t index)>;
+
+	uint32_t numBitmaps {0};
+	/** returns the base64 encoded data of the bitmap */
+	NodeFunc bitmapData;
+	/** returns additional child nodes of the bitmap, e.g. filters */
+	NodeFunc bitmapChildren;
+	/** split the bitmap data into lines of 82 characters like UIDescription writes it */
+	bool wrapBitmapData {false};
+
+	uint32_t numViews {0};
+	/** returns the view node at the template level, a text label if not set */
+	NodeFunc view;
+};
+
+//------------------------------------------------------------------------
+/** creates a generator of bitmapDataSize random bytes which use only the lower entropyBits */
+inline DescriptionSpec::NodeFunc randomBitmapData (size_t bitmapDataSize,
+                                                   uint32_t entropyBits = 8)
+{
+	auto rbe = std::make_shared<
+	    std::independent_bits_engine<std::default_random_engine, 16, uint16_t>> ();
+	auto mask = static_cast<uint16_t> ((1u << entropyBits) - 1);
+	return [=] (uint32_t) {
+		std::vector<uint8_t> data (bitmapDataSize);
+		std::generate (data.begin (), data.end (),
+		               [&] () { return static_cast<uint8_t> ((*rbe) () & mask); });
+		auto encoded = Base64Codec::encode (data.data (), static_cast<uint32_t> (data.size ()));
+		return std::string (reinterpret_cast<const char*> (encoded.data.get ()),
+		                    encoded.dataSize);
+	};
+}
+
+//------------------------------------------------------------------------
+inline std::string textLabelView (uint32_t index)
+{
+	return "\t\t<view class=\"CTextLabel\" origin=\"" + std::to_string (index % 800) +
+	       ", 0\" size=\"100, 20\" title=\"label " + std::to_string (index) + "\"/>\n";
+}
+
+//------------------------------------------------------------------------
+inline std::string createDescription (const DescriptionSpec& spec)
+{
+	std::string xml;
+	xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	xml += "<vstgui-ui-description version=\"1\">\n";
+	xml += "\t<bitmaps>\n";
+	for (auto i = 0u; i < spec.numBitmaps; ++i)
+	{
+		auto encoded = spec.bitmapData (i);
+		if (encoded.empty ())
+			return {};
+		if (i == 0)
+			xml.reserve (spec.numBitmaps * encoded.size () * 11 / 10);
+		xml += "\t\t<bitmap name=\"bitmap" + std::to_string (i) + "\" path=\"bitmap" +
+		       std::to_string (i) + ".png\">\n";
+		xml += "\t\t\t<data encoding=\"base64\">\n";
+		if (spec.wrapBitmapData)
+		{
+			for (size_t pos = 0; pos < encoded.size (); pos += 82)
+			{
+				xml += "\t\t\t\t";
+				xml.append (encoded, pos, 82);
+				xml += "\n";
+			}
+		}
+		else
+		{
+			xml += encoded;
+			xml += "\n";
+		}
+		xml += "\t\t\t</data>\n";
+		if (spec.bitmapChildren)
+			xml += spec.bitmapChildren (i);
+		xml += "\t\t</bitmap>\n";
+	}
+	xml += "\t</bitmaps>\n";
+	xml += "\t<template class=\"CViewContainer\" name=\"view\" origin=\"0, 0\" size=\"800, 600\">\n";
+	for (auto i = 0u; i < spec.numViews; ++i)
+		xml += spec.view ? spec.view (i) : textLabelView (i);
+	xml += "\t</template>\n";
+	xml += "</vstgui-ui-description>\n";
+	return xml;
+}
+
+//------------------------------------------------------------------------
+/** returns the average duration of proc in milliseconds or -1 if proc returned false */
+template <typename Proc>
+inline double measureMilliseconds (uint32_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+	{
+		if (!proc ())
+			return -1.;
+	}
+	std::chrono::duration<double, std::milli> duration = Clock::now () - start;
+	return duration.count () / repetitions;
+}
+
+//------------------------------------------------------------------------
+} // UIDescBenchmark
+} // VSTGUI
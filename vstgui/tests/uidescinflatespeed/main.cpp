@@ -0,0 +1,128 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cresourcedescription.h"
+#include "vstgui/uidescription/compresseduidescription.h"
+#include "vstgui/uidescription/cstream.h"
+#include "../uidescbenchmark.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if WINDOWS
+#include <direct.h>
+#define getcwd _getcwd
+#else
+#include <unistd.h>
+#endif
+
+using namespace VSTGUI;
+using UIDescBenchmark::measureMilliseconds;
+
+//------------------------------------------------------------------------
+// creates a description with numBitmaps embedded bitmaps of low entropy data and a template with
+// numViews views
+static std::string createDescription (uint32_t numBitmaps, size_t bitmapDataSize, uint32_t numViews)
+{
+	UIDescBenchmark::DescriptionSpec spec;
+	spec.numBitmaps = numBitmaps;
+	spec.bitmapData = UIDescBenchmark::randomBitmapData (bitmapDataSize, 4);
+	spec.numViews = numViews;
+	return UIDescBenchmark::createDescription (spec);
+}
+
+//------------------------------------------------------------------------
+static size_t getFileSize (const std::string& path)
+{
+	CMemoryMappedFile file;
+	return file.open (path.data ()) ? file.size () : 0;
+}
+
+//------------------------------------------------------------------------
+static double measureParse (const std::string& path, bool useMemoryMapping, uint32_t repetitions)
+{
+	return measureMilliseconds (repetitions, [&] () {
+		CompressedUIDescription desc (CResourceDescription (path.data ()));
+		desc.setUseMemoryMapping (useMemoryMapping);
+		return desc.parse ();
+	});
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numBitmaps = 16;
+	constexpr size_t bitmapDataSize = 1024 * 1024;
+	constexpr uint32_t numViews = 2000;
+	constexpr uint32_t repetitions = 5;
+
+	// memory mapping is only used for absolute paths
+	char cwd[4096];
+	if (!getcwd (cwd, sizeof (cwd)))
+		return -1;
+	std::string directory (cwd);
+	unixfyPath (directory);
+	directory += "/";
+
+	auto xmlPath = directory + "uidescinflatespeed.uidesc";
+	{
+		auto xml = createDescription (numBitmaps, bitmapDataSize, numViews);
+		CFileStream stream;
+		if (!stream.open (xmlPath.data (), CFileStream::kWriteMode | CFileStream::kTruncateMode))
+			return -1;
+		if (stream.writeRaw (xml.data (), static_cast<uint32_t> (xml.size ())) != xml.size ())
+			return -1;
+	}
+
+	CompressedUIDescription source (CResourceDescription (xmlPath.data ()));
+	if (!source.parse ())
+		return -1;
+
+	struct Variant
+	{
+		uint32_t compressionLevel;
+		bool rawDeflate;
+		std::string path;
+	};
+	std::vector<Variant> variants;
+	for (auto level : {0u, 1u, 6u, 9u})
+	{
+		for (auto rawDeflate : {false, true})
+		{
+			auto path = directory + "uidescinflatespeed_" + std::to_string (level) +
+			            (rawDeflate ? "_raw" : "") + ".uidesc";
+			int32_t flags = UIDescription::kWriteImagesIntoXMLFile |
+			                UIDescription::kDoNotVerifyImageXMLData |
+			                CompressedUIDescription::kNoPlainXmlFileBackup |
+			                CompressedUIDescription::kForceWriteCompressedDesc;
+			if (rawDeflate)
+				flags |= CompressedUIDescription::kWriteRawDeflate;
+			source.setCompressionLevel (level);
+			if (!source.save (path.data (), flags))
+				return -1;
+			variants.push_back ({level, rawDeflate, path});
+		}
+	}
+
+	auto xmlTime = measureParse (xmlPath, false, repetitions);
+	printf ("%u bitmaps, %u views\n", numBitmaps, numViews);
+	printf ("format            size        stream       mapped\n");
+	printf ("plain xml     %7.2f MB  %8.2f ms\n", getFileSize (xmlPath) / (1024. * 1024.), xmlTime);
+	for (const auto& variant : variants)
+	{
+		auto streamTime = measureParse (variant.path, false, repetitions);
+		auto mappedTime = measureParse (variant.path, true, repetitions);
+		if (streamTime < 0. || mappedTime < 0.)
+			return -1;
+		printf ("level %u %-4s  %7.2f MB  %8.2f ms  %8.2f ms\n", variant.compressionLevel,
+		        variant.rawDeflate ? "raw" : "zlib", getFileSize (variant.path) / (1024. * 1024.),
+		        streamTime, mappedTime);
+	}
+
+	std::remove (xmlPath.data ());
+	for (const auto& variant : variants)
+		std::remove (variant.path.data ());
+	return 0;
+}
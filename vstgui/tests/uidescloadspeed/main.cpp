@@ -0,0 +1,142 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/lib/ccolor.h"
+#include "vstgui/lib/cview.h"
+#include "vstgui/lib/platform/iplatformbitmap.h"
+#include "vstgui/uidescription/base64codec.h"
+#include "vstgui/uidescription/uidescription.h"
+#include "vstgui/uidescription/xmlparser.h"
+#include "../uidescbenchmark.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+static std::string createEncodedPNG (uint32_t index, CCoord size)
+{
+	auto bitmap = makeOwned<CBitmap> (CPoint (size, size));
+	auto accessor = owned (CBitmapPixelAccess::create (bitmap));
+	if (!accessor)
+		return {};
+	auto pixelSize = static_cast<uint32_t> (size);
+	for (auto y = 0u; y < pixelSize; ++y)
+	{
+		for (auto x = 0u; x < pixelSize; ++x)
+		{
+			accessor->setPosition (x, y);
+			accessor->setColor (CColor (static_cast<uint8_t> (x * index), static_cast<uint8_t> (y),
+			                            static_cast<uint8_t> ((x ^ y) + index), 255));
+		}
+	}
+	accessor = nullptr;
+	auto png = IPlatformBitmap::createMemoryPNGRepresentation (bitmap->getPlatformBitmap ());
+	auto encoded = Base64Codec::encode (png.data (), static_cast<uint32_t> (png.size ()));
+	return std::string (reinterpret_cast<const char*> (encoded.data.get ()), encoded.dataSize);
+}
+
+//------------------------------------------------------------------------
+// creates a description with numBitmaps embedded PNG bitmaps, every second one with a blur filter,
+// and a template with numContainers containers of numViewsPerContainer views using the bitmaps
+static std::string createDescription (uint32_t numBitmaps, CCoord bitmapSize,
+                                      uint32_t numContainers, uint32_t numViewsPerContainer)
+{
+	UIDescBenchmark::DescriptionSpec spec;
+	spec.numBitmaps = numBitmaps;
+	spec.bitmapData = [&] (uint32_t i) { return createEncodedPNG (i, bitmapSize); };
+	spec.bitmapChildren = [] (uint32_t i) -> std::string {
+		if (i % 2 == 0)
+			return {};
+		return "\t\t\t<filter name=\"Box Blur\">\n"
+		       "\t\t\t\t<property name=\"Radius\" value=\"4\"/>\n"
+		       "\t\t\t</filter>\n";
+	};
+	spec.numViews = numContainers;
+	spec.view = [&] (uint32_t c) {
+		std::string xml = "\t\t<view class=\"CViewContainer\" origin=\"0, " +
+		                  std::to_string (c * 10) + "\" size=\"800, 10\">\n";
+		for (auto i = 0u; i < numViewsPerContainer; ++i)
+		{
+			xml += "\t\t\t<view bitmap=\"bitmap" + std::to_string ((c + i) % numBitmaps) +
+			       "\" class=\"CView\" origin=\"" + std::to_string (i * 8) +
+			       ", 0\" size=\"8, 10\"/>\n";
+		}
+		xml += "\t\t</view>\n";
+		return xml;
+	};
+	return UIDescBenchmark::createDescription (spec);
+}
+
+//------------------------------------------------------------------------
+struct Result
+{
+	double parseTime {0.};
+	double createViewTime {0.};
+};
+
+//------------------------------------------------------------------------
+static bool measure (const std::string& xml, uint32_t numThreads, uint32_t repetitions,
+                     Result& result)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	std::chrono::duration<double, std::milli> parseDuration {0};
+	std::chrono::duration<double, std::milli> createViewDuration {0};
+	for (auto i = 0u; i < repetitions; ++i)
+	{
+		Xml::MemoryContentProvider provider (xml.data (), static_cast<uint32_t> (xml.size ()));
+		UIDescription desc (&provider);
+		desc.setNumWorkerThreads (numThreads);
+		auto start = Clock::now ();
+		if (!desc.parse ())
+			return false;
+		auto parsed = Clock::now ();
+		auto view = owned (desc.createView ("view", nullptr));
+		auto created = Clock::now ();
+		if (!view)
+			return false;
+		parseDuration += parsed - start;
+		createViewDuration += created - parsed;
+	}
+	result.parseTime = parseDuration.count () / repetitions;
+	result.createViewTime = createViewDuration.count () / repetitions;
+	return true;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numBitmaps = 64;
+	constexpr CCoord bitmapSize = 256;
+	constexpr uint32_t numContainers = 60;
+	constexpr uint32_t numViewsPerContainer = 100;
+	constexpr uint32_t repetitions = 5;
+
+	auto xml = createDescription (numBitmaps, bitmapSize, numContainers, numViewsPerContainer);
+	if (xml.empty ())
+		return -1;
+
+	std::vector<uint32_t> threadCounts = {0, 1, 2, 4, 8};
+	auto hardwareThreads = std::thread::hardware_concurrency ();
+	if (hardwareThreads > threadCounts.back ())
+		threadCounts.emplace_back (hardwareThreads);
+
+	printf ("%u bitmaps, %u views, %.1f MB xml, %u hardware threads\n", numBitmaps,
+	        numContainers * numViewsPerContainer, xml.size () / (1024. * 1024.), hardwareThreads);
+	printf ("threads      parse   create view      total\n");
+	for (auto numThreads : threadCounts)
+	{
+		Result result;
+		if (!measure (xml, numThreads, repetitions, result))
+			return -1;
+		printf ("%7u %7.2f ms  %9.2f ms %7.2f ms\n", numThreads, result.parseTime,
+		        result.createViewTime, result.parseTime + result.createViewTime);
+	}
+	return 0;
+}
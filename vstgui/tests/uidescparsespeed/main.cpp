@@ -0,0 +1,101 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/uidescription/compresseduidescription.h"
+#include "vstgui/uidescription/cstream.h"
+#include "vstgui/uidescription/xmlparser.h"
+#include "vstgui/lib/cresourcedescription.h"
+#include "../uidescbenchmark.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace VSTGUI;
+using UIDescBenchmark::measureMilliseconds;
+
+//------------------------------------------------------------------------
+// creates a description with numBitmaps embedded bitmaps and a template with numViews views,
+// formatted like UIDescription writes it
+static std::string createDescription (uint32_t numBitmaps, size_t bitmapDataSize, uint32_t numViews)
+{
+	UIDescBenchmark::DescriptionSpec spec;
+	spec.numBitmaps = numBitmaps;
+	spec.bitmapData = UIDescBenchmark::randomBitmapData (bitmapDataSize);
+	spec.wrapBitmapData = true;
+	spec.numViews = numViews;
+	return UIDescBenchmark::createDescription (spec);
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numBitmaps = 32;
+	constexpr size_t bitmapDataSize = 1024 * 1024;
+	constexpr uint32_t numViews = 2000;
+	constexpr uint32_t repetitions = 10;
+	constexpr auto plainFileName = "uidescparsespeed.uidesc";
+	constexpr auto compressedFileName = "uidescparsespeed.compressed.uidesc";
+	constexpr auto compiledFileName = "uidescparsespeed.compiled.uidesc";
+
+	auto xml = createDescription (numBitmaps, bitmapDataSize, numViews);
+
+	{
+		CFileStream plainFile;
+		if (!plainFile.open (plainFileName, CFileStream::kWriteMode | CFileStream::kTruncateMode))
+			return -1;
+		if (plainFile.writeRaw (xml.data (), static_cast<uint32_t> (xml.size ())) != xml.size ())
+			return -1;
+	}
+	{
+		CompressedUIDescription desc {CResourceDescription (plainFileName)};
+		if (!desc.parse ())
+			return -1;
+		if (!desc.save (compressedFileName, CompressedUIDescription::kForceWriteCompressedDesc |
+		                                        CompressedUIDescription::kNoPlainXmlFileBackup |
+		                                        UIDescription::kWriteImagesIntoXMLFile |
+		                                        UIDescription::kDoNotVerifyImageXMLData))
+			return -1;
+		if (!desc.UIDescription::save (compiledFileName, UIDescription::kWriteCompiledDesc |
+		                                                     UIDescription::kWriteImagesIntoXMLFile |
+		                                                     UIDescription::kDoNotVerifyImageXMLData))
+			return -1;
+	}
+
+	auto plainTime = measureMilliseconds (repetitions, [&] () {
+		Xml::MemoryContentProvider provider (xml.data (), static_cast<uint32_t> (xml.size ()));
+		UIDescription desc (&provider);
+		return desc.parse ();
+	});
+	auto compressedTime = measureMilliseconds (repetitions, [&] () {
+		CompressedUIDescription desc {CResourceDescription (compressedFileName)};
+		return desc.parse () && desc.getOriginalIsCompressed ();
+	});
+	auto plainFileTime = measureMilliseconds (repetitions, [&] () {
+		UIDescription desc {CResourceDescription (plainFileName)};
+		return desc.parse ();
+	});
+	auto compiledTime = measureMilliseconds (repetitions, [&] () {
+		UIDescription desc {CResourceDescription (compiledFileName)};
+		return desc.parse ();
+	});
+
+	std::remove (plainFileName);
+	std::remove (compressedFileName);
+	std::remove (compiledFileName);
+
+	if (plainTime < 0. || compressedTime < 0. || plainFileTime < 0. || compiledTime < 0.)
+		return -1;
+
+	auto xmlMB = static_cast<double> (xml.size ()) / (1024. * 1024.);
+	printf ("%u bitmaps, %u views, %.1f MB xml\n", numBitmaps, numViews, xmlMB);
+	printf ("parse from memory:      %8.2f ms (%7.1f MB/s)\n", plainTime,
+	        xmlMB / (plainTime / 1000.));
+	printf ("parse compressed file:  %8.2f ms (%7.1f MB/s)\n", compressedTime,
+	        xmlMB / (compressedTime / 1000.));
+	printf ("parse plain file:       %8.2f ms (%7.1f MB/s)\n", plainFileTime,
+	        xmlMB / (plainFileTime / 1000.));
+	printf ("load compiled file:     %8.2f ms (%7.1f MB/s)\n", compiledTime,
+	        xmlMB / (compiledTime / 1000.));
+	return 0;
+}
@@ -0,0 +1,113 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/ccolor.h"
+#include "vstgui/uidescription/cstream.h"
+#include "vstgui/uidescription/uidescription.h"
+#include "vstgui/uidescription/xmlparser.h"
+#include "../uidescbenchmark.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace VSTGUI;
+using UIDescBenchmark::measureMilliseconds;
+
+//------------------------------------------------------------------------
+// creates a description with numBitmaps embedded bitmaps and a template with numViews views whose
+// attributes need to be escaped
+static std::string createDescription (uint32_t numBitmaps, size_t bitmapDataSize, uint32_t numViews)
+{
+	UIDescBenchmark::DescriptionSpec spec;
+	spec.numBitmaps = numBitmaps;
+	spec.bitmapData = UIDescBenchmark::randomBitmapData (bitmapDataSize);
+	spec.numViews = numViews;
+	spec.view = [] (uint32_t i) {
+		return "\t\t<view class=\"CTextLabel\" origin=\"" + std::to_string (i % 800) +
+		       ", 0\" size=\"100, 20\" title=\"&lt;label &amp; &quot;" + std::to_string (i) +
+		       "&quot;&gt;\" tooltip=\"it&apos;s label " + std::to_string (i) + "\"/>\n";
+	};
+	return UIDescBenchmark::createDescription (spec);
+}
+
+//------------------------------------------------------------------------
+// measures the writer and not the storage
+struct NullOutputStream : OutputStream
+{
+	bool operator<< (const std::string& str) override
+	{
+		return writeRaw (str.data (), static_cast<uint32_t> (str.size ())) == str.size ();
+	}
+	uint32_t writeRaw (const void* buffer, uint32_t size) override
+	{
+		bytesWritten += size;
+		return size;
+	}
+	uint64_t bytesWritten {0};
+};
+
+//------------------------------------------------------------------------
+struct Description : UIDescription
+{
+	using UIDescription::UIDescription;
+	using UIDescription::saveToStream;
+};
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numBitmaps = 32;
+	constexpr size_t bitmapDataSize = 1024 * 1024;
+	constexpr uint32_t numViews = 2000;
+	constexpr uint32_t repetitions = 10;
+	constexpr auto fileName = "uidescsavespeed.uidesc";
+	constexpr int32_t saveFlags =
+		UIDescription::kWriteImagesIntoXMLFile | UIDescription::kDoNotVerifyImageXMLData;
+
+	auto xml = createDescription (numBitmaps, bitmapDataSize, numViews);
+	Xml::MemoryContentProvider provider (xml.data (), static_cast<uint32_t> (xml.size ()));
+	Description desc (&provider);
+	if (!desc.parse ())
+		return -1;
+
+	// the first save serializes every node, later saves reuse the xml of unchanged resources and
+	// templates
+	NullOutputStream nullStream;
+	auto firstTime = measureMilliseconds (1, [&] () {
+		return desc.saveToStream (nullStream, saveFlags);
+	});
+	uint32_t colorIndex = 0;
+	auto changedTime = measureMilliseconds (repetitions, [&] () {
+		desc.changeColor ("color", CColor (static_cast<uint8_t> (++colorIndex), 0, 0, 255));
+		nullStream.bytesWritten = 0;
+		return desc.saveToStream (nullStream, saveFlags);
+	});
+	auto streamTime = measureMilliseconds (repetitions, [&] () {
+		nullStream.bytesWritten = 0;
+		return desc.saveToStream (nullStream, saveFlags);
+	});
+	auto fileTime = measureMilliseconds (repetitions, [&] () {
+		CFileStream stream;
+		if (!stream.open (fileName, CFileStream::kWriteMode | CFileStream::kTruncateMode))
+			return false;
+		return desc.saveToStream (stream, saveFlags);
+	});
+
+	std::remove (fileName);
+
+	if (firstTime < 0. || changedTime < 0. || streamTime < 0. || fileTime < 0.)
+		return -1;
+
+	auto outputMB = static_cast<double> (nullStream.bytesWritten) / (1024. * 1024.);
+	printf ("%u bitmaps, %u views, %.1f MB xml\n", numBitmaps, numViews, outputMB);
+	printf ("first save:           %8.2f ms (%7.1f MB/s)\n", firstTime,
+	        outputMB / (firstTime / 1000.));
+	printf ("save after a change:  %8.2f ms (%7.1f MB/s)\n", changedTime,
+	        outputMB / (changedTime / 1000.));
+	printf ("save to null stream:  %8.2f ms (%7.1f MB/s)\n", streamTime,
+	        outputMB / (streamTime / 1000.));
+	printf ("save to file:         %8.2f ms (%7.1f MB/s)\n", fileTime,
+	        outputMB / (fileTime / 1000.));
+	return 0;
+}
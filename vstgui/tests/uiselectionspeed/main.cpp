@@ -0,0 +1,135 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cframe.h"
+#include "vstgui/uidescription/editing/uiselection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+// creates numGroups containers with numChildren views each, the groups are spread over rows to
+// get a second nesting level. The frame has no platform frame, it only attaches the views
+static SharedPointer<CFrame> createHierarchy (uint32_t numGroups, uint32_t numChildren,
+                                                      std::vector<CView*>& allViews)
+{
+	constexpr uint32_t groupsPerRow = 32;
+	auto frame = makeOwned<CFrame> (CRect (0, 0, 10000, 10000), nullptr);
+	CViewContainer* row = nullptr;
+	for (auto g = 0u; g < numGroups; ++g)
+	{
+		if (g % groupsPerRow == 0)
+		{
+			auto top = static_cast<CCoord> (g / groupsPerRow) * 40.;
+			row = new CViewContainer (CRect (0, top, 10000, top + 40));
+			frame->addView (row);
+		}
+		auto left = static_cast<CCoord> (g % groupsPerRow) * 40.;
+		auto group = new CViewContainer (CRect (left, 0, left + 40, 40));
+		row->addView (group);
+		allViews.emplace_back (group);
+		for (auto c = 0u; c < numChildren; ++c)
+		{
+			auto view = new CView (CRect (c, c, c + 10, c + 10));
+			group->addView (view);
+			allViews.emplace_back (view);
+		}
+	}
+	frame->attached (frame);
+	return frame;
+}
+
+//------------------------------------------------------------------------
+// the resolution UISelection used before it had a membership index
+static size_t countTopLevelViewsByScanning (const UISelection& selection)
+{
+	auto contains = [&] (CView* view) {
+		return std::find (selection.begin (), selection.end (), view) != selection.end ();
+	};
+	size_t result = 0;
+	for (auto view : selection)
+	{
+		auto covered = false;
+		for (auto parent = view->getParentView (); parent && !covered;
+		     parent = parent->getParentView ())
+			covered = contains (parent);
+		if (!covered)
+			++result;
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+template <typename Proc>
+static double measureMicroseconds (uint32_t repetitions, Proc proc)
+{
+	using Clock = std::chrono::high_resolution_clock;
+	auto start = Clock::now ();
+	for (auto i = 0u; i < repetitions; ++i)
+		proc ();
+	std::chrono::duration<double, std::micro> duration = Clock::now () - start;
+	return duration.count () / repetitions;
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numGroups = 1024;
+	constexpr uint32_t numChildren = 4;
+	constexpr uint32_t dragSteps = 100;
+
+	std::vector<CView*> allViews;
+	auto frame = createHierarchy (numGroups, numChildren, allViews);
+
+	// select all groups and their children like a rubber band selection in the editor does
+	auto selection = makeOwned<UISelection> ();
+	auto selectTime = measureMicroseconds (1, [&] () {
+		UISelection::DeferChange dc (*selection);
+		for (auto view : allViews)
+			selection->add (view);
+	});
+
+	size_t numTopLevel = 0;
+	auto scanTime = measureMicroseconds (1, [&] () {
+		numTopLevel = countTopLevelViewsByScanning (*selection);
+	});
+	auto resolveTime = measureMicroseconds (10, [&] () {
+		selection->willChange ();
+		selection->didChange ();
+		if (selection->getTopLevelViews ().size () != numTopLevel)
+			numTopLevel = 0;
+	});
+	if (numTopLevel != numGroups)
+		return -1;
+
+	size_t found = 0;
+	auto containsTime = measureMicroseconds (10, [&] () {
+		found = 0;
+		for (auto view : allViews)
+		{
+			if (selection->contains (view))
+				++found;
+		}
+	});
+	if (found != allViews.size ())
+		return -1;
+
+	// every mouse move of a drag moves the selection and invalidates the old and new rects
+	auto dragTime = measureMicroseconds (dragSteps, [&] () { selection->moveBy (CPoint (1, 1)); });
+
+	printf ("%u selected views, %u top level views\n", selection->total (),
+	        static_cast<uint32_t> (numTopLevel));
+	printf ("select all:                  %10.2f us\n", selectTime);
+	printf ("top level views (scanning):  %10.2f us\n", scanTime);
+	printf ("top level views (indexed):   %10.2f us\n", resolveTime);
+	printf ("contains all views:          %10.2f us\n", containsTime);
+	printf ("drag move step:              %10.2f us\n", dragTime);
+
+	selection->clear ();
+	return 0;
+}
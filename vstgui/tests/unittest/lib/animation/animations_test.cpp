@@ -78,6 +78,66 @@ TESTCASE(ViewSizeAnimationTest,
 
 );
 
+//-----------------------------------------------------------------------------
+TESTCASE(CompositeAlphaAnimationTest,
+
+	TEST(animation,
+		TestView view;
+		CompositeAlphaAnimation a (0.f);
+		a.animationStart (&view, "");
+		EXPECT(view.hasCompositeLayer ());
+		a.animationTick (&view, "", 0.5f);
+		EXPECT(view.getAlphaValue () == 0.5f);
+		a.animationFinished (&view, "", false);
+		EXPECT(view.getAlphaValue () == 0.f);
+		EXPECT(view.hasCompositeLayer () == false);
+	);
+
+);
+
+//-----------------------------------------------------------------------------
+TESTCASE(CompositeViewSizeAnimationTest,
+
+	TEST(animation,
+		TestView view;
+		view.setViewSize (CRect (0, 0, 50, 50));
+		CompositeViewSizeAnimation a (CRect (10, 10, 110, 110));
+		a.animationStart (&view, "");
+		EXPECT(view.hasCompositeLayer ());
+		a.animationTick (&view, "", 0.5f);
+		EXPECT(view.getViewSize () == CRect (0, 0, 50, 50));
+		EXPECT(view.getCompositeViewSize () == CRect (5, 5, 80, 80));
+		a.animationTick (&view, "", 1.f);
+		EXPECT(view.getCompositeViewSize () == CRect (10, 10, 110, 110));
+		a.animationFinished (&view, "", false);
+		EXPECT(view.hasCompositeLayer () == false);
+		EXPECT(view.getViewSize () == CRect (10, 10, 110, 110));
+		EXPECT(view.getCompositeViewSize () == CRect (10, 10, 110, 110));
+	);
+
+	TEST(canceledAnimation,
+		TestView view;
+		view.setViewSize (CRect (0, 0, 50, 50));
+		CompositeViewSizeAnimation a (CRect (10, 10, 110, 110));
+		a.animationStart (&view, "");
+		a.animationTick (&view, "", 0.5f);
+		a.animationFinished (&view, "", true);
+		EXPECT(view.hasCompositeLayer () == false);
+		EXPECT(view.getViewSize () == CRect (5, 5, 80, 80));
+	);
+
+	TEST(emptyStartSize,
+		TestView view;
+		CompositeViewSizeAnimation a (CRect (10, 10, 100, 100));
+		a.animationStart (&view, "");
+		a.animationTick (&view, "", 0.5f);
+		EXPECT(view.getViewSize () == CRect (5, 5, 50, 50));
+		a.animationFinished (&view, "", false);
+		EXPECT(view.getViewSize () == CRect (10, 10, 100, 100));
+	);
+
+);
+
 //-----------------------------------------------------------------------------
 TESTCASE(ControlValueAnimationTest,
 	
@@ -7,6 +7,9 @@
 #include "../../../../lib/animation/timingfunctions.h"
 #include "../../../../lib/cview.h"
 #include "../../unittests.h"
+#include <algorithm>
+#include <string>
+#include <vector>
 
 #if MAC
 
@@ -95,3 +98,149 @@ TESTCASE(AnimatorTest,
 } // VSTGUI
 
 #endif // MAC
+
+namespace VSTGUI {
+using namespace Animation;
+
+namespace {
+
+//-----------------------------------------------------------------------------
+/** done after numTicks ticks, independent of the time between them */
+struct TickCountTimingFunction : public ITimingFunction
+{
+	explicit TickCountTimingFunction (uint32_t numTicks) : numTicks (numTicks) {}
+
+	float getPosition (uint32_t milliseconds) override
+	{
+		return static_cast<float> (++ticks) / numTicks;
+	}
+	bool isDone (uint32_t milliseconds) override { return ticks >= numTicks; }
+
+	uint32_t numTicks;
+	uint32_t ticks {0};
+};
+
+//-----------------------------------------------------------------------------
+struct RecordingTarget : public IAnimationTarget
+{
+	RecordingTarget (std::string& log) : log (log) {}
+
+	void animationStart (CView* view, IdStringPtr name) override { log += "s"; }
+	void animationTick (CView* view, IdStringPtr name, float pos) override { log += "t"; }
+	void animationFinished (CView* view, IdStringPtr name, bool wasCanceled) override
+	{
+		log += wasCanceled ? "c" : "f";
+	}
+
+	std::string& log;
+};
+
+//-----------------------------------------------------------------------------
+struct RemoveOtherOnTick : public RecordingTarget
+{
+	RemoveOtherOnTick (std::string& log, Animator* animator, CView* other)
+	: RecordingTarget (log), animator (animator), other (other) {}
+
+	void animationTick (CView* view, IdStringPtr name, float pos) override
+	{
+		RecordingTarget::animationTick (view, name, pos);
+		animator->removeAnimations (other);
+	}
+
+	Animator* animator;
+	CView* other;
+};
+
+} // anonymous
+
+//-----------------------------------------------------------------------------
+TESTCASE(AnimatorTickTest,
+
+	TEST(finishAfterTicks,
+		auto a = owned (new Animator ());
+		auto view = owned (new CView (CRect (0, 0, 0, 0)));
+		std::string log;
+		uint32_t notified = 0;
+		a->addAnimation (view, "Test", new RecordingTarget (log), new TickCountTimingFunction (3),
+		                 [&] (CView*, const IdStringPtr, IAnimationTarget*) { ++notified; });
+		a->onTimer ();
+		a->onTimer ();
+		EXPECT(notified == 0);
+		a->onTimer ();
+		EXPECT(log == "stttf");
+		EXPECT(notified == 1);
+		a->onTimer ();
+		EXPECT(log == "stttf");
+	);
+
+	TEST(replaceCancelsPrevious,
+		auto a = owned (new Animator ());
+		auto view = owned (new CView (CRect (0, 0, 0, 0)));
+		std::string log1;
+		std::string log2;
+		uint32_t notified = 0;
+		a->addAnimation (view, "Test", new RecordingTarget (log1), new TickCountTimingFunction (10),
+		                 [&] (CView*, const IdStringPtr, IAnimationTarget*) { ++notified; });
+		a->onTimer ();
+		a->addAnimation (view, "Test", new RecordingTarget (log2), new TickCountTimingFunction (1));
+		EXPECT(log1 == "stc");
+		EXPECT(notified == 0);
+		a->onTimer ();
+		EXPECT(log2 == "stf");
+	);
+
+	TEST(namesAreCompared,
+		auto a = owned (new Animator ());
+		auto view = owned (new CView (CRect (0, 0, 0, 0)));
+		std::string log1;
+		std::string log2;
+		std::string name ("Test");
+		a->addAnimation (view, "Test", new RecordingTarget (log1), new TickCountTimingFunction (10));
+		a->addAnimation (view, "Other", new RecordingTarget (log2), new TickCountTimingFunction (10));
+		a->removeAnimation (view, name.data ());
+		EXPECT(log1 == "c");
+		EXPECT(log2 == "");
+		a->removeAnimations (view);
+		EXPECT(log2 == "c");
+	);
+
+	TEST(removeOtherViewWhileTicking,
+		auto a = owned (new Animator ());
+		auto view1 = owned (new CView (CRect (0, 0, 0, 0)));
+		auto view2 = owned (new CView (CRect (0, 0, 0, 0)));
+		std::string log1;
+		std::string log2;
+		uint32_t notified = 0;
+		a->addAnimation (view1, "Test", new RemoveOtherOnTick (log1, a, view2),
+		                 new TickCountTimingFunction (2));
+		a->addAnimation (view2, "Test", new RecordingTarget (log2), new TickCountTimingFunction (2),
+		                 [&] (CView*, const IdStringPtr, IAnimationTarget*) { ++notified; });
+		a->onTimer ();
+		EXPECT(log2 == "c");
+		EXPECT(notified == 1);
+		a->onTimer ();
+		EXPECT(log1 == "sttf");
+		EXPECT(log2 == "c");
+	);
+
+	TEST(manyAnimations,
+		auto a = owned (new Animator ());
+		std::vector<SharedPointer<CView>> views;
+		std::string log;
+		for (auto i = 0; i < 100; ++i)
+		{
+			views.emplace_back (owned (new CView (CRect (0, 0, 0, 0))));
+			a->addAnimation (views.back (), "Test", new RecordingTarget (log),
+			                 new TickCountTimingFunction (static_cast<uint32_t> (i % 3 + 1)));
+		}
+		for (auto i = 0; i < 100; i += 2)
+			a->removeAnimation (views[i], "Test");
+		EXPECT(log.size () == 50);
+		for (auto i = 0; i < 3; ++i)
+			a->onTimer ();
+		EXPECT(std::count (log.begin (), log.end (), 'f') == 50);
+		EXPECT(std::count (log.begin (), log.end (), 's') == 50);
+	);
+);
+
+} // VSTGUI
@@ -0,0 +1,46 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../../lib/controls/coptionmenu.h"
+#include "../../unittests.h"
+
+namespace VSTGUI {
+
+TESTCASE(CMenuItemTest,
+
+	TEST(cachedTitleWidth,
+		auto item = owned (new CMenuItem ("Title"));
+		auto font = makeOwned<CFontDesc> ("Arial", 12);
+		EXPECT (item->getCachedTitleWidth (font) < 0.);
+		item->setCachedTitleWidth (font, 42.);
+		EXPECT (item->getCachedTitleWidth (font) == 42.);
+		auto sameFont = makeOwned<CFontDesc> ("Arial", 12);
+		EXPECT (item->getCachedTitleWidth (sameFont) == 42.);
+		auto otherFont = makeOwned<CFontDesc> ("Arial", 14);
+		EXPECT (item->getCachedTitleWidth (otherFont) < 0.);
+		EXPECT (item->getCachedTitleWidth (nullptr) < 0.);
+	);
+
+	TEST(fontChangedInPlaceInvalidatesCachedWidth,
+		auto item = owned (new CMenuItem ("Title"));
+		auto font = makeOwned<CFontDesc> ("Arial", 12);
+		item->setCachedTitleWidth (font, 42.);
+		font->setSize (14);
+		EXPECT (item->getCachedTitleWidth (font) < 0.);
+		font->setSize (12);
+		font->setStyle (kBoldFace);
+		EXPECT (item->getCachedTitleWidth (font) < 0.);
+	);
+
+	TEST(setTitleResetsCachedWidth,
+		auto item = owned (new CMenuItem ("Title"));
+		auto font = makeOwned<CFontDesc> ("Arial", 12);
+		item->setCachedTitleWidth (font, 42.);
+		item->setTitle ("Other Title");
+		EXPECT (item->getCachedTitleWidth (font) < 0.);
+	);
+
+);
+
+} // VSTGUI
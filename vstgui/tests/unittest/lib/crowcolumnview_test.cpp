@@ -0,0 +1,101 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../unittests.h"
+#include "../../../lib/crowcolumnview.h"
+
+namespace VSTGUI {
+
+namespace {
+
+class CountingRowColumnView : public CRowColumnView
+{
+public:
+	CountingRowColumnView () : CRowColumnView (CRect (0, 0, 100, 100)) {}
+
+	void layoutViews () override
+	{
+		++numLayouts;
+		CRowColumnView::layoutViews ();
+	}
+
+	uint32_t numLayouts {0};
+};
+
+} // anonymous
+
+TESTCASE(CRowColumnViewTests,
+
+	TEST(layoutOnAddView,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto rcv = owned (new CountingRowColumnView ());
+		rcv->attached (parent);
+		rcv->numLayouts = 0;
+		auto view1 = new CView (CRect (0, 0, 100, 10));
+		auto view2 = new CView (CRect (0, 0, 100, 10));
+		rcv->addView (view1);
+		rcv->addView (view2);
+		EXPECT (rcv->numLayouts == 2);
+		EXPECT (view2->getViewSize () == CRect (0, 10, 100, 20));
+		rcv->removed (parent);
+	);
+
+	TEST(layoutUpdates,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto rcv = owned (new CountingRowColumnView ());
+		rcv->attached (parent);
+		rcv->numLayouts = 0;
+		rcv->beginLayoutUpdates ();
+		EXPECT (rcv->isInLayoutUpdates ());
+		auto view1 = new CView (CRect (0, 0, 100, 10));
+		auto view2 = new CView (CRect (0, 0, 100, 10));
+		rcv->addView (view1);
+		rcv->addView (view2);
+		rcv->setSpacing (5.);
+		EXPECT (rcv->numLayouts == 0);
+		EXPECT (view2->getViewSize () == CRect (0, 0, 100, 10));
+		rcv->endLayoutUpdates ();
+		EXPECT (rcv->isInLayoutUpdates () == false);
+		EXPECT (rcv->numLayouts == 1);
+		EXPECT (view2->getViewSize () == CRect (0, 15, 100, 25));
+		rcv->removed (parent);
+	);
+
+	TEST(nestedLayoutUpdates,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto rcv = owned (new CountingRowColumnView ());
+		rcv->attached (parent);
+		rcv->numLayouts = 0;
+		rcv->beginLayoutUpdates ();
+		rcv->beginLayoutUpdates ();
+		rcv->addView (new CView (CRect (0, 0, 100, 10)));
+		rcv->endLayoutUpdates ();
+		EXPECT (rcv->numLayouts == 0);
+		rcv->endLayoutUpdates ();
+		EXPECT (rcv->numLayouts == 1);
+		rcv->removed (parent);
+	);
+
+	TEST(noLayoutWithoutChanges,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto rcv = owned (new CountingRowColumnView ());
+		rcv->attached (parent);
+		rcv->numLayouts = 0;
+		rcv->beginLayoutUpdates ();
+		rcv->endLayoutUpdates ();
+		EXPECT (rcv->numLayouts == 0);
+		rcv->removed (parent);
+	);
+
+	TEST(noLayoutWhenNotAttached,
+		auto rcv = owned (new CountingRowColumnView ());
+		rcv->beginLayoutUpdates ();
+		rcv->addView (new CView (CRect (0, 0, 100, 10)));
+		rcv->endLayoutUpdates ();
+		EXPECT (rcv->numLayouts == 0);
+	);
+
+);
+
+} // VSTGUI
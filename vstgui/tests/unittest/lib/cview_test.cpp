@@ -9,6 +9,7 @@
 #include "../../../lib/dragging.h"
 #include "../../../lib/iviewlistener.h"
 #include "../../../lib/idatapackage.h"
+#include <vector>
 
 #if MAC
 #include <CoreFoundation/CoreFoundation.h>
@@ -61,6 +62,15 @@ struct ViewListener : public IViewListener
 	bool willDeleteCalled {false};
 };
 
+class InvalidRectContainer : public CViewContainer
+{
+public:
+	InvalidRectContainer () : CViewContainer (CRect (0, 0, 100, 100)) {}
+	void invalidRect (const CRect& rect) override { invalidRects.push_back (rect); }
+
+	std::vector<CRect> invalidRects;
+};
+
 } // anonymous
 
 TESTCASE(CViewTest,
@@ -277,7 +287,66 @@ TESTCASE(CViewTest,
 		EXPECT(v.getHeight () == 10);
 		EXPECT(v.getViewSize () == v.getMouseableArea ());
 	);
-	
+
+	TEST(compositeLayer,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new InvalidRectContainer ());
+		auto v = new View ();
+		container->addView (v);
+		container->attached (parent);
+		v->setCompositeTransform (CGraphicsTransform ().translate (10, 0));
+		EXPECT(container->invalidRects.empty ());
+		v->enableCompositeLayer ();
+		v->enableCompositeLayer ();
+		EXPECT(v->hasCompositeLayer ());
+		v->setCompositeTransform (CGraphicsTransform ().translate (10, 0));
+		EXPECT(container->invalidRects.size () == 1);
+		EXPECT(container->invalidRects.back () == CRect (0, 0, 20, 10));
+		EXPECT(v->getCompositeViewSize () == CRect (10, 0, 20, 10));
+		v->invalidRect (CRect (0, 0, 5, 5));
+		EXPECT(container->invalidRects.back () == CRect (10, 0, 15, 5));
+		v->setAlphaValue (0.5f);
+		EXPECT(container->invalidRects.back () == CRect (10, 0, 20, 10));
+		v->disableCompositeLayer ();
+		EXPECT(v->hasCompositeLayer ());
+		container->invalidRects.clear ();
+		v->disableCompositeLayer ();
+		EXPECT(v->hasCompositeLayer () == false);
+		EXPECT(container->invalidRects.size () == 1);
+		EXPECT(container->invalidRects.back () == CRect (0, 0, 20, 10));
+		EXPECT(v->getCompositeViewSize () == v->getViewSize ());
+		container->removed (parent);
+	);
+
+	TEST(dirtyRect,
+		auto parent = owned (new CViewContainer (CRect (0, 0, 100, 100)));
+		auto container = owned (new InvalidRectContainer ());
+		auto v = new View ();
+		container->addView (v);
+		container->attached (parent);
+		v->setDirtyRect (CRect (20, 20, 30, 30));
+		EXPECT(v->isDirty () == false);
+		v->setDirtyRect (CRect (2, 2, 4, 4));
+		EXPECT(v->isDirty ());
+		EXPECT(v->getDirtyRect () == CRect (2, 2, 4, 4));
+		v->setDirtyRect (CRect (6, 6, 8, 20));
+		EXPECT(v->getDirtyRect () == CRect (2, 2, 8, 10));
+		container->invalidRects.clear ();
+		v->invalidDirtyRect ();
+		EXPECT(v->isDirty () == false);
+		EXPECT(container->invalidRects.size () == 1);
+		EXPECT(container->invalidRects.back () == CRect (2, 2, 8, 10));
+		v->setDirtyRect (CRect (2, 2, 4, 4));
+		v->setDirty ();
+		EXPECT(v->getDirtyRect () == v->getViewSize ());
+		v->invalidDirtyRect ();
+		EXPECT(container->invalidRects.back () == v->getViewSize ());
+		v->setDirtyRect (CRect (2, 2, 4, 4));
+		v->setDirty (false);
+		EXPECT(v->isDirty () == false);
+		container->removed (parent);
+	);
+
 );
 
 #if MAC
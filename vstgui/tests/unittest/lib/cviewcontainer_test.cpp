@@ -542,6 +542,17 @@ TESTCASE(CViewContainerTest,
 		res = container->getContainerAt (CPoint(0, 0), GetViewOptions (GetViewOptions::kDeep | GetViewOptions::kMouseEnabled));
 		EXPECT(res == c1);
 	);
+
+	TEST(cacheAsBitmap,
+		auto container = owned (new CViewContainer (CRect (0, 0, 200, 200)));
+		EXPECT(container->getCacheAsBitmap () == false);
+		container->setCacheAsBitmap (true);
+		EXPECT(container->getCacheAsBitmap ());
+		auto copy = owned (static_cast<CViewContainer*> (container->newCopy ()));
+		EXPECT(copy->getCacheAsBitmap ());
+		container->setCacheAsBitmap (false);
+		EXPECT(container->getCacheAsBitmap () == false);
+	);
 	
 ); // TESTCASE
 
@@ -0,0 +1,122 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/drawprofiler.h"
+#include "../../../lib/cviewcontainer.h"
+#include "../unittests.h"
+
+namespace VSTGUI {
+
+TESTCASE(DrawProfilerTest,
+
+	TEST(recordsFrame,
+		auto profiler = makeOwned<DrawProfiler> ();
+		profiler->onInvalidRect ();
+		profiler->onInvalidRect ();
+		profiler->beginFrame (CRect (0, 0, 10, 20));
+		EXPECT(profiler->isInFrame ());
+		profiler->onDrawCall (DrawProfiler::kRect);
+		profiler->onDrawCall (DrawProfiler::kRect);
+		profiler->onDrawCall (DrawProfiler::kString);
+		profiler->onBitmapDraw (CRect (0, 0, 10, 5), 2.);
+		profiler->endFrame ();
+		EXPECT(profiler->isInFrame () == false);
+
+		auto frames = profiler->getFrames ();
+		EXPECT(frames.size () == 1);
+		const auto& frame = frames.front ();
+		EXPECT(frame.frameNumber == 0);
+		EXPECT(frame.updateRect == CRect (0, 0, 10, 20));
+		EXPECT(frame.numInvalidRects == 2);
+		EXPECT(frame.drawCalls[DrawProfiler::kRect] == 2);
+		EXPECT(frame.drawCalls[DrawProfiler::kString] == 1);
+		EXPECT(frame.drawCalls[DrawProfiler::kBitmap] == 1);
+		EXPECT(frame.getNumDrawCalls () == 4);
+		EXPECT(frame.bitmapBytes == 20 * 10 * 4);
+	);
+
+	TEST(invalidRectsAreCountedPerFrame,
+		auto profiler = makeOwned<DrawProfiler> ();
+		profiler->onInvalidRect ();
+		profiler->beginFrame (CRect (0, 0, 10, 10));
+		profiler->endFrame ();
+		profiler->beginFrame (CRect (0, 0, 10, 10));
+		profiler->endFrame ();
+		auto frames = profiler->getFrames ();
+		EXPECT(frames.size () == 2);
+		EXPECT(frames[0].numInvalidRects == 1);
+		EXPECT(frames[1].numInvalidRects == 0);
+		EXPECT(frames[1].frameNumber == 1);
+	);
+
+	TEST(ringBufferKeepsNewestFrames,
+		auto profiler = makeOwned<DrawProfiler> (4, 4);
+		for (auto i = 0; i < 10; ++i)
+		{
+			profiler->beginFrame (CRect (0, 0, 10, 10));
+			profiler->endFrame ();
+		}
+		auto frames = profiler->getFrames ();
+		EXPECT(frames.size () == 4);
+		EXPECT(frames.front ().frameNumber == 6);
+		EXPECT(frames.back ().frameNumber == 9);
+	);
+
+	TEST(recordsNestedViews,
+		auto profiler = makeOwned<DrawProfiler> ();
+		auto container = makeOwned<CViewContainer> (CRect (0, 0, 100, 100));
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		profiler->beginFrame (CRect (0, 0, 100, 100));
+		profiler->beginView (container);
+		profiler->beginView (view);
+		profiler->endView ();
+		profiler->beginView (view);
+		profiler->endView ();
+		profiler->endView ();
+		profiler->endFrame ();
+
+		EXPECT(profiler->getFrames ().front ().numViewsDrawn == 3);
+		auto views = profiler->getViewRecords ();
+		EXPECT(views.size () == 3);
+		// the children end first
+		EXPECT(*views[0].viewClass == typeid (CView));
+		EXPECT(views[0].depth == 1);
+		EXPECT(*views[2].viewClass == typeid (CViewContainer));
+		EXPECT(views[2].depth == 0);
+		EXPECT(views[2].duration >= views[0].duration + views[1].duration);
+		EXPECT(views[2].selfDuration <= views[2].duration);
+
+		auto classTimes = profiler->getViewClassTimes ();
+		EXPECT(classTimes.size () == 2);
+		for (const auto& classTime : classTimes)
+		{
+			if (classTime.className == "VSTGUI::CView")
+			{
+				EXPECT(classTime.numDraws == 2);
+			}
+			else
+			{
+				EXPECT(classTime.className == "VSTGUI::CViewContainer");
+			}
+		}
+	);
+
+	TEST(chromeTrace,
+		auto profiler = makeOwned<DrawProfiler> ();
+		auto view = makeOwned<CView> (CRect (0, 0, 10, 10));
+		profiler->beginFrame (CRect (0, 0, 10, 10));
+		profiler->onDrawCall (DrawProfiler::kLine);
+		profiler->beginView (view);
+		profiler->endView ();
+		profiler->endFrame ();
+		auto trace = profiler->getChromeTrace ();
+		EXPECT(trace.find ("\"traceEvents\":[") != std::string::npos);
+		EXPECT(trace.find ("\"name\":\"Frame\"") != std::string::npos);
+		EXPECT(trace.find ("\"line\":1") != std::string::npos);
+		EXPECT(trace.find ("\"name\":\"VSTGUI::CView\"") != std::string::npos);
+		EXPECT(trace.back () == '\n');
+	);
+);
+
+} // VSTGUI
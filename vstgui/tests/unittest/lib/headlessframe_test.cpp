@@ -0,0 +1,327 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../../lib/cbitmap.h"
+#include "../../../lib/cdrawcontext.h"
+#include "../../../lib/cframe.h"
+#include "../../../lib/cvstguitimer.h"
+#include "../../../lib/drawprofiler.h"
+#include "../../../lib/controls/cknob.h"
+#include "../../../lib/controls/cparamdisplay.h"
+#include "../../../lib/controls/cslider.h"
+#include "../../../lib/controls/cspecialdigit.h"
+#include "../../../lib/controls/cvumeter.h"
+#include "../../../lib/platform/linux/headlessframe.h"
+#include "../unittests.h"
+#include <thread>
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+struct TimerHandler : X11::ITimerHandler
+{
+	X11::ManualRunLoop* runLoop {nullptr};
+	std::vector<uint64_t> fired;
+
+	void onTimer () override { fired.push_back (runLoop->getTime ()); }
+};
+
+class DrawView : public CView
+{
+public:
+	DrawView () : CView (CRect (0, 0, 50, 50)) {}
+
+	void draw (CDrawContext* context) override
+	{
+		++drawCount;
+		if (context->getDrawProfiler ())
+			++profiledDrawCount;
+		CView::draw (context);
+	}
+
+	CMouseEventResult onMouseDown (CPoint& where, const CButtonState& buttons) override
+	{
+		mouseDownPos = where;
+		return kMouseEventHandled;
+	}
+
+	uint32_t drawCount {0};
+	uint32_t profiledDrawCount {0};
+	CPoint mouseDownPos {-1, -1};
+};
+
+struct HeadlessFrameSetup
+{
+	CFrame* frame;
+	X11::HeadlessFrame* platformFrame {nullptr};
+	SharedPointer<X11::ManualRunLoop> runLoop;
+
+	HeadlessFrameSetup (double scaleFactor = 1.)
+	{
+		X11::HeadlessFrameConfig config;
+		config.runLoop = runLoop = makeOwned<X11::ManualRunLoop> ();
+		config.scaleFactor = scaleFactor;
+		frame = new CFrame (CRect (0, 0, 100, 100), nullptr);
+		if (frame->open (nullptr, PlatformType::kHeadless, &config))
+			platformFrame = dynamic_cast<X11::HeadlessFrame*> (frame->getPlatformFrame ());
+	}
+	~HeadlessFrameSetup () noexcept { frame->close (); }
+
+	/** invalidates the dirty views and renders them, returns the rects drawn */
+	std::vector<CRect> renderDirtyViews ()
+	{
+		auto profiler = makeOwned<DrawProfiler> ();
+		frame->setDrawProfiler (profiler);
+		frame->idle ();
+		platformFrame->render ();
+		frame->setDrawProfiler (nullptr);
+		std::vector<CRect> result;
+		for (const auto& record : profiler->getFrames ())
+			result.emplace_back (record.updateRect);
+		return result;
+	}
+};
+
+} // anonymous
+
+TESTCASE(HeadlessFrameTest,
+
+	TEST(manualRunLoopFiresTimersInDeadlineOrder,
+		X11::ManualRunLoop runLoop;
+		TimerHandler t1;
+		TimerHandler t2;
+		t1.runLoop = t2.runLoop = &runLoop;
+		runLoop.registerTimer (30, &t1);
+		runLoop.registerTimer (20, &t2);
+		runLoop.advance (19);
+		EXPECT(t1.fired.empty ());
+		EXPECT(t2.fired.empty ());
+		runLoop.advance (41);
+		EXPECT(runLoop.getTime () == 60);
+		EXPECT(t1.fired == std::vector<uint64_t> ({30, 60}));
+		EXPECT(t2.fired == std::vector<uint64_t> ({20, 40, 60}));
+		EXPECT(runLoop.unregisterTimer (&t1));
+		EXPECT(runLoop.unregisterTimer (&t2));
+		EXPECT(runLoop.unregisterTimer (&t2) == false);
+	);
+
+	TEST(openWithoutParent,
+		HeadlessFrameSetup setup;
+		EXPECT(setup.platformFrame);
+		EXPECT(setup.platformFrame->getPlatformType () == PlatformType::kHeadless);
+		EXPECT(&setup.platformFrame->getRunLoop () == setup.runLoop.get ());
+	);
+
+	TEST(backBufferIsScaled,
+		HeadlessFrameSetup setup (2.);
+		EXPECT(setup.platformFrame);
+		auto& backBuffer = setup.platformFrame->getBackBuffer ();
+		EXPECT(backBuffer);
+		EXPECT(backBuffer->getSize () == CPoint (200, 200));
+	);
+
+	TEST(renderDrawsInvalidRects,
+		HeadlessFrameSetup setup;
+		auto view = new DrawView ();
+		setup.frame->addView (view);
+		// the frame invalidates itself when it is opened and when the view is added
+		EXPECT(setup.platformFrame->render () > 0);
+		auto drawCount = view->drawCount;
+		EXPECT(drawCount > 0);
+		EXPECT(setup.platformFrame->render () == 0);
+		view->invalid ();
+		EXPECT(setup.platformFrame->render () == 1);
+		EXPECT(view->drawCount == drawCount + 1);
+	);
+
+	TEST(drawProfilerRecordsRender,
+		HeadlessFrameSetup setup;
+		auto view = new DrawView ();
+		setup.frame->addView (view);
+		setup.platformFrame->render ();
+		auto profiler = makeOwned<DrawProfiler> ();
+		setup.frame->setDrawProfiler (profiler);
+		view->invalid ();
+		EXPECT(setup.platformFrame->render () == 1);
+		setup.frame->setDrawProfiler (nullptr);
+		auto frames = profiler->getFrames ();
+		EXPECT(frames.size () == 1);
+		EXPECT(frames[0].numInvalidRects == 1);
+		EXPECT(frames[0].numViewsDrawn == 1);
+		auto views = profiler->getViewRecords ();
+		EXPECT(views.size () == 1);
+		EXPECT(*views[0].viewClass == typeid (DrawView));
+	);
+
+	TEST(offscreenLayersForwardDrawProfiler,
+		HeadlessFrameSetup setup;
+		auto container = new CViewContainer (CRect (0, 0, 50, 50));
+		container->setCacheAsBitmap (true);
+		auto cachedView = new DrawView ();
+		container->addView (cachedView);
+		auto compositeView = new DrawView ();
+		compositeView->setViewSize (CRect (50, 50, 100, 100));
+		compositeView->enableCompositeLayer ();
+		setup.frame->addView (container);
+		setup.frame->addView (compositeView);
+		auto profiler = makeOwned<DrawProfiler> ();
+		setup.frame->setDrawProfiler (profiler);
+		setup.platformFrame->render ();
+		setup.frame->setDrawProfiler (nullptr);
+		EXPECT(cachedView->drawCount > 0);
+		EXPECT(cachedView->profiledDrawCount == cachedView->drawCount);
+		EXPECT(compositeView->drawCount > 0);
+		EXPECT(compositeView->profiledDrawCount == compositeView->drawCount);
+		compositeView->disableCompositeLayer ();
+	);
+
+	TEST(redrawTimerFollowsManualClock,
+		HeadlessFrameSetup setup;
+		auto view = new DrawView ();
+		setup.frame->addView (view);
+		setup.platformFrame->render ();
+		auto drawCount = view->drawCount;
+		view->invalid ();
+		EXPECT(view->drawCount == drawCount);
+		setup.runLoop->advance (100);
+		EXPECT(view->drawCount == drawCount + 1);
+	);
+
+	TEST(vstguiTimerFollowsManualClock,
+		HeadlessFrameSetup setup;
+		uint32_t fireCount = 0;
+		auto timer = makeOwned<CVSTGUITimer> ([&] (CVSTGUITimer*) { ++fireCount; }, 50);
+		// the redraw timer of the frame wakes up at 48, the timer wheel fires timers due within
+		// its coalescing window of 2 milliseconds with it
+		setup.runLoop->advance (47);
+		EXPECT(fireCount == 0);
+		setup.runLoop->advance (3);
+		EXPECT(fireCount == 1);
+		setup.runLoop->advance (100);
+		EXPECT(fireCount == 3);
+	);
+
+	TEST(vstguiTimersAreScheduledPerThread,
+		HeadlessFrameSetup setup;
+		auto timer = makeOwned<CVSTGUITimer> ([] (CVSTGUITimer*) {}, 50);
+		auto numTimers = CVSTGUITimer::getStatistics ().numTimers;
+		uint32_t numWorkerTimers = ~0u;
+		std::thread ([&] () {
+			numWorkerTimers = CVSTGUITimer::getStatistics ().numTimers;
+		}).join ();
+		EXPECT(numTimers > 0);
+		EXPECT(numWorkerTimers == 0);
+	);
+
+	TEST(paramDisplayRedrawsOnlyChangedString,
+		HeadlessFrameSetup setup;
+		auto display = new CParamDisplay (CRect (0, 0, 50, 20));
+		setup.frame->addView (display);
+		setup.platformFrame->render ();
+		display->setValue (0.001f);
+		EXPECT(display->isDirty ());
+		EXPECT(display->getDirtyRect ().isEmpty ());
+		setup.frame->idle ();
+		EXPECT(display->isDirty () == false);
+		EXPECT(setup.platformFrame->render () == 0);
+		display->setValue (0.5f);
+		EXPECT(display->getDirtyRect () == display->getViewSize ());
+		setup.frame->idle ();
+		EXPECT(setup.platformFrame->render () == 1);
+	);
+
+	TEST(specialDigitRedrawsOnlyChangedDigits,
+		HeadlessFrameSetup setup;
+		auto digits = owned (new CBitmap (CPoint (10, 100)));
+		std::vector<int32_t> xpos ({0, 10, 20});
+		std::vector<int32_t> ypos ({0, 0, 0});
+		auto digit = new CSpecialDigit (CRect (0, 0, 30, 10), nullptr, 0, 120, 3, xpos.data (),
+										ypos.data (), 10, 10, digits);
+		digit->setMax (999.f);
+		digit->setValue (120.f);
+		setup.frame->addView (digit);
+		setup.platformFrame->render ();
+		digit->setValue (121.f);
+		EXPECT(digit->getDirtyRect () == CRect (20, 0, 30, 10));
+		digit->setValue (131.f);
+		EXPECT(digit->getDirtyRect () == CRect (10, 0, 30, 10));
+
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (10, 0, 30, 10)}));
+		EXPECT(digit->getDirtyRect ().isEmpty ());
+	);
+
+	TEST(sliderRedrawsOnlyMovedHandle,
+		HeadlessFrameSetup setup;
+		auto handle = owned (new CBitmap (CPoint (10, 20)));
+		auto slider =
+			new CSlider (CRect (0, 0, 100, 20), nullptr, 0, CPoint (0, 0), 100, handle, nullptr);
+		setup.frame->addView (slider);
+		setup.platformFrame->render ();
+		// the handle moves from 0-10 to 45-55, the rect is extended by one pixel
+		slider->setValue (0.5f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (0, 0, 56, 20)}));
+		// 45-55 to 90-100
+		slider->setValue (1.f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (44, 0, 100, 20)}));
+		// 90-100 to 54-64
+		slider->setValue (0.6f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (53, 0, 100, 20)}));
+		EXPECT(setup.renderDirtyViews ().empty ());
+	);
+
+	TEST(knobRedrawsOnlyMovedHandle,
+		HeadlessFrameSetup setup;
+		auto handle = owned (new CBitmap (CPoint (10, 10)));
+		auto knob = new CKnob (CRect (0, 0, 100, 100), nullptr, 0, nullptr, handle);
+		setup.frame->addView (knob);
+		setup.platformFrame->render ();
+		// the handle moves from the bottom left to the top
+		knob->setValue (0.5f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (15, 3, 55, 85)}));
+		// from the top to the bottom right
+		knob->setValue (1.f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (45, 3, 85, 85)}));
+		// back to the bottom left
+		knob->setValue (0.f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (15, 75, 85, 85)}));
+		EXPECT(setup.renderDirtyViews ().empty ());
+	);
+
+	TEST(vuMeterRedrawsOnlyChangedLeds,
+		HeadlessFrameSetup setup;
+		auto onBitmap = owned (new CBitmap (CPoint (10, 100)));
+		auto meter = new CVuMeter (CRect (0, 0, 10, 100), onBitmap, nullptr, 10);
+		meter->setOldValue (0.f);
+		setup.frame->addView (meter);
+		setup.platformFrame->render ();
+		// the leds up to the new value are switched on
+		meter->setValue (0.5f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (0, 50, 10, 100)}));
+		// the displayed value decays by one led per update towards the new value
+		meter->setValue (0.2f);
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (0, 50, 10, 80)}));
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (0, 60, 10, 80)}));
+		EXPECT(setup.renderDirtyViews () == std::vector<CRect> ({CRect (0, 70, 10, 80)}));
+		EXPECT(setup.renderDirtyViews ().empty ());
+	);
+
+	TEST(injectMouseDown,
+		HeadlessFrameSetup setup;
+		auto view = new DrawView ();
+		setup.frame->addView (view);
+		EXPECT(setup.platformFrame->injectMouseDown (CPoint (5, 6), kLButton) ==
+			   kMouseEventHandled);
+		EXPECT(view->mouseDownPos == CPoint (5, 6));
+		CButtonState buttons;
+		setup.platformFrame->getCurrentMouseButtons (buttons);
+		EXPECT(buttons == kLButton);
+		setup.platformFrame->injectMouseUp (CPoint (5, 6), kLButton);
+		setup.platformFrame->getCurrentMouseButtons (buttons);
+		EXPECT(buttons == 0);
+	);
+);
+
+} // VSTGUI
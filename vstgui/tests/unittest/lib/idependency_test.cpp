@@ -7,6 +7,7 @@
 #if VSTGUI_ENABLE_DEPRECATED_METHODS
 
 #include "../../../lib/idependency.h"
+#include <functional>
 
 namespace VSTGUI {
 
@@ -36,6 +37,26 @@ public:
 		
 	}
 
+	size_t getNumDependents () const { return dependents.size (); }
+};
+
+class CallbackObject : public CBaseObject
+{
+public:
+	template<typename Proc>
+	explicit CallbackObject (Proc proc) : proc (proc) {}
+
+	CMessageResult notify (CBaseObject* sender, IdStringPtr message) override
+	{
+		notifyCalledCount++;
+		lastSender = sender;
+		proc ();
+		return kMessageNotified;
+	}
+
+	std::function<void ()> proc;
+	CBaseObject* lastSender {nullptr};
+	int32_t notifyCalledCount {0};
 };
 
 TESTCASE(IDependencyTest,
@@ -74,6 +95,91 @@ TESTCASE(IDependencyTest,
 		EXPECT(dObj.notifyCalledCount == 1)
 		tObj.removeDependency (&dObj);
 	);
+
+	TEST(sender,
+		TestObject tObj;
+		CallbackObject obj ([] () {});
+		tObj.addDependency (&obj);
+		tObj.changed ("Test");
+		EXPECT(obj.lastSender == &tObj)
+		tObj.removeDependency (&obj);
+	);
+
+	TEST(removeDependencyWhileNotifying,
+		TestObject tObj;
+		DependentObject dObj;
+		CallbackObject obj ([&] () { tObj.removeDependency (&dObj); });
+		tObj.addDependency (&obj);
+		tObj.addDependency (&dObj);
+		tObj.changed ("Test");
+		EXPECT(obj.notifyCalledCount == 1)
+		EXPECT(dObj.notifyCalledCount == 0)
+		EXPECT(tObj.getNumDependents () == 1)
+		tObj.removeDependency (&obj);
+		EXPECT(tObj.getNumDependents () == 0)
+	);
+
+	TEST(removeDuplicateDependencyWhileNotifying,
+		TestObject tObj;
+		DependentObject dObj;
+		CallbackObject obj ([&] () { tObj.removeDependency (&dObj); });
+		tObj.addDependency (&obj);
+		tObj.addDependency (&dObj);
+		tObj.addDependency (&dObj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 0)
+		EXPECT(tObj.getNumDependents () == 1)
+		tObj.removeDependency (&obj);
+	);
+
+	TEST(addDependencyWhileNotifying,
+		TestObject tObj;
+		DependentObject dObj;
+		CallbackObject obj ([&] () { tObj.addDependency (&dObj); });
+		tObj.addDependency (&obj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 0)
+		tObj.removeDependency (&obj);
+		tObj.changed ("Test");
+		EXPECT(dObj.notifyCalledCount == 1)
+		tObj.removeDependency (&dObj);
+	);
+
+	TEST(releaseSenderWhileNotifying,
+		auto tObj = new TestObject ();
+		DependentObject dObj;
+		CallbackObject* objPtr = nullptr;
+		CallbackObject obj ([&] () {
+			tObj->removeDependency (objPtr);
+			tObj->removeDependency (&dObj);
+			tObj->forget ();
+		});
+		objPtr = &obj;
+		tObj->addDependency (&obj);
+		tObj->addDependency (&dObj);
+		tObj->changed ("Test");
+		EXPECT(obj.notifyCalledCount == 1)
+		EXPECT(dObj.notifyCalledCount == 0)
+	);
+
+	TEST(deferChangesWhileNotifying,
+		TestObject tObj;
+		CallbackObject* objPtr = nullptr;
+		CallbackObject obj ([&] () {
+			if (objPtr->notifyCalledCount == 1)
+			{
+				IDependency::DeferChanges df (&tObj);
+				tObj.changed ("Test2");
+			}
+		});
+		objPtr = &obj;
+		tObj.addDependency (&obj);
+		tObj.deferChanges (true);
+		tObj.changed ("Test");
+		tObj.deferChanges (false);
+		EXPECT(obj.notifyCalledCount == 2)
+		tObj.removeDependency (&obj);
+	);
 );
 
 } // VSTGUI
@@ -1,4 +1,4 @@
-// This file is part of VSTGUI. It is subject to the license terms 
+// This file is part of VSTGUI. It is subject to the license terms
 // in the LICENSE file found in the top-level directory of this
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
@@ -7,26 +7,17 @@
 namespace VSTGUI {
 namespace UnitTest {
 
-SharedPointer<PlatformParentHandle> PlatformParentHandle::create ()
-{
-	return nullptr;
-}
-
-PlatformType PlatformParentHandle::getType () const
+struct HeadlessPlatformHandle : PlatformParentHandle
 {
-	return PlatformType::kX11EmbedWindowID;
-}
+	PlatformType getType () const override { return PlatformType::kHeadless; }
+	void* getHandle () const override { return nullptr; }
+	void forceRedraw () override {}
+};
 
-void* PlatformParentHandle::getHandle () const
-{
-	return nullptr;
-}
-
-void PlatformParentHandle::forceRedraw ()
+SharedPointer<PlatformParentHandle> PlatformParentHandle::create ()
 {
-
+	return makeOwned<HeadlessPlatformHandle> ();
 }
 
 } // UnitTest
 } // VSTGUI
-
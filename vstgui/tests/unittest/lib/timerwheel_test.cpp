@@ -0,0 +1,180 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../unittests.h"
+#include "../../../lib/timerwheel.h"
+#include <functional>
+#include <list>
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+struct Callback : IPlatformTimerCallback
+{
+	std::function<void ()> proc;
+	std::vector<uint64_t> fired;
+	const TimerWheel* wheel {nullptr};
+
+	void fire () override
+	{
+		if (wheel)
+			fired.push_back (wheel->getCurrentTick ());
+		if (proc)
+			proc ();
+	}
+};
+
+constexpr uint64_t farDeadlines[] = {200, 5000, 70000, 300000, 20000000, 100000000};
+
+} // anonymous
+
+TESTCASE(TimerWheelTest,
+
+	TEST(oneShotFiresAtDeadline,
+		TimerWheel wheel;
+		Callback callback;
+		callback.wheel = &wheel;
+		TimerWheel::Entry entry (&callback);
+		wheel.add (entry, 10);
+		EXPECT(entry.isScheduled ());
+		EXPECT(wheel.getNextDeadline () == 10);
+		EXPECT(wheel.advance (9) == 0);
+		EXPECT(wheel.advance (20) == 1);
+		EXPECT(callback.fired.size () == 1);
+		EXPECT(callback.fired[0] == 10);
+		EXPECT(!entry.isScheduled ());
+		EXPECT(wheel.empty ());
+		EXPECT(wheel.getNextDeadline () == TimerWheel::kNoDeadline);
+	);
+
+	TEST(periodicFiresEveryPeriod,
+		TimerWheel wheel;
+		Callback callback;
+		callback.wheel = &wheel;
+		TimerWheel::Entry entry (&callback);
+		wheel.add (entry, 16, 16);
+		for (auto tick = 1u; tick <= 1000; ++tick)
+			wheel.advance (tick);
+		EXPECT(callback.fired.size () == 62);
+		for (auto i = 0u; i < callback.fired.size (); ++i)
+		{
+			EXPECT(callback.fired[i] == (i + 1) * 16);
+		}
+		EXPECT(entry.isScheduled ());
+		EXPECT(wheel.getNextDeadline () == 1008);
+		wheel.remove (entry);
+		EXPECT(wheel.empty ());
+	);
+
+	TEST(periodicSkipsMissedDeadlines,
+		TimerWheel wheel;
+		Callback callback;
+		callback.wheel = &wheel;
+		TimerWheel::Entry entry (&callback);
+		wheel.add (entry, 10, 10);
+		EXPECT(wheel.advance (55) == 1);
+		EXPECT(entry.getDeadline () == 60);
+		EXPECT(wheel.advance (59) == 0);
+		EXPECT(wheel.advance (60) == 1);
+		wheel.remove (entry);
+	);
+
+	TEST(farDeadlinesCascade,
+		TimerWheel wheel (123);
+		Callback callback;
+		callback.wheel = &wheel;
+		std::vector<uint64_t> deadlines (std::begin (farDeadlines), std::end (farDeadlines));
+		std::list<TimerWheel::Entry> entries;
+		for (auto it = deadlines.rbegin (); it != deadlines.rend (); ++it)
+		{
+			entries.emplace_back (&callback);
+			wheel.add (entries.back (), *it);
+		}
+		while (!wheel.empty ())
+		{
+			auto next = wheel.getNextDeadline ();
+			EXPECT(next > wheel.getCurrentTick ());
+			wheel.advance (next);
+		}
+		EXPECT(callback.fired == deadlines);
+	);
+
+	TEST(bigJumpsFireInOrder,
+		TimerWheel wheel;
+		Callback callback;
+		callback.wheel = &wheel;
+		std::list<TimerWheel::Entry> entries;
+		for (auto i = 0u; i < 100; ++i)
+		{
+			entries.emplace_back (&callback);
+			wheel.add (entries.back (), (i * 7919) % 100000 + 1);
+		}
+		EXPECT(wheel.getNumEntries () == 100);
+		EXPECT(wheel.advance (1000000) == 100);
+		EXPECT(callback.fired.size () == 100);
+		for (auto i = 1u; i < callback.fired.size (); ++i)
+		{
+			EXPECT(callback.fired[i - 1] <= callback.fired[i]);
+		}
+	);
+
+	TEST(removeWhileFiring,
+		TimerWheel wheel;
+		Callback first;
+		Callback second;
+		TimerWheel::Entry firstEntry (&first);
+		TimerWheel::Entry secondEntry (&second);
+		uint32_t secondFired = 0;
+		first.proc = [&] () { wheel.remove (secondEntry); };
+		second.proc = [&] () { ++secondFired; };
+		wheel.add (firstEntry, 5, 5);
+		wheel.add (secondEntry, 5, 5);
+		EXPECT(wheel.advance (5) == 1);
+		EXPECT(secondFired == 0);
+		EXPECT(!secondEntry.isScheduled ());
+		EXPECT(wheel.getNumEntries () == 1);
+		wheel.remove (firstEntry);
+	);
+
+	TEST(addWhileFiring,
+		TimerWheel wheel;
+		Callback callback;
+		Callback added;
+		added.wheel = &wheel;
+		TimerWheel::Entry entry (&callback);
+		TimerWheel::Entry addedEntry (&added);
+		callback.proc = [&] () { wheel.add (addedEntry, 0); };
+		wheel.add (entry, 3);
+		EXPECT(wheel.advance (10) == 2);
+		EXPECT(added.fired.size () == 1);
+		EXPECT(added.fired[0] == 4);
+	);
+
+	TEST(coalesceWithLookahead,
+		TimerWheel wheel;
+		Callback callback;
+		callback.wheel = &wheel;
+		TimerWheel::Entry a (&callback);
+		TimerWheel::Entry b (&callback);
+		wheel.add (a, 32);
+		wheel.add (b, 33);
+		EXPECT(wheel.getNextDeadline () == 32);
+		// a wakeup at 32 with a lookahead of 2 ticks fires both
+		EXPECT(wheel.advance (32 + 2) == 2);
+	);
+
+	TEST(destructorUnschedulesEntries,
+		Callback callback;
+		TimerWheel::Entry entry (&callback);
+		{
+			TimerWheel wheel;
+			wheel.add (entry, 100000);
+		}
+		EXPECT(!entry.isScheduled ());
+	);
+);
+
+} // VSTGUI
@@ -5,6 +5,7 @@
 #include "../unittests.h"
 #include "../../../uidescription/base64codec.h"
 #include <string>
+#include <vector>
 
 namespace VSTGUI {
 
@@ -69,6 +70,70 @@ TESTCASE(Base64CodecTest,
 		 EXPECT (ptr[4] == 0x0D);
 		 EXPECT (ptr[5] == 0x0A);
 	);
+
+	TEST(encodeSmallSizes,
+		 uint8_t binary[2];
+		 binary[0] = 0x89;
+		 binary[1] = 0x50;
+		 auto result = Base64Codec::encode (binary, 0);
+		 EXPECT (result.dataSize == 0);
+		 result = Base64Codec::encode (binary, 1);
+		 EXPECT (result.dataSize == 4);
+		 EXPECT (std::string (reinterpret_cast<const char*> (result.data.get ()), 4) == "iQ==");
+		 result = Base64Codec::encode (binary, 2);
+		 EXPECT (result.dataSize == 4);
+		 EXPECT (std::string (reinterpret_cast<const char*> (result.data.get ()), 4) == "iVA=");
+	);
+
+	TEST(roundTripSIMDAndScalar,
+		 std::vector<uint8_t> data (300);
+		 for (auto i = 0u; i < data.size (); ++i)
+			 data[i] = static_cast<uint8_t> (i * 7 + (i >> 3));
+		 for (size_t size = 0; size < data.size (); ++size)
+		 {
+			 Base64Codec::setSIMDEnabled (false);
+			 auto scalar = Base64Codec::encode (data.data (), size);
+			 Base64Codec::setSIMDEnabled (true);
+			 auto simd = Base64Codec::encode (data.data (), size);
+			 EXPECT (scalar.dataSize == simd.dataSize);
+			 EXPECT (memcmp (scalar.data.get (), simd.data.get (), simd.dataSize) == 0);
+			 auto decoded = Base64Codec::decode (simd.data.get (), simd.dataSize);
+			 EXPECT (decoded.dataSize == size);
+			 EXPECT (memcmp (decoded.data.get (), data.data (), size) == 0);
+		 }
+	);
+
+	TEST(streamDecodeWithWhitespaceAndChunks,
+		 std::vector<uint8_t> data (1000);
+		 for (auto i = 0u; i < data.size (); ++i)
+			 data[i] = static_cast<uint8_t> (i * 13 + (i >> 2));
+		 auto encoded = Base64Codec::encode (data.data (), data.size ());
+		 std::string str;
+		 for (auto i = 0u; i < encoded.dataSize; ++i)
+		 {
+			 str += static_cast<char> (encoded.data.get ()[i]);
+			 if (i % 81 == 80)
+				 str += "\n\t\t";
+		 }
+		 for (size_t chunkSize = 1; chunkSize < str.size (); chunkSize = chunkSize * 3 + 2)
+		 {
+			 Base64Codec::StreamDecoder decoder;
+			 for (size_t pos = 0; pos < str.size (); pos += chunkSize)
+				 decoder.decode (str.data () + pos, std::min (chunkSize, str.size () - pos));
+			 auto result = decoder.finish ();
+			 EXPECT (result.dataSize == data.size ());
+			 EXPECT (memcmp (result.data.get (), data.data (), data.size ()) == 0);
+		 }
+	);
+
+	TEST(streamDecodeUnpadded,
+		 std::string test ("QUJDRA");
+		 Base64Codec::StreamDecoder decoder;
+		 decoder.decode (test.data (), test.size ());
+		 auto result = decoder.finish ();
+		 EXPECT (result.dataSize == 4);
+		 EXPECT (memcmp (result.data.get (), "ABCD", 4) == 0);
+	);
 );
 
 }
@@ -136,4 +136,29 @@ TESTCASE(CMemoryStreamTests,
 	
 );
 
+TESTCASE(BufferedOutputStreamTests,
+
+	TEST(writeSmallAndLargeBlocks,
+		CMemoryStream s;
+		std::string expected;
+		{
+			BufferedOutputStream bs (s, 16);
+			for (auto i = 0; i < 10; ++i)
+			{
+				std::string small (3, static_cast<char> ('a' + i));
+				EXPECT(bs.writeRaw (small.data (), 3) == 3);
+				expected += small;
+			}
+			std::string large (40, 'x');
+			EXPECT(bs.writeRaw (large.data (), 40) == 40);
+			expected += large;
+			EXPECT(bs << std::string ("end"));
+			expected += "end";
+		}
+		EXPECT(s.tell () == static_cast<int64_t> (expected.size ()));
+		EXPECT(memcmp (s.getBuffer (), expected.data (), expected.size ()) == 0);
+	);
+
+);
+
 } // VSTGUI
@@ -0,0 +1,256 @@
+// This file is part of VSTGUI. It is subject to the license terms 
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "../../unittests.h"
+#include "../../../../uidescription/editing/uiactions.h"
+#include "../../../../uidescription/editing/uiundomanager.h"
+#include "../../../../uidescription/uidescription.h"
+#include "../../../../uidescription/uiviewfactory.h"
+#include "../../../../uidescription/xmlparser.h"
+#include "../../../../lib/cviewcontainer.h"
+#include <vector>
+
+namespace VSTGUI {
+
+namespace {
+
+//------------------------------------------------------------------------
+class ValueAction : public IAction
+{
+public:
+	ValueAction (int32_t& value, int32_t newValue, size_t memorySize = 0)
+	: value (value), newValue (newValue), oldValue (value), memorySize (memorySize)
+	{
+	}
+
+	UTF8StringPtr getName () override { return "value"; }
+	void perform () override { value = newValue; }
+	void undo () override { value = oldValue; }
+	size_t getMemorySize () const override { return memorySize; }
+
+private:
+	int32_t& value;
+	int32_t newValue;
+	int32_t oldValue;
+	size_t memorySize;
+};
+
+//------------------------------------------------------------------------
+constexpr auto attributeChangeUIDesc = R"(
+<vstgui-ui-description version="1">
+	<template class="CViewContainer" name="view" origin="0, 0" size="400, 235">
+		<view class="CView" opacity="1" origin="0, 0" size="10, 10"/>
+		<view class="CView" opacity="0.5" origin="10, 0" size="10, 10"/>
+		<view class="CView" opacity="0.5" origin="20, 0" size="10, 10"/>
+	</template>
+</vstgui-ui-description>
+)";
+
+//------------------------------------------------------------------------
+struct AttributeChangeFixture
+{
+	AttributeChangeFixture ()
+	: provider (attributeChangeUIDesc, static_cast<uint32_t> (strlen (attributeChangeUIDesc)))
+	, desc (makeOwned<UIDescription> (&provider))
+	, selection (makeOwned<UISelection> ())
+	, undoManager (makeOwned<UIUndoManager> ())
+	{
+		desc->parse ();
+		container = owned (desc->createView ("view", nullptr));
+		if (auto c = container ? container->asViewContainer () : nullptr)
+			c->forEachChild ([&] (CView* view) { selection->add (view); });
+	}
+
+	std::vector<std::string> getValues (const std::string& attrName) const
+	{
+		auto factory = dynamic_cast<const UIViewFactory*> (desc->getViewFactory ());
+		std::vector<std::string> result;
+		for (auto view : *selection)
+		{
+			std::string value;
+			factory->getAttributeValue (view, attrName, value, desc);
+			result.emplace_back (value);
+		}
+		return result;
+	}
+
+	Xml::MemoryContentProvider provider;
+	SharedPointer<UIDescription> desc;
+	SharedPointer<UISelection> selection;
+	SharedPointer<UIUndoManager> undoManager;
+	SharedPointer<CView> container;
+};
+
+} // anonymous
+
+TESTCASE(UIUndoManagerTest,
+
+	TEST(undoRedo,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->pushAndPerform (new ValueAction (value, 1));
+		undoManager->pushAndPerform (new ValueAction (value, 2));
+		EXPECT(value == 2);
+		undoManager->performUndo ();
+		EXPECT(value == 1);
+		undoManager->performUndo ();
+		EXPECT(value == 0);
+		EXPECT(undoManager->canUndo () == false);
+		undoManager->performRedo ();
+		undoManager->performRedo ();
+		EXPECT(value == 2);
+		EXPECT(undoManager->canRedo () == false);
+	);
+
+	TEST(stepLimitDropsOldestSteps,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setLimits (3, UIUndoManager::kDefaultMaxMemorySize);
+		for (auto i = 1; i <= 5; ++i)
+			undoManager->pushAndPerform (new ValueAction (value, i));
+		EXPECT(undoManager->getNumSteps () == 3);
+		while (undoManager->canUndo ())
+			undoManager->performUndo ();
+		EXPECT(value == 2);
+		while (undoManager->canRedo ())
+			undoManager->performRedo ();
+		EXPECT(value == 5);
+	);
+
+	TEST(memoryLimitDropsOldestSteps,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setLimits (UIUndoManager::kDefaultMaxSteps, 250);
+		for (auto i = 1; i <= 4; ++i)
+			undoManager->pushAndPerform (new ValueAction (value, i, 100));
+		EXPECT(undoManager->getNumSteps () == 2);
+		EXPECT(undoManager->getMemorySize () == 200);
+	);
+
+	TEST(memorySizeFollowsDroppedRedoStepsAndClear,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		for (auto i = 1; i <= 3; ++i)
+			undoManager->pushAndPerform (new ValueAction (value, i, 100));
+		EXPECT(undoManager->getMemorySize () == 300);
+		undoManager->performUndo ();
+		undoManager->performUndo ();
+		EXPECT(undoManager->getMemorySize () == 300);
+		undoManager->pushAndPerform (new ValueAction (value, 4, 50));
+		EXPECT(undoManager->getMemorySize () == 150);
+		undoManager->clear ();
+		EXPECT(undoManager->getMemorySize () == 0);
+	);
+
+	TEST(currentStepIsKeptWhenItExceedsTheMemoryLimit,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setLimits (UIUndoManager::kDefaultMaxSteps, 50);
+		undoManager->pushAndPerform (new ValueAction (value, 1, 100));
+		undoManager->pushAndPerform (new ValueAction (value, 2, 100));
+		EXPECT(undoManager->getNumSteps () == 1);
+		undoManager->performUndo ();
+		EXPECT(value == 1);
+	);
+
+	TEST(redoStepsAreKeptWhenLimitsAreLowered,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		for (auto i = 1; i <= 4; ++i)
+			undoManager->pushAndPerform (new ValueAction (value, i));
+		undoManager->performUndo ();
+		undoManager->performUndo ();
+		undoManager->setLimits (1, UIUndoManager::kDefaultMaxMemorySize);
+		EXPECT(undoManager->getNumSteps () == 3);
+		undoManager->performUndo ();
+		EXPECT(value == 1);
+		EXPECT(undoManager->canUndo () == false);
+	);
+
+	TEST(savePositionAfterDroppingSteps,
+		int32_t value = 0;
+		auto undoManager = makeOwned<UIUndoManager> ();
+		undoManager->setLimits (2, UIUndoManager::kDefaultMaxMemorySize);
+		undoManager->pushAndPerform (new ValueAction (value, 1));
+		undoManager->markSavePosition ();
+		undoManager->pushAndPerform (new ValueAction (value, 2));
+		undoManager->pushAndPerform (new ValueAction (value, 3));
+		EXPECT(undoManager->isSavePosition () == false);
+		undoManager->performUndo ();
+		undoManager->performUndo ();
+		EXPECT(value == 1);
+		EXPECT(undoManager->isSavePosition ());
+		undoManager->pushAndPerform (new ValueAction (value, 4));
+		undoManager->pushAndPerform (new ValueAction (value, 5));
+		undoManager->pushAndPerform (new ValueAction (value, 6));
+		while (undoManager->canUndo ())
+			undoManager->performUndo ();
+		EXPECT(undoManager->isSavePosition () == false);
+	);
+
+	TEST(attributeChangeRoundTrip,
+		AttributeChangeFixture f;
+		EXPECT(f.selection->total () == 3);
+		auto oldValues = f.getValues ("opacity");
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.25"));
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.25");
+		f.undoManager->performUndo ();
+		EXPECT(f.getValues ("opacity") == oldValues);
+		f.undoManager->performRedo ();
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.25");
+	);
+
+	TEST(consecutiveAttributeChangesAreCoalesced,
+		AttributeChangeFixture f;
+		auto oldValues = f.getValues ("opacity");
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.25"));
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.75"));
+		EXPECT(f.undoManager->getNumSteps () == 1);
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.75");
+		f.undoManager->performUndo ();
+		EXPECT(f.getValues ("opacity") == oldValues);
+		f.undoManager->performRedo ();
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.75");
+	);
+
+	TEST(attributeChangesAreNotCoalescedAcrossTheSavePosition,
+		AttributeChangeFixture f;
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.25"));
+		f.undoManager->markSavePosition ();
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.75"));
+		EXPECT(f.undoManager->getNumSteps () == 2);
+		f.undoManager->performUndo ();
+		EXPECT(f.undoManager->isSavePosition ());
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.25");
+	);
+
+	TEST(changesOfDifferentAttributesAreNotCoalesced,
+		AttributeChangeFixture f;
+		auto oldOpacity = f.getValues ("opacity");
+		auto oldTransparent = f.getValues ("transparent");
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "opacity", "0.25"));
+		f.undoManager->pushAndPerform (
+		    new AttributeChangeAction (f.desc, f.selection, "transparent", "true"));
+		EXPECT(f.undoManager->getNumSteps () == 2);
+		f.undoManager->performUndo ();
+		EXPECT(f.getValues ("transparent") == oldTransparent);
+		for (auto& value : f.getValues ("opacity"))
+			EXPECT(value == "0.25");
+		f.undoManager->performUndo ();
+		EXPECT(f.getValues ("opacity") == oldOpacity);
+	);
+);
+
+} // VSTGUI
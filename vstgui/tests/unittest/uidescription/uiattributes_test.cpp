@@ -105,6 +105,58 @@ TESTCASE(UIAttributesTest,
 		EXPECT(a.begin () == a.end ());
 	);
 	
+	TEST(moreAttributesThanInlineCapacity,
+		UIAttributes a;
+		constexpr auto numAttributes = UIAttributes::kInlineCapacity * 3;
+		for (auto i = 0u; i < numAttributes; ++i)
+			a.setIntegerAttribute ("Key" + std::to_string (i), static_cast<int32_t> (i));
+		EXPECT(a.size () == numAttributes);
+		for (auto i = 0u; i < numAttributes; ++i)
+		{
+			int32_t value;
+			EXPECT(a.getIntegerAttribute ("Key" + std::to_string (i), value));
+			EXPECT(value == static_cast<int32_t> (i));
+		}
+		a.removeAttribute ("Key0");
+		EXPECT(a.hasAttribute ("Key0") == false);
+		EXPECT(a.hasAttribute ("Key1"));
+		EXPECT(a.size () == numAttributes - 1);
+		UIAttributes copy (a);
+		EXPECT(copy.size () == a.size ());
+		EXPECT(*copy.getAttributeValue ("Key5") == "5");
+		a.removeAll ();
+		EXPECT(a.empty ());
+		a.setAttribute ("Key", "Value");
+		EXPECT(*a.getAttributeValue ("Key") == "Value");
+	);
+
+	TEST(removeKeepsOrder,
+		UIAttributes a (attributes);
+		a.setAttribute ("K3", "V3");
+		a.removeAttribute ("K1");
+		EXPECT(a.size () == 2);
+		EXPECT(a.begin ()->first.getString () == "K2");
+		EXPECT((a.begin () + 1)->first.getString () == "K3");
+	);
+
+	TEST(internedNames,
+		UIAttributeName name1 ("origin");
+		UIAttributeName name2 (std::string ("origin"));
+		UIAttributeName name3 ("size");
+		EXPECT(name1 == name2);
+		EXPECT(&name1.getString () == &name2.getString ());
+		EXPECT(name1 != name3);
+		EXPECT(UIAttributeName () == UIAttributeName (""));
+
+		UIAttributes a;
+		a.setAttribute (name1, "10, 10");
+		EXPECT(a.hasAttribute (name2));
+		EXPECT(*a.getAttributeValue ("origin") == "10, 10");
+		a.setAttribute ("origin", "20, 20");
+		EXPECT(*a.getAttributeValue (name1) == "20, 20");
+		EXPECT(a.begin ()->first == name1);
+	);
+
 	TEST(storeRestore,
 		UIAttributes a;
 		CMemoryStream s2;
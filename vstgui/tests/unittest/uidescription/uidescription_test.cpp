@@ -13,6 +13,9 @@
 #include "../../../lib/cbitmap.h"
 #include "../../../lib/cgradient.h"
 #include "../../../lib/cviewcontainer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
 
 namespace VSTGUI {
 
@@ -184,10 +187,39 @@ struct SaveUIDescription : public UIDescription
 {
 	SaveUIDescription (Xml::IContentProvider* xmlContentProvider)
 	: UIDescription (xmlContentProvider) {}
+	SaveUIDescription (const CResourceDescription& file)
+	: UIDescription (file) {}
 
 	using UIDescription::saveToStream;
 };
 
+/** a file in the temporary directory which is removed when it goes out of scope */
+struct TempFile
+{
+	explicit TempFile (const char* fileName)
+	{
+#if WINDOWS
+		const char* dir = std::getenv ("TEMP");
+		constexpr auto separator = '\\';
+#else
+		const char* dir = std::getenv ("TMPDIR");
+		constexpr auto separator = '/';
+		if (dir == nullptr)
+			dir = "/tmp";
+#endif
+		if (dir && *dir)
+		{
+			path = dir;
+			if (path.back () != separator)
+				path += separator;
+		}
+		path += fileName;
+	}
+	~TempFile () noexcept { std::remove (path.data ()); }
+
+	std::string path;
+};
+
 struct Controller : public IController
 {
 	void valueChanged (CControl* pControl) override {};
@@ -654,6 +686,83 @@ TESTCASE(UIDescriptionTests,
 		EXPECT(result == str);
 	);
 
+	TEST(writeBitmapDataToStream,
+		std::string str (withAllNodesUIDesc);
+		Xml::MemoryContentProvider provider (str.data (), static_cast<uint32_t> (str.size ()));
+		SaveUIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		CMemoryStream outputStream (1024, 1024, false);
+		EXPECT(desc.saveToStream (outputStream, SaveUIDescription::kWriteImagesIntoXMLFile | SaveUIDescription::kDoNotVerifyImageXMLData));
+		outputStream.end ();
+		std::string result (reinterpret_cast<const char*> (outputStream.getBuffer ()));
+		EXPECT(result == str);
+	);
+
+	TEST(parseWithWorkerThreads,
+		std::string str (withAllNodesUIDesc);
+		Xml::MemoryContentProvider provider (str.data (), static_cast<uint32_t> (str.size ()));
+		SaveUIDescription desc (&provider);
+		desc.setNumWorkerThreads (2);
+		EXPECT(desc.parse () == true);
+		CMemoryStream outputStream (1024, 1024, false);
+		EXPECT(desc.saveToStream (outputStream, SaveUIDescription::kWriteImagesIntoXMLFile | SaveUIDescription::kDoNotVerifyImageXMLData));
+		outputStream.end ();
+		std::string result (reinterpret_cast<const char*> (outputStream.getBuffer ()));
+		EXPECT(result == str);
+	);
+
+	TEST(writeAgainAfterChange,
+		std::string str (withAllNodesUIDesc);
+		Xml::MemoryContentProvider provider (str.data (), static_cast<uint32_t> (str.size ()));
+		SaveUIDescription desc (&provider);
+		EXPECT(desc.parse () == true);
+		auto save = [&] () {
+			CMemoryStream outputStream (1024, 1024, false);
+			EXPECT(desc.saveToStream (outputStream, SaveUIDescription::kWriteImagesIntoXMLFile | SaveUIDescription::kDoNotVerifyImageXMLData));
+			outputStream.end ();
+			return std::string (reinterpret_cast<const char*> (outputStream.getBuffer ()));
+		};
+		EXPECT(save () == str);
+		desc.changeColor ("c1", CColor (255, 0, 0, 255));
+		std::string expected (str);
+		std::string oldColor ("<color name=\"c1\" rgba=\"#000000ff\"/>");
+		auto pos = expected.find (oldColor);
+		EXPECT(pos != std::string::npos);
+		expected.replace (pos, oldColor.size (), "<color name=\"c1\" rgba=\"#ff0000ff\"/>");
+		EXPECT(save () == expected);
+		EXPECT(save () == expected);
+		desc.removeColor ("c2");
+		std::string removedColor ("\t\t<color name=\"c2\" rgb=\"#ffffff\"/>\n");
+		pos = expected.find (removedColor);
+		EXPECT(pos != std::string::npos);
+		expected.erase (pos, removedColor.size ());
+		EXPECT(save () == expected);
+	);
+
+	TEST(compiledDescriptionRoundTrip,
+		TempFile file ("uidescription_test.compiled.uidesc");
+		auto fileName = file.path.data ();
+		std::string str (withAllNodesUIDesc);
+		{
+			Xml::MemoryContentProvider provider (str.data (), static_cast<uint32_t> (str.size ()));
+			SaveUIDescription desc (&provider);
+			EXPECT(desc.parse () == true);
+			CFileStream fileStream;
+			EXPECT(fileStream.open (fileName, CFileStream::kWriteMode | CFileStream::kTruncateMode));
+			EXPECT(desc.saveToStream (fileStream, SaveUIDescription::kWriteImagesIntoXMLFile | SaveUIDescription::kDoNotVerifyImageXMLData | SaveUIDescription::kWriteCompiledDesc));
+		}
+		SaveUIDescription desc {CResourceDescription (fileName)};
+		EXPECT(desc.parse () == true);
+		CColor color;
+		EXPECT(desc.getColor ("c3", color));
+		EXPECT(color == CColor (255, 0, 0, 100));
+		CMemoryStream outputStream (1024, 1024, false);
+		EXPECT(desc.saveToStream (outputStream, SaveUIDescription::kWriteImagesIntoXMLFile | SaveUIDescription::kDoNotVerifyImageXMLData));
+		outputStream.end ();
+		std::string result (reinterpret_cast<const char*> (outputStream.getBuffer ()));
+		EXPECT(result == str);
+	);
+
 	TEST(getViewAttributes,
 		 Xml::MemoryContentProvider provider (createViewUIDesc, static_cast<uint32_t> (strlen(createViewUIDesc)));
 		 UIDescription desc (&provider);
@@ -38,6 +38,16 @@ TESTCASE(CViewContainerCreatorTest,
 		});
 	);
 
+	TEST(cacheAsBitmap,
+		DummyUIDescription uidesc;
+		testAttribute<CViewContainer>(kCViewContainer, kAttrCacheAsBitmap, true, &uidesc, [] (CViewContainer* v) {
+			return v->getCacheAsBitmap ();
+		});
+		testAttribute<CViewContainer>(kCViewContainer, kAttrCacheAsBitmap, false, &uidesc, [] (CViewContainer* v) {
+			return v->getCacheAsBitmap () == false;
+		});
+	);
+
 	TEST(backgroundColorDrawStyleValues,
 		DummyUIDescription uidesc;
 		testPossibleValues (kCViewContainer, kAttrBackgroundColorDrawStyle, &uidesc, {"stroked", "filled", "filled and stroked"});
@@ -0,0 +1,143 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/lib/cdrawcontext.h"
+#include "vstgui/lib/platform/linux/x11drawhandler.h"
+#include "vstgui/lib/platform/linux/x11platform.h"
+#include "vstgui/lib/platform/linux/x11utils.h"
+
+#include <xcb/xcb.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace VSTGUI;
+
+//------------------------------------------------------------------------
+// the draw handler only needs the X server connection of the run loop. This benchmark needs a
+// display (e.g. Xvfb), MIT-SHM is only available on local displays
+struct NoopRunLoop : X11::IRunLoop, AtomicReferenceCounted
+{
+	bool registerEventHandler (int fd, X11::IEventHandler* handler) override { return true; }
+	bool unregisterEventHandler (X11::IEventHandler* handler) override { return true; }
+	bool registerTimer (uint64_t interval, X11::ITimerHandler* handler) override { return true; }
+	bool unregisterTimer (X11::ITimerHandler* handler) override { return true; }
+};
+
+//------------------------------------------------------------------------
+static SharedPointer<CBitmap> createTileBitmap (CCoord size)
+{
+	auto bitmap = makeOwned<CBitmap> (CPoint (size, size));
+	auto accessor = owned (CBitmapPixelAccess::create (bitmap));
+	if (!accessor)
+		return nullptr;
+	auto pixelSize = static_cast<uint32_t> (size);
+	for (auto y = 0u; y < pixelSize; ++y)
+	{
+		for (auto x = 0u; x < pixelSize; ++x)
+		{
+			accessor->setPosition (x, y);
+			accessor->setColor (CColor (static_cast<uint8_t> (x), static_cast<uint8_t> (y),
+										static_cast<uint8_t> (x ^ y), 128 + (x + y) % 128));
+		}
+	}
+	return bitmap;
+}
+
+//------------------------------------------------------------------------
+static const char* getModeName (X11::BackBufferMode mode)
+{
+	return mode == X11::BackBufferMode::SharedMemory ? "shared memory" : "x server";
+}
+
+//------------------------------------------------------------------------
+static void benchmark (const X11::ChildWindow& window, X11::BackBufferMode requestedMode,
+					   CBitmap* tile, uint32_t numFrames)
+{
+	auto xcb = X11::RunLoop::instance ().getXcbConnection ();
+	X11::DrawHandler drawHandler (window, requestedMode);
+
+	CRect frameRect;
+	frameRect.setSize (window.getSize ());
+	X11::DrawHandler::RectList dirtyRects;
+	dirtyRects.emplace_back (frameRect);
+
+	uint32_t frameIndex = 0;
+	auto drawFrame = [&] (CDrawContext* context, const CRect& rect) {
+		context->setFillColor (CColor (frameIndex % 255, 40, 40));
+		context->drawRect (rect, kDrawFilled);
+		auto tileSize = tile->getSize ();
+		for (auto y = rect.top; y < rect.bottom; y += tileSize.y)
+		{
+			for (auto x = rect.left; x < rect.right; x += tileSize.x)
+			{
+				CRect dest (x, y, x + tileSize.x, y + tileSize.y);
+				dest.offset ((frameIndex % 8), 0);
+				tile->draw (context, dest);
+			}
+		}
+		context->setFillColor (CColor (255, 255, 255, 100));
+		for (auto i = 0; i < 64; ++i)
+		{
+			CRect r (0, 0, 40, 40);
+			r.offset ((i * 37 + frameIndex * 3) % static_cast<int> (rect.getWidth ()),
+					  (i * 53) % static_cast<int> (rect.getHeight ()));
+			context->drawEllipse (r, kDrawFilled);
+		}
+	};
+
+	// warm up
+	drawHandler.draw (dirtyRects, drawFrame);
+	free (xcb_get_input_focus_reply (xcb, xcb_get_input_focus (xcb), nullptr));
+
+	auto start = std::chrono::high_resolution_clock::now ();
+	for (frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+		drawHandler.draw (dirtyRects, drawFrame);
+	// wait until the X server processed all frames
+	free (xcb_get_input_focus_reply (xcb, xcb_get_input_focus (xcb), nullptr));
+	auto end = std::chrono::high_resolution_clock::now ();
+
+	std::chrono::duration<double, std::milli> duration = end - start;
+	printf ("%-14s (requested %-13s): %4u frames of %dx%d in %8.2f ms (%7.1f fps)\n",
+			getModeName (drawHandler.getMode ()), getModeName (requestedMode), numFrames,
+			static_cast<int> (frameRect.getWidth ()), static_cast<int> (frameRect.getHeight ()),
+			duration.count (), numFrames / (duration.count () / 1000.));
+}
+
+//------------------------------------------------------------------------
+int main ()
+{
+	constexpr uint32_t numFrames = 200;
+	const CPoint windowSize (1024, 768);
+
+	X11::RunLoop::init (makeOwned<NoopRunLoop> ());
+	auto xcb = X11::RunLoop::instance ().getXcbConnection ();
+	if (!xcb || xcb_connection_has_error (xcb))
+	{
+		printf ("no X server connection\n");
+		X11::RunLoop::exit ();
+		return -1;
+	}
+
+	{
+		auto screen = xcb_setup_roots_iterator (xcb_get_setup (xcb)).data;
+		X11::ChildWindow window (screen->root, windowSize);
+		xcb_map_window (xcb, window.getID ());
+		xcb_flush (xcb);
+
+		auto tile = createTileBitmap (64);
+		if (!tile)
+			return -1;
+
+		benchmark (window, X11::BackBufferMode::XServer, tile, numFrames);
+		benchmark (window, X11::BackBufferMode::SharedMemory, tile, numFrames);
+
+		xcb_destroy_window (xcb, window.getID ());
+		xcb_flush (xcb);
+	}
+
+	X11::RunLoop::exit ();
+	return 0;
+}
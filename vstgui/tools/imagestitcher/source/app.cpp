@@ -2,6 +2,7 @@
 // in the LICENSE file found in the top-level directory of this
 // distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
 
+#include "batch.h"
 #include "documentcontroller.h"
 #include "startupcontroller.h"
 #include "vstgui/standalone/include/helpers/appdelegate.h"
@@ -11,6 +12,8 @@
 #include "vstgui/standalone/include/icommand.h"
 #include "vstgui/standalone/include/iuidescwindow.h"
 #include "vstgui/uidescription/cstream.h"
+#include <cstdlib>
+#include <iostream>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -50,6 +53,14 @@ public:
 	void finishLaunching () override
 	{
 		auto& app = IApplication::instance ();
+		if (auto batchOptions = parseBatchArguments (app.getCommandLineArguments (), std::cerr))
+		{
+			auto numFailed = runBatch (*batchOptions, std::cout, std::cerr);
+			// no window was opened, so nothing needs the regular quit path and the exit code
+			// tells the calling script whether all documents were exported
+			std::exit (numFailed ? EXIT_FAILURE : EXIT_SUCCESS);
+		}
+
 		app.registerCommand (Commands::NewDocument, 'n');
 		app.registerCommand (Commands::OpenDocument, 'o');
 		app.registerCommand (Commands::SaveDocument, 's');
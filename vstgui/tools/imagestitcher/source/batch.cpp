@@ -0,0 +1,428 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#include "batch.h"
+#include "vstgui/lib/cpoint.h"
+#include "vstgui/lib/platform/iplatformbitmap.h"
+#include "vstgui/uidescription/cstream.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+
+#if WINDOWS
+#include <objbase.h>
+#endif
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace ImageStitcher {
+
+//------------------------------------------------------------------------
+namespace {
+#define MINIZ_NO_STDIO
+#define MINIZ_NO_ARCHIVE_APIS
+#define MINIZ_NO_ARCHIVE_WRITING_APIS
+#include "vstgui/uidescription/miniz/miniz.c"
+}
+
+//------------------------------------------------------------------------
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using PixelAccessPtr = SharedPointer<IPlatformBitmapPixelAccess>;
+
+static constexpr uint32_t RowsPerTask = 32;
+
+//------------------------------------------------------------------------
+double getMilliseconds (Clock::time_point start, Clock::time_point end)
+{
+	return std::chrono::duration<double, std::milli> (end - start).count ();
+}
+
+//------------------------------------------------------------------------
+Path getOutputPath (const Path& documentPath, const Path& outputDirectory)
+{
+	auto outputPath = documentPath;
+	auto extPos = outputPath.find_last_of ('.');
+	auto sepPos = outputPath.find_last_of (PathSeparator);
+	if (extPos != Path::npos && (sepPos == Path::npos || extPos > sepPos))
+		outputPath.erase (extPos);
+	outputPath += ".png";
+	if (outputDirectory.empty ())
+		return outputPath;
+	if (sepPos != Path::npos)
+		outputPath.erase (0, sepPos + 1);
+	auto dir = outputDirectory;
+	if (dir.back () != *PathSeparator)
+		dir += PathSeparator;
+	return dir + outputPath;
+}
+
+//------------------------------------------------------------------------
+/** reports the documents whose output path is already used by a previous document */
+bool checkOutputPaths (const BatchOptions& options, std::ostream& err)
+{
+	std::unordered_map<Path, const Path*> outputPaths;
+	bool result = true;
+	for (const auto& documentPath : options.documents)
+	{
+		auto it = outputPaths.emplace (getOutputPath (documentPath, options.outputDirectory),
+		                               &documentPath);
+		if (!it.second)
+		{
+			err << documentPath << ": output " << it.first->first << " is also written by "
+			    << *it.first->second << "\n";
+			result = false;
+		}
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+/** calls proc with every index in [0, count) from numThreads threads, including the caller */
+template <typename Proc>
+void parallelFor (size_t count, uint32_t numThreads, Proc proc)
+{
+	std::atomic<size_t> next {0};
+	auto worker = [&] () {
+		size_t index;
+		while ((index = next++) < count)
+			proc (index);
+	};
+	auto numWorkers = std::min<size_t> (numThreads, count);
+	std::vector<std::thread> threads;
+	threads.reserve (numWorkers);
+	for (size_t i = 1; i < numWorkers; ++i)
+	{
+		threads.emplace_back ([&] () {
+#if WINDOWS
+			// the WIC decoder needs COM on the calling thread
+			auto hr = CoInitializeEx (nullptr, COINIT_MULTITHREADED);
+			worker ();
+			if (SUCCEEDED (hr))
+				CoUninitialize ();
+#else
+			worker ();
+#endif
+		});
+	}
+	worker ();
+	for (auto& thread : threads)
+		thread.join ();
+}
+
+//------------------------------------------------------------------------
+/** byte offsets of the red, green, blue and alpha channel of a pixel */
+struct ChannelOrder
+{
+	uint32_t r, g, b, a;
+};
+
+//------------------------------------------------------------------------
+ChannelOrder getChannelOrder (IPlatformBitmapPixelAccess::PixelFormat format)
+{
+	switch (format)
+	{
+		case IPlatformBitmapPixelAccess::kARGB: return {1, 2, 3, 0};
+		case IPlatformBitmapPixelAccess::kRGBA: return {0, 1, 2, 3};
+		case IPlatformBitmapPixelAccess::kABGR: return {3, 2, 1, 0};
+		case IPlatformBitmapPixelAccess::kBGRA: return {2, 1, 0, 3};
+	}
+	return {0, 1, 2, 3};
+}
+
+//------------------------------------------------------------------------
+/** converts one row of premultiplied pixels to straight RGBA as PNG wants it */
+void copyRow (const uint8_t* src, uint8_t* dst, uint32_t width, ChannelOrder order)
+{
+	for (uint32_t x = 0; x < width; ++x, src += 4, dst += 4)
+	{
+		auto alpha = src[order.a];
+		dst[3] = alpha;
+		if (alpha == 0)
+		{
+			dst[0] = dst[1] = dst[2] = 0;
+		}
+		else if (alpha == 255)
+		{
+			dst[0] = src[order.r];
+			dst[1] = src[order.g];
+			dst[2] = src[order.b];
+		}
+		else
+		{
+			auto unpremultiply = [alpha] (uint8_t value) {
+				return static_cast<uint8_t> (
+				    std::min<uint32_t> (255u, (value * 255u + alpha / 2u) / alpha));
+			};
+			dst[0] = unpremultiply (src[order.r]);
+			dst[1] = unpremultiply (src[order.g]);
+			dst[2] = unpremultiply (src[order.b]);
+		}
+	}
+}
+
+//------------------------------------------------------------------------
+struct Strip
+{
+	Path outputPath;
+	std::vector<uint8_t> pixels;
+	uint32_t width {0};
+	uint32_t height {0};
+	uint32_t numFrames {0};
+	double decodeTime {0.};
+	double composeTime {0.};
+};
+
+//------------------------------------------------------------------------
+struct EncodeResult
+{
+	bool success {false};
+	size_t fileSize {0};
+	double encodeTime {0.};
+	double writeTime {0.};
+};
+
+//------------------------------------------------------------------------
+bool decodeAndCompose (const Path& documentPath, const BatchOptions& options, uint32_t numThreads,
+                       Strip& strip, std::ostream& err)
+{
+	auto docContext = DocumentContext::loadDocument (documentPath);
+	if (!docContext)
+	{
+		err << documentPath << ": could not load document\n";
+		return false;
+	}
+	const auto& imagePaths = docContext->getImagePaths ();
+	if (imagePaths.empty ())
+	{
+		err << documentPath << ": document has no images\n";
+		return false;
+	}
+	strip.outputPath = getOutputPath (documentPath, options.outputDirectory);
+	strip.width = docContext->getWidth ();
+	strip.height = docContext->getHeight () * static_cast<uint32_t> (imagePaths.size ());
+	strip.numFrames = static_cast<uint32_t> (imagePaths.size ());
+
+	auto start = Clock::now ();
+	std::vector<SharedPointer<IPlatformBitmap>> bitmaps (imagePaths.size ());
+	std::vector<PixelAccessPtr> frames (imagePaths.size ());
+	// the reason a frame failed, the remaining frames are skipped after the first failure
+	std::vector<const char*> frameErrors (imagePaths.size (), nullptr);
+	std::atomic<bool> failed {false};
+	parallelFor (imagePaths.size (), numThreads, [&] (size_t index) {
+		if (failed)
+			return;
+		auto bitmap = IPlatformBitmap::createFromPath (imagePaths[index].data ());
+		if (!bitmap)
+		{
+			frameErrors[index] = "could not decode";
+			failed = true;
+			return;
+		}
+		const auto& size = bitmap->getSize ();
+		if (static_cast<uint32_t> (size.x) != docContext->getWidth () ||
+		    static_cast<uint32_t> (size.y) != docContext->getHeight ())
+		{
+			frameErrors[index] = "size does not match the document";
+			failed = true;
+			return;
+		}
+		// locked premultiplied on all platforms, as not every platform supports straight alpha
+		frames[index] = bitmap->lockPixels (true);
+		if (!frames[index])
+		{
+			frameErrors[index] = "could not access the pixels";
+			failed = true;
+		}
+		bitmaps[index] = std::move (bitmap);
+	});
+	auto decodeEnd = Clock::now ();
+	strip.decodeTime = getMilliseconds (start, decodeEnd);
+	if (failed)
+	{
+		for (size_t i = 0; i < imagePaths.size (); ++i)
+		{
+			if (frameErrors[i])
+				err << documentPath << ": " << imagePaths[i] << ": " << frameErrors[i] << "\n";
+		}
+		return false;
+	}
+
+	auto frameHeight = docContext->getHeight ();
+	auto dstBytesPerRow = strip.width * 4;
+	strip.pixels.resize (static_cast<size_t> (dstBytesPerRow) * strip.height);
+	auto numTasks = (strip.height + RowsPerTask - 1) / RowsPerTask;
+	parallelFor (numTasks, numThreads, [&] (size_t task) {
+		auto row = static_cast<uint32_t> (task) * RowsPerTask;
+		auto endRow = std::min (row + RowsPerTask, strip.height);
+		auto dst = strip.pixels.data () + static_cast<size_t> (row) * dstBytesPerRow;
+		for (; row < endRow; ++row, dst += dstBytesPerRow)
+		{
+			const auto& frame = frames[row / frameHeight];
+			auto src = frame->getAddress () +
+			           static_cast<size_t> (row % frameHeight) * frame->getBytesPerRow ();
+			copyRow (src, dst, strip.width, getChannelOrder (frame->getPixelFormat ()));
+		}
+	});
+	strip.composeTime = getMilliseconds (decodeEnd, Clock::now ());
+	return true;
+}
+
+//------------------------------------------------------------------------
+EncodeResult encodeAndWrite (const Strip& strip, uint32_t compressionLevel)
+{
+	EncodeResult result;
+	auto start = Clock::now ();
+	size_t pngSize = 0;
+	auto png = tdefl_write_image_to_png_file_in_memory_ex (
+	    strip.pixels.data (), static_cast<int> (strip.width), static_cast<int> (strip.height), 4,
+	    &pngSize, compressionLevel, MZ_FALSE);
+	auto encodeEnd = Clock::now ();
+	result.encodeTime = getMilliseconds (start, encodeEnd);
+	if (!png)
+		return result;
+
+	CFileStream stream;
+	if (stream.open (strip.outputPath.data (), CFileStream::kWriteMode | CFileStream::kBinaryMode |
+	                                               CFileStream::kTruncateMode))
+	{
+		result.success =
+		    stream.writeRaw (png, static_cast<uint32_t> (pngSize)) == static_cast<uint32_t> (pngSize);
+		result.fileSize = pngSize;
+	}
+	mz_free (png);
+	result.writeTime = getMilliseconds (encodeEnd, Clock::now ());
+	return result;
+}
+
+//------------------------------------------------------------------------
+bool parseUInt (const UTF8String& str, uint32_t maxValue, uint32_t& value)
+{
+	char* end = nullptr;
+	auto v = std::strtoul (str.data (), &end, 10);
+	if (str.empty () || *end != 0 || v > maxValue)
+		return false;
+	value = static_cast<uint32_t> (v);
+	return true;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+Optional<BatchOptions> parseBatchArguments (const std::vector<UTF8String>& arguments,
+                                            std::ostream& err)
+{
+	auto it = std::find (arguments.begin (), arguments.end (), "--batch");
+	if (it == arguments.end ())
+		return {};
+
+	BatchOptions options;
+	for (++it; it != arguments.end (); ++it)
+	{
+		auto next = std::next (it);
+		if (*it == "--output" && next != arguments.end ())
+		{
+			options.outputDirectory = next->getString ();
+			it = next;
+		}
+		else if (*it == "--compression" && next != arguments.end ())
+		{
+			if (!parseUInt (*next, MZ_BEST_COMPRESSION, options.compressionLevel))
+				err << "invalid compression level " << *next << ", using "
+				    << options.compressionLevel << "\n";
+			it = next;
+		}
+		else if (*it == "--threads" && next != arguments.end ())
+		{
+			if (!parseUInt (*next, 1024, options.numThreads))
+				err << "invalid number of threads " << *next << "\n";
+			it = next;
+		}
+		else
+		{
+			options.documents.emplace_back (it->getString ());
+		}
+	}
+	return {std::move (options)};
+}
+
+//------------------------------------------------------------------------
+uint32_t runBatch (const BatchOptions& options, std::ostream& out, std::ostream& err)
+{
+	if (!checkOutputPaths (options, err))
+		return static_cast<uint32_t> (options.documents.size ());
+
+	auto numThreads = options.numThreads;
+	if (numThreads == 0)
+		numThreads = std::max (1u, std::thread::hardware_concurrency ());
+
+	uint32_t numFailed = 0;
+	uint64_t numFrames = 0;
+	uint64_t numPixelBytes = 0;
+	uint64_t numFileBytes = 0;
+
+	auto start = Clock::now ();
+	// the strip of the previous document is encoded while the next one is decoded
+	Strip pendingStrip;
+	std::future<EncodeResult> pendingResult;
+	auto finishPending = [&] () {
+		if (!pendingResult.valid ())
+			return;
+		auto result = pendingResult.get ();
+		if (!result.success)
+		{
+			err << pendingStrip.outputPath << ": could not write PNG\n";
+			++numFailed;
+			return;
+		}
+		numFrames += pendingStrip.numFrames;
+		numPixelBytes += pendingStrip.pixels.size ();
+		numFileBytes += result.fileSize;
+		out << pendingStrip.outputPath << ": " << pendingStrip.numFrames << " frames, "
+		    << pendingStrip.width << "x" << pendingStrip.height << ", " << result.fileSize
+		    << " bytes, decode " << pendingStrip.decodeTime << " ms, compose "
+		    << pendingStrip.composeTime << " ms, encode " << result.encodeTime << " ms, write "
+		    << result.writeTime << " ms\n";
+	};
+
+	for (const auto& documentPath : options.documents)
+	{
+		Strip strip;
+		if (!decodeAndCompose (documentPath, options, numThreads, strip, err))
+		{
+			++numFailed;
+			continue;
+		}
+		finishPending ();
+		pendingStrip = std::move (strip);
+		pendingResult = std::async (std::launch::async, encodeAndWrite, std::cref (pendingStrip),
+		                            options.compressionLevel);
+	}
+	finishPending ();
+
+	auto seconds = getMilliseconds (start, Clock::now ()) / 1000.;
+	auto numDocuments = static_cast<uint32_t> (options.documents.size ()) - numFailed;
+	out << numDocuments << " documents, " << numFrames << " frames in " << seconds << " s";
+	if (seconds > 0.)
+	{
+		out << ": " << numFrames / seconds << " frames/s, "
+		    << numPixelBytes / (1024. * 1024.) / seconds << " MB/s decoded, "
+		    << numFileBytes / (1024. * 1024.) / seconds << " MB/s written";
+	}
+	out << " (" << numThreads << " threads, compression " << options.compressionLevel << ")\n";
+	if (numFailed)
+		err << numFailed << " documents failed\n";
+	return numFailed;
+}
+
+//------------------------------------------------------------------------
+} // ImageStitcher
+} // VSTGUI
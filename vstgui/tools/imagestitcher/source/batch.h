@@ -0,0 +1,52 @@
+// This file is part of VSTGUI. It is subject to the license terms
+// in the LICENSE file found in the top-level directory of this
+// distribution and at http://github.com/steinbergmedia/vstgui/LICENSE
+
+#pragma once
+
+#include "document.h"
+#include "vstgui/lib/cstring.h"
+#include "vstgui/lib/optional.h"
+#include <iosfwd>
+
+//------------------------------------------------------------------------
+namespace VSTGUI {
+namespace ImageStitcher {
+
+//------------------------------------------------------------------------
+struct BatchOptions
+{
+	/** the .imagestitch documents to export */
+	PathList documents;
+	/** output directory, if empty the PNG is written next to its document. The batch fails when
+	 *	two documents would write the same PNG */
+	Path outputDirectory;
+	/** zlib compression level 0 (none) to 9 (best) */
+	uint32_t compressionLevel {6};
+	/** number of worker threads, 0 uses the number of hardware threads */
+	uint32_t numThreads {0};
+};
+
+//------------------------------------------------------------------------
+/** parses the command line arguments of the application
+ *
+ *	returns an empty optional if the arguments do not contain --batch
+ *
+ *	usage: ImageStitcher --batch [--output dir] [--compression 0-9] [--threads n] file...
+ */
+Optional<BatchOptions> parseBatchArguments (const std::vector<UTF8String>& arguments,
+                                            std::ostream& err);
+
+//------------------------------------------------------------------------
+/** exports the stitched PNG of every document without opening a window
+ *
+ *	the frames of a document are decoded in parallel and copied row-parallel into the strip. The
+ *	PNG of a document is encoded and written while the frames of the next document are decoded.
+ *
+ *	@return the number of documents which failed to export
+ */
+uint32_t runBatch (const BatchOptions& options, std::ostream& out, std::ostream& err);
+
+//------------------------------------------------------------------------
+} // ImageStitcher
+} // VSTGUI
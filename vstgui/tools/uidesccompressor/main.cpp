@@ -39,6 +39,8 @@ int main (int argv, char* argc[])
 	std::string inputPath;
 	std::string outputPath;
 	bool noCompression = false;
+	bool compiled = false;
+	bool rawDeflate = false;
 	uint32_t compressionLevel = 1;
 	for (auto i = 0; i < argv; ++i)
 	{
@@ -65,13 +67,21 @@ int main (int argv, char* argc[])
 		{
 			noCompression = true;
 		}
+		else if (arg == "--compiled")
+		{
+			compiled = true;
+		}
+		else if (arg == "--raw")
+		{
+			rawDeflate = true;
+		}
 	}
 	if (inputPath.empty () || outputPath.empty ())
 	{
 		printAndTerminate ("No input or output path specified!");
 	}
 	printf ("Copy %s to %s%s\n", inputPath.data (), outputPath.data (),
-	        noCompression ? " [uncompressed]" : "[compressed]");
+	        compiled ? " [compiled]" : noCompression ? " [uncompressed]" : "[compressed]");
 
 	CompressedUIDescription uiDesc (CResourceDescription (inputPath.data ()));
 	if (!uiDesc.parse ())
@@ -79,7 +89,15 @@ int main (int argv, char* argc[])
 		printAndTerminate ("Parsing failed!");
 	}
 	int32_t flags = UIDescription::kWriteImagesIntoXMLFile;
-	if (noCompression)
+	if (compiled)
+	{
+		flags |= UIDescription::kWriteCompiledDesc;
+		if (!uiDesc.UIDescription::save (outputPath.data (), flags))
+		{
+			printAndTerminate ("saving failed");
+		}
+	}
+	else if (noCompression)
 	{
 		if (inputPath == outputPath && uiDesc.getOriginalIsCompressed () == false)
 			return 0;
@@ -97,6 +115,8 @@ int main (int argv, char* argc[])
 		flags |= CompressedUIDescription::kNoPlainXmlFileBackup |
 		         CompressedUIDescription::kForceWriteCompressedDesc |
 		         CompressedUIDescription::kDoNotVerifyImageXMLData;
+		if (rawDeflate)
+			flags |= CompressedUIDescription::kWriteRawDeflate;
 		uiDesc.setCompressionLevel (compressionLevel);
 		if (!uiDesc.save (outputPath.data (), flags))
 		{
@@ -5,6 +5,23 @@
 #pragma once
 
 #include "../lib/malloc.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VSTGUI_BASE64_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define VSTGUI_BASE64_TARGET(x)
+#else
+#define VSTGUI_BASE64_TARGET(x) __attribute__ ((target (x)))
+#endif
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_NEON)
+#define VSTGUI_BASE64_NEON_SIMD 1
+#include <arm_neon.h>
+#endif
 
 namespace VSTGUI {
 
@@ -30,34 +47,30 @@ public:
 		static_assert (sizeof (T) == 1, "T must be one byte type");
 		Result r;
 		r.data.allocate ((inBufferSize * 3 / 4) + 3);
-		uint8_t input1[4];
-		uint8_t input2[4];
-		auto input1Ptr = reinterpret_cast<uint32_t*>(&input1[0]);
-		auto input2Ptr = reinterpret_cast<uint32_t*>(&input2[0]);
-		auto buffer32Ptr = reinterpret_cast<const uint32_t*> (inBuffer);
-		while (inBufferSize > 8)
-		{
-			*input1Ptr = *buffer32Ptr++;
-			*input2Ptr = *buffer32Ptr++;
-			r.dataSize += decodeblock<false> (input1, r.data.get () + r.dataSize);
-			r.dataSize += decodeblock<false> (input2, r.data.get () + r.dataSize);
-			inBufferSize -= 8;
-		}
+		auto ptr = reinterpret_cast<const uint8_t*> (inBuffer);
+		size_t written = 0;
+		auto consumed = decodeSIMD (ptr, inBufferSize, r.data.get (), r.data.size (), written);
+		ptr += consumed;
+		inBufferSize -= consumed;
+		r.dataSize = static_cast<uint32_t> (written);
+		uint8_t input[4];
 		while (inBufferSize > 4)
 		{
-			*input1Ptr = *buffer32Ptr++;
-			r.dataSize += decodeblock<false> (input1, r.data.get () + r.dataSize);
+			input[0] = *ptr++;
+			input[1] = *ptr++;
+			input[2] = *ptr++;
+			input[3] = *ptr++;
+			r.dataSize += decodeblock<false> (input, r.data.get () + r.dataSize);
 			inBufferSize -= 4;
 		}
 		if (inBufferSize > 0)
 		{
-			input1[0] = input1[1] = input1[2] = input1[3] = '=';
-			auto ptr = reinterpret_cast<const uint8_t*>(buffer32Ptr);
+			input[0] = input[1] = input[2] = input[3] = '=';
 			for (uint32_t j = 0; j < inBufferSize; j++)
 			{
-				input1[j] = *ptr++;
+				input[j] = *ptr++;
 			}
-			r.dataSize += decodeblock<true> (input1, r.data.get () + r.dataSize);
+			r.dataSize += decodeblock<true> (input, r.data.get () + r.dataSize);
 		}
 		return r;
 	}
@@ -67,9 +80,12 @@ public:
 		Result r;
 		r.data.allocate ((binaryDataSize * 4) / 3 + 4);
 		auto ptr = reinterpret_cast<const uint8_t*> (binaryData);
+		size_t written = 0;
+		size_t i = encodeSIMD (ptr, binaryDataSize, r.data.get (), written);
+		ptr += i;
+		r.dataSize = static_cast<uint32_t> (written);
 		uint8_t input[3];
-		uint32_t i;
-		for (i = 0; i < (binaryDataSize - 3); i += 3)
+		for (; i + 3 < binaryDataSize; i += 3)
 		{
 			input[0] = *ptr++;
 			input[1] = *ptr++;
@@ -91,6 +107,108 @@ public:
 		return r;
 	}
 
+	//-----------------------------------------------------------------------------
+	/** Incremental decoder
+	 *
+	 *	The encoded data can be passed in chunks split at any position. Whitespace in the
+	 *	encoded data is ignored, so it can be fed directly from a parser.
+	 */
+	class StreamDecoder
+	{
+	public:
+		/** reserve the output buffer for the expected size of the encoded data */
+		void reserve (size_t encodedSize)
+		{
+			ensureCapacity ((encodedSize * 3 / 4) + kOutputSlack);
+		}
+
+		template <typename T>
+		void decode (const T* data, size_t size)
+		{
+			static_assert (sizeof (T) == 1, "T must be one byte type");
+			auto ptr = reinterpret_cast<const uint8_t*> (data);
+			auto end = ptr + size;
+			while (ptr < end)
+			{
+				// the vectorized decoder stops at the first whitespace character
+				if (numPending == 0)
+					ptr += decodeBulk (ptr, static_cast<size_t> (end - ptr) & ~static_cast<size_t> (3));
+				while (numPending < 4 && ptr < end)
+				{
+					auto c = *ptr++;
+					if (!isWhitespace (c))
+						pending[numPending++] = c;
+				}
+				if (numPending == 4)
+				{
+					ensureCapacity (dataSize + 3);
+					dataSize += decodeblock<true> (pending, buffer.get () + dataSize);
+					numPending = 0;
+				}
+			}
+		}
+
+		/** decode the remaining data and return the result */
+		Result finish ()
+		{
+			if (numPending)
+			{
+				for (auto i = numPending; i < 4; ++i)
+					pending[i] = '=';
+				ensureCapacity (dataSize + 3);
+				dataSize += decodeblock<true> (pending, buffer.get () + dataSize);
+				numPending = 0;
+			}
+			Result r;
+			r.data = std::move (buffer);
+			r.dataSize = static_cast<uint32_t> (dataSize);
+			dataSize = 0;
+			return r;
+		}
+
+		size_t getDecodedSize () const { return dataSize; }
+
+	private:
+		static constexpr size_t kOutputSlack = 32;
+
+		static bool isWhitespace (uint8_t c)
+		{
+			return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+		}
+
+		void ensureCapacity (size_t size)
+		{
+			if (size <= buffer.size ())
+				return;
+			auto newSize = std::max (size, buffer.size () * 2);
+			Buffer<uint8_t> newBuffer (newSize);
+			if (dataSize)
+				memcpy (newBuffer.get (), buffer.get (), dataSize);
+			buffer = std::move (newBuffer);
+		}
+
+		size_t decodeBulk (const uint8_t* ptr, size_t numChars)
+		{
+			if (numChars == 0)
+				return 0;
+			ensureCapacity (dataSize + (numChars / 4) * 3 + kOutputSlack);
+			size_t written = 0;
+			auto consumed = decodeSIMD (ptr, numChars, buffer.get () + dataSize,
+			                            buffer.size () - dataSize, written);
+			dataSize += written;
+			return consumed;
+		}
+
+		Buffer<uint8_t> buffer;
+		size_t dataSize {0};
+		uint8_t pending[4];
+		uint32_t numPending {0};
+	};
+
+	/** enable or disable the vectorized code paths (for testing and benchmarking) */
+	static void setSIMDEnabled (bool state) { simdEnabled () = state; }
+	static bool isSIMDEnabled () { return simdEnabled (); }
+
 private:
 	template<bool finalBlock = true>
 	static inline uint32_t decodeblock (uint8_t input[4], uint8_t output[3])
@@ -131,6 +249,339 @@ private:
 			(len > 1 ? cb64[((input[1] & 0x0f) << 2) | ((input[2] & 0xc0) >> 6)] : '=');
 		output[3] = static_cast<uint8_t>(len > 2 ? cb64[input[2] & 0x3f] : '=');
 	}
+
+	static bool& simdEnabled ()
+	{
+		static bool state = true;
+		return state;
+	}
+
+	// The SIMD functions process as many complete blocks as possible and stop at the first
+	// block containing characters outside of the base64 alphabet (including the '=' padding),
+	// the remaining data is processed by the scalar code.
+	// They return the number of consumed input bytes.
+
+	//-----------------------------------------------------------------------------
+	static inline size_t decodeSIMD (const uint8_t* in, size_t inSize, uint8_t* out,
+	                                 size_t outCapacity, size_t& written)
+	{
+		written = 0;
+		if (!isSIMDEnabled ())
+			return 0;
+#if VSTGUI_BASE64_X86_SIMD
+		size_t consumed = 0;
+		if (cpuFeatures ().avx2)
+			consumed = decodeAVX2 (in, inSize, out, outCapacity, written);
+		if (cpuFeatures ().ssse3)
+			consumed += decodeSSSE3 (in + consumed, inSize - consumed, out + written,
+			                         outCapacity - written, written);
+		return consumed;
+#elif VSTGUI_BASE64_NEON_SIMD
+		return decodeNEON (in, inSize, out, outCapacity, written);
+#else
+		return 0;
+#endif
+	}
+
+	//-----------------------------------------------------------------------------
+	static inline size_t encodeSIMD (const uint8_t* in, size_t inSize, uint8_t* out,
+	                                 size_t& written)
+	{
+		written = 0;
+		if (!isSIMDEnabled ())
+			return 0;
+#if VSTGUI_BASE64_X86_SIMD
+		size_t consumed = 0;
+		if (cpuFeatures ().avx2)
+			consumed = encodeAVX2 (in, inSize, out, written);
+		if (cpuFeatures ().ssse3)
+			consumed += encodeSSSE3 (in + consumed, inSize - consumed, out + written, written);
+		return consumed;
+#elif VSTGUI_BASE64_NEON_SIMD
+		return encodeNEON (in, inSize, out, written);
+#else
+		return 0;
+#endif
+	}
+
+#if VSTGUI_BASE64_X86_SIMD
+	//-----------------------------------------------------------------------------
+	struct CPUFeatures
+	{
+		bool ssse3 {false};
+		bool avx2 {false};
+	};
+
+	static const CPUFeatures& cpuFeatures ()
+	{
+		static CPUFeatures features = [] () {
+			CPUFeatures f;
+#if defined(_MSC_VER) && !defined(__clang__)
+			int info[4];
+			__cpuid (info, 0);
+			auto maxId = info[0];
+			__cpuid (info, 1);
+			f.ssse3 = (info[2] & (1 << 9)) != 0;
+			auto osUsesXSave = (info[2] & (1 << 27)) != 0;
+			auto hasAVX = (info[2] & (1 << 28)) != 0;
+			if (maxId >= 7 && osUsesXSave && hasAVX && (_xgetbv (0) & 6) == 6)
+			{
+				__cpuidex (info, 7, 0);
+				f.avx2 = (info[1] & (1 << 5)) != 0;
+			}
+#else
+			__builtin_cpu_init ();
+			f.ssse3 = __builtin_cpu_supports ("ssse3") != 0;
+			f.avx2 = __builtin_cpu_supports ("avx2") != 0;
+#endif
+			return f;
+		}();
+		return features;
+	}
+
+	//-----------------------------------------------------------------------------
+	VSTGUI_BASE64_TARGET ("ssse3")
+	static size_t decodeSSSE3 (const uint8_t* in, size_t inSize, uint8_t* out,
+	                           size_t outCapacity, size_t& written)
+	{
+		const __m128i lutLo = _mm_setr_epi8 (0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		                                     0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+		const __m128i lutHi = _mm_setr_epi8 (0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+		                                     0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+		const __m128i lutRoll =
+		    _mm_setr_epi8 (0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+		const __m128i mask2F = _mm_set1_epi8 (0x2F);
+		const __m128i pack = _mm_setr_epi8 (2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 16 && outCapacity - outPos >= 16)
+		{
+			auto str = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (in + consumed));
+			auto hiNibbles = _mm_and_si128 (_mm_srli_epi32 (str, 4), mask2F);
+			auto loNibbles = _mm_and_si128 (str, mask2F);
+			auto hi = _mm_shuffle_epi8 (lutHi, hiNibbles);
+			auto lo = _mm_shuffle_epi8 (lutLo, loNibbles);
+			if (_mm_movemask_epi8 (_mm_cmpgt_epi8 (_mm_and_si128 (lo, hi), _mm_setzero_si128 ())))
+				break;
+			auto eq2F = _mm_cmpeq_epi8 (str, mask2F);
+			auto roll = _mm_shuffle_epi8 (lutRoll, _mm_add_epi8 (eq2F, hiNibbles));
+			str = _mm_add_epi8 (str, roll);
+			// merge the 6 bit values into 24 bit groups and pack them
+			str = _mm_maddubs_epi16 (str, _mm_set1_epi32 (0x01400140));
+			str = _mm_madd_epi16 (str, _mm_set1_epi32 (0x00011000));
+			str = _mm_shuffle_epi8 (str, pack);
+			_mm_storeu_si128 (reinterpret_cast<__m128i*> (out + outPos), str);
+			consumed += 16;
+			outPos += 12;
+		}
+		written += outPos;
+		return consumed;
+	}
+
+	//-----------------------------------------------------------------------------
+	VSTGUI_BASE64_TARGET ("avx2")
+	static size_t decodeAVX2 (const uint8_t* in, size_t inSize, uint8_t* out, size_t outCapacity,
+	                          size_t& written)
+	{
+		const __m256i lutLo = _mm256_setr_epi8 (
+		    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B,
+		    0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+		    0x1B, 0x1B, 0x1B, 0x1A);
+		const __m256i lutHi = _mm256_setr_epi8 (
+		    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		    0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+		    0x10, 0x10, 0x10, 0x10);
+		const __m256i lutRoll = _mm256_setr_epi8 (0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0,
+		                                          0, 0, 0, 0, 16, 19, 4, -65, -65, -71, -71, 0, 0,
+		                                          0, 0, 0, 0, 0, 0);
+		const __m256i mask2F = _mm256_set1_epi8 (0x2F);
+		const __m256i pack = _mm256_setr_epi8 (2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+		                                       -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1,
+		                                       -1, -1);
+		const __m256i permute = _mm256_setr_epi32 (0, 1, 2, 4, 5, 6, -1, -1);
+
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 32 && outCapacity - outPos >= 32)
+		{
+			auto str = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (in + consumed));
+			auto hiNibbles = _mm256_and_si256 (_mm256_srli_epi32 (str, 4), mask2F);
+			auto loNibbles = _mm256_and_si256 (str, mask2F);
+			auto hi = _mm256_shuffle_epi8 (lutHi, hiNibbles);
+			auto lo = _mm256_shuffle_epi8 (lutLo, loNibbles);
+			if (!_mm256_testz_si256 (lo, hi))
+				break;
+			auto eq2F = _mm256_cmpeq_epi8 (str, mask2F);
+			auto roll = _mm256_shuffle_epi8 (lutRoll, _mm256_add_epi8 (eq2F, hiNibbles));
+			str = _mm256_add_epi8 (str, roll);
+			str = _mm256_maddubs_epi16 (str, _mm256_set1_epi32 (0x01400140));
+			str = _mm256_madd_epi16 (str, _mm256_set1_epi32 (0x00011000));
+			str = _mm256_shuffle_epi8 (str, pack);
+			str = _mm256_permutevar8x32_epi32 (str, permute);
+			_mm256_storeu_si256 (reinterpret_cast<__m256i*> (out + outPos), str);
+			consumed += 32;
+			outPos += 24;
+		}
+		written += outPos;
+		return consumed;
+	}
+
+	//-----------------------------------------------------------------------------
+	VSTGUI_BASE64_TARGET ("ssse3")
+	static __m128i encodeTranslateSSSE3 (__m128i in)
+	{
+		const __m128i lut =
+		    _mm_setr_epi8 (65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+		auto indices = _mm_subs_epu8 (in, _mm_set1_epi8 (51));
+		auto mask = _mm_cmpgt_epi8 (in, _mm_set1_epi8 (25));
+		indices = _mm_sub_epi8 (indices, mask);
+		return _mm_add_epi8 (in, _mm_shuffle_epi8 (lut, indices));
+	}
+
+	//-----------------------------------------------------------------------------
+	VSTGUI_BASE64_TARGET ("ssse3")
+	static size_t encodeSSSE3 (const uint8_t* in, size_t inSize, uint8_t* out, size_t& written)
+	{
+		const __m128i shuffle =
+		    _mm_set_epi8 (10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 16)
+		{
+			auto str = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (in + consumed));
+			// split 3 bytes into 4 6 bit values
+			str = _mm_shuffle_epi8 (str, shuffle);
+			auto t0 = _mm_and_si128 (str, _mm_set1_epi32 (0x0FC0FC00));
+			auto t1 = _mm_mulhi_epu16 (t0, _mm_set1_epi32 (0x04000040));
+			auto t2 = _mm_and_si128 (str, _mm_set1_epi32 (0x003F03F0));
+			auto t3 = _mm_mullo_epi16 (t2, _mm_set1_epi32 (0x01000010));
+			str = encodeTranslateSSSE3 (_mm_or_si128 (t1, t3));
+			_mm_storeu_si128 (reinterpret_cast<__m128i*> (out + outPos), str);
+			consumed += 12;
+			outPos += 16;
+		}
+		written += outPos;
+		return consumed;
+	}
+
+	//-----------------------------------------------------------------------------
+	VSTGUI_BASE64_TARGET ("avx2")
+	static size_t encodeAVX2 (const uint8_t* in, size_t inSize, uint8_t* out, size_t& written)
+	{
+		const __m256i shuffle =
+		    _mm256_set_epi8 (10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7,
+		                     8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+		const __m256i lut = _mm256_setr_epi8 (65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19,
+		                                      -16, 0, 0, 65, 71, -4, -4, -4, -4, -4, -4, -4, -4,
+		                                      -4, -4, -19, -16, 0, 0);
+
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 28)
+		{
+			auto lo = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (in + consumed));
+			auto hi = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (in + consumed + 12));
+			auto str = _mm256_inserti128_si256 (_mm256_castsi128_si256 (lo), hi, 1);
+			str = _mm256_shuffle_epi8 (str, shuffle);
+			auto t0 = _mm256_and_si256 (str, _mm256_set1_epi32 (0x0FC0FC00));
+			auto t1 = _mm256_mulhi_epu16 (t0, _mm256_set1_epi32 (0x04000040));
+			auto t2 = _mm256_and_si256 (str, _mm256_set1_epi32 (0x003F03F0));
+			auto t3 = _mm256_mullo_epi16 (t2, _mm256_set1_epi32 (0x01000010));
+			str = _mm256_or_si256 (t1, t3);
+			auto indices = _mm256_subs_epu8 (str, _mm256_set1_epi8 (51));
+			auto mask = _mm256_cmpgt_epi8 (str, _mm256_set1_epi8 (25));
+			indices = _mm256_sub_epi8 (indices, mask);
+			str = _mm256_add_epi8 (str, _mm256_shuffle_epi8 (lut, indices));
+			_mm256_storeu_si256 (reinterpret_cast<__m256i*> (out + outPos), str);
+			consumed += 24;
+			outPos += 32;
+		}
+		written += outPos;
+		return consumed;
+	}
+#endif // VSTGUI_BASE64_X86_SIMD
+
+#if VSTGUI_BASE64_NEON_SIMD
+	//-----------------------------------------------------------------------------
+	static inline uint8x16_t decodeTranslateNEON (uint8x16_t in)
+	{
+		auto result = vdupq_n_u8 (0xFF);
+		auto upper = vcltq_u8 (vsubq_u8 (in, vdupq_n_u8 ('A')), vdupq_n_u8 (26));
+		result = vbslq_u8 (upper, vsubq_u8 (in, vdupq_n_u8 ('A')), result);
+		auto lower = vcltq_u8 (vsubq_u8 (in, vdupq_n_u8 ('a')), vdupq_n_u8 (26));
+		result = vbslq_u8 (lower, vsubq_u8 (in, vdupq_n_u8 ('a' - 26)), result);
+		auto digit = vcltq_u8 (vsubq_u8 (in, vdupq_n_u8 ('0')), vdupq_n_u8 (10));
+		result = vbslq_u8 (digit, vaddq_u8 (in, vdupq_n_u8 (52 - '0')), result);
+		result = vbslq_u8 (vceqq_u8 (in, vdupq_n_u8 ('+')), vdupq_n_u8 (62), result);
+		result = vbslq_u8 (vceqq_u8 (in, vdupq_n_u8 ('/')), vdupq_n_u8 (63), result);
+		return result;
+	}
+
+	//-----------------------------------------------------------------------------
+	static size_t decodeNEON (const uint8_t* in, size_t inSize, uint8_t* out, size_t outCapacity,
+	                          size_t& written)
+	{
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 64 && outCapacity - outPos >= 48)
+		{
+			auto str = vld4q_u8 (in + consumed);
+			auto a = decodeTranslateNEON (str.val[0]);
+			auto b = decodeTranslateNEON (str.val[1]);
+			auto c = decodeTranslateNEON (str.val[2]);
+			auto d = decodeTranslateNEON (str.val[3]);
+			auto invalid = vorrq_u8 (vorrq_u8 (a, b), vorrq_u8 (c, d));
+			if (vmaxvq_u8 (invalid) > 63)
+				break;
+			uint8x16x3_t result;
+			result.val[0] = vorrq_u8 (vshlq_n_u8 (a, 2), vshrq_n_u8 (b, 4));
+			result.val[1] = vorrq_u8 (vshlq_n_u8 (b, 4), vshrq_n_u8 (c, 2));
+			result.val[2] = vorrq_u8 (vshlq_n_u8 (c, 6), d);
+			vst3q_u8 (out + outPos, result);
+			consumed += 64;
+			outPos += 48;
+		}
+		written += outPos;
+		return consumed;
+	}
+
+	//-----------------------------------------------------------------------------
+	static size_t encodeNEON (const uint8_t* in, size_t inSize, uint8_t* out, size_t& written)
+	{
+		static constexpr uint8_t cb64[] =
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		uint8x16x4_t table;
+		table.val[0] = vld1q_u8 (cb64);
+		table.val[1] = vld1q_u8 (cb64 + 16);
+		table.val[2] = vld1q_u8 (cb64 + 32);
+		table.val[3] = vld1q_u8 (cb64 + 48);
+
+		size_t consumed = 0;
+		size_t outPos = 0;
+		while (inSize - consumed >= 48)
+		{
+			auto str = vld3q_u8 (in + consumed);
+			uint8x16x4_t result;
+			result.val[0] = vshrq_n_u8 (str.val[0], 2);
+			result.val[1] = vandq_u8 (
+			    vorrq_u8 (vshlq_n_u8 (str.val[0], 4), vshrq_n_u8 (str.val[1], 4)),
+			    vdupq_n_u8 (0x3F));
+			result.val[2] = vandq_u8 (
+			    vorrq_u8 (vshlq_n_u8 (str.val[1], 2), vshrq_n_u8 (str.val[2], 6)),
+			    vdupq_n_u8 (0x3F));
+			result.val[3] = vandq_u8 (str.val[2], vdupq_n_u8 (0x3F));
+			for (auto& v : result.val)
+				v = vqtbl4q_u8 (table, v);
+			vst4q_u8 (out + outPos, result);
+			consumed += 48;
+			outPos += 64;
+		}
+		written += outPos;
+		return consumed;
+	}
+#endif // VSTGUI_BASE64_NEON_SIMD
 };
 
 } // VSTGUI
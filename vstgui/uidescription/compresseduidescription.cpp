@@ -6,7 +6,9 @@
 #include "compresseduidescription.h"
 #include "cstream.h"
 #include "xmlparser.h"
-#include <array>
+#include "../lib/malloc.h"
+#include <algorithm>
+#include <limits>
 
 //------------------------------------------------------------------------
 namespace VSTGUI {
@@ -27,15 +29,25 @@ public:
 	ZLibInputStream (ByteOrder byteOrder = kNativeByteOrder);
 	~ZLibInputStream ();
 
-	bool open (InputStream& stream);
+	bool open (InputStream& stream, bool rawDeflate = false);
+	/** inflates directly from memory, the data must be valid as long as the stream is used */
+	bool open (const void* data, size_t size, bool rawDeflate = false);
 
 	bool operator>> (std::string& string) override { return false; }
 	uint32_t readRaw (void* buffer, uint32_t size) override;
 
 protected:
+	static constexpr size_t kMinBufferSize = 16 * 1024;
+	static constexpr size_t kMaxBufferSize = 256 * 1024;
+
+	bool init (bool rawDeflate);
+	bool fillInput ();
+
 	std::unique_ptr<z_stream> zstream;
 	InputStream* stream {nullptr};
-	std::array<Bytef, 4096> internalBuffer;
+	const Bytef* memory {nullptr};
+	size_t memorySize {0};
+	Buffer<Bytef> internalBuffer;
 };
 
 //-----------------------------------------------------------------------------
@@ -45,7 +57,7 @@ public:
 	ZLibOutputStream (ByteOrder byteOrder = kNativeByteOrder);
 	~ZLibOutputStream ();
 
-	bool open (OutputStream& stream, int32_t compressionLevel = 6);
+	bool open (OutputStream& stream, int32_t compressionLevel = 6, bool rawDeflate = false);
 	bool close ();
 
 	bool operator<< (const std::string& str) override
@@ -55,13 +67,16 @@ public:
 	uint32_t writeRaw (const void* buffer, uint32_t size) override;
 
 protected:
+	static constexpr size_t kBufferSize = 64 * 1024;
+
 	std::unique_ptr<z_stream> zstream;
 	OutputStream* stream {nullptr};
-	std::array<Bytef, 4096> internalBuffer;
+	Buffer<Bytef> internalBuffer;
 };
 
 //-----------------------------------------------------------------------------
 static constexpr int64_t kUIDescIdentifier = 0x7072637365646975LL; // 8 byte identifier
+static constexpr int64_t kUIDescRawDeflateIdentifier = 0x6472637365646975LL;
 
 //-----------------------------------------------------------------------------
 CompressedUIDescription::CompressedUIDescription (const CResourceDescription& compressedUIDescFile)
@@ -69,24 +84,52 @@ CompressedUIDescription::CompressedUIDescription (const CResourceDescription& co
 {
 }
 
+//-----------------------------------------------------------------------------
+static bool isCompressedIdentifier (int64_t identifier, bool& rawDeflate)
+{
+	rawDeflate = identifier == kUIDescRawDeflateIdentifier;
+	return rawDeflate || identifier == kUIDescIdentifier;
+}
+
+//-----------------------------------------------------------------------------
+bool CompressedUIDescription::parseInflated (InputStream& inflateStream)
+{
+	Xml::InputStreamContentProvider compressedContentProvider (inflateStream);
+	setXmlContentProvider (&compressedContentProvider);
+	auto result = UIDescription::parse ();
+	setXmlContentProvider (nullptr);
+	return result;
+}
+
 //-----------------------------------------------------------------------------
 bool CompressedUIDescription::parseWithStream (InputStream& stream)
 {
-	bool result = false;
 	int64_t identifier;
-	stream >> identifier;
-	if (identifier == kUIDescIdentifier)
-	{
-		ZLibInputStream zin;
-		if (zin.open (stream))
-		{
-			Xml::InputStreamContentProvider compressedContentProvider (zin);
-			setXmlContentProvider (&compressedContentProvider);
-			result = UIDescription::parse ();
-			setXmlContentProvider (nullptr);
-		}
-	}
-	return result;
+	bool rawDeflate;
+	if (!(stream >> identifier) || !isCompressedIdentifier (identifier, rawDeflate))
+		return false;
+	ZLibInputStream zin;
+	if (!zin.open (stream, rawDeflate))
+		return false;
+	return parseInflated (zin);
+}
+
+//-----------------------------------------------------------------------------
+bool CompressedUIDescription::parseWithMemory (const uint8_t* data, size_t size)
+{
+	constexpr auto identifierSize = sizeof (kUIDescIdentifier);
+	if (size <= identifierSize)
+		return false;
+	CMemoryStream identifierStream (reinterpret_cast<const int8_t*> (data), identifierSize, true,
+	                                kLittleEndianByteOrder);
+	int64_t identifier;
+	bool rawDeflate;
+	if (!(identifierStream >> identifier) || !isCompressedIdentifier (identifier, rawDeflate))
+		return false;
+	ZLibInputStream zin;
+	if (!zin.open (data + identifierSize, size - identifierSize, rawDeflate))
+		return false;
+	return parseInflated (zin);
 }
 
 //-----------------------------------------------------------------------------
@@ -95,19 +138,33 @@ bool CompressedUIDescription::parse ()
 	if (parsed ())
 		return true;
 	bool result = false;
-	CResourceInputStream resStream (kLittleEndianByteOrder);
-	if (resStream.open (getXmlFile ()))
+	const auto& xmlFile = getXmlFile ();
+	bool isFilePath = xmlFile.type == CResourceDescription::kStringType && xmlFile.u.name;
+	SharedPointer<CMemoryMappedFile> mappedFile;
+	if (useMemoryMapping && isFilePath && pathIsAbsolute (xmlFile.u.name))
 	{
-		result = parseWithStream (resStream);
+		mappedFile = makeOwned<CMemoryMappedFile> ();
+		if (mappedFile->open (xmlFile.u.name))
+			result = parseWithMemory (mappedFile->data (), mappedFile->size ());
+		else
+			mappedFile = nullptr;
 	}
-	else if (getXmlFile ().type == CResourceDescription::kStringType)
+	if (!mappedFile)
 	{
-		CFileStream fileStream;
-		if (fileStream.open (getXmlFile ().u.name,
-		                     CFileStream::kReadMode | CFileStream::kBinaryMode,
-		                     kLittleEndianByteOrder))
+		CResourceInputStream resStream (kLittleEndianByteOrder);
+		if (resStream.open (xmlFile))
+		{
+			result = parseWithStream (resStream);
+		}
+		else if (isFilePath)
 		{
-			result = parseWithStream (fileStream);
+			CFileStream fileStream;
+			if (fileStream.open (xmlFile.u.name,
+			                     CFileStream::kReadMode | CFileStream::kBinaryMode,
+			                     kLittleEndianByteOrder))
+			{
+				result = parseWithStream (fileStream);
+			}
 		}
 	}
 	if (!result)
@@ -131,9 +188,10 @@ bool CompressedUIDescription::save (UTF8StringPtr filename, int32_t flags)
 		                         CFileStream::kTruncateMode,
 		                     kLittleEndianByteOrder))
 		{
-			fileStream << kUIDescIdentifier;
+			bool rawDeflate = (flags & kWriteRawDeflate) != 0;
+			fileStream << (rawDeflate ? kUIDescRawDeflateIdentifier : kUIDescIdentifier);
 			ZLibOutputStream zout;
-			if (zout.open (fileStream, compressionLevel))
+			if (zout.open (fileStream, static_cast<int32_t> (compressionLevel), rawDeflate))
 			{
 				if (saveToStream (zout, flags))
 				{
@@ -174,23 +232,39 @@ ZLibInputStream::~ZLibInputStream ()
 }
 
 //-----------------------------------------------------------------------------
-bool ZLibInputStream::open (InputStream& _stream)
+bool ZLibInputStream::open (InputStream& _stream, bool rawDeflate)
 {
-	if (zstream != nullptr || stream != nullptr)
+	if (zstream != nullptr || stream != nullptr || memory != nullptr)
 		return false;
 	stream = &_stream;
+	return init (rawDeflate);
+}
 
-	auto read = stream->readRaw (internalBuffer.data (), static_cast<uint32_t> (internalBuffer.size ()));
-	if (read == 0 || read == kStreamIOError)
+//-----------------------------------------------------------------------------
+bool ZLibInputStream::open (const void* data, size_t size, bool rawDeflate)
+{
+	if (zstream != nullptr || stream != nullptr || memory != nullptr || data == nullptr)
 		return false;
+	memory = static_cast<const Bytef*> (data);
+	memorySize = size;
+	return init (rawDeflate);
+}
 
+//-----------------------------------------------------------------------------
+bool ZLibInputStream::init (bool rawDeflate)
+{
 	zstream = std::unique_ptr<z_stream> (new z_stream);
 	memset (zstream.get (), 0, sizeof (z_stream));
 
-	zstream->next_in = internalBuffer.data ();
-	zstream->avail_in = read;
+	if (!fillInput ())
+	{
+		zstream = nullptr;
+		return false;
+	}
 
-	if (inflateInit (zstream.get ()) != Z_OK)
+	// negative window bits read a deflate stream without zlib header and checksum
+	auto windowBits = rawDeflate ? -MZ_DEFAULT_WINDOW_BITS : MZ_DEFAULT_WINDOW_BITS;
+	if (inflateInit2 (zstream.get (), windowBits) != Z_OK)
 	{
 		zstream = nullptr;
 	}
@@ -198,6 +272,30 @@ bool ZLibInputStream::open (InputStream& _stream)
 	return zstream != nullptr;
 }
 
+//-----------------------------------------------------------------------------
+bool ZLibInputStream::fillInput ()
+{
+	if (memory)
+	{
+		if (memorySize == 0)
+			return false;
+		auto chunkSize = std::min<size_t> (memorySize, std::numeric_limits<unsigned int>::max ());
+		zstream->next_in = memory;
+		zstream->avail_in = static_cast<unsigned int> (chunkSize);
+		memory += chunkSize;
+		memorySize -= chunkSize;
+		return true;
+	}
+	if (internalBuffer.empty ())
+		internalBuffer.allocate (kMinBufferSize);
+	auto read = stream->readRaw (internalBuffer.data (), static_cast<uint32_t> (internalBuffer.size ()));
+	if (read == 0 || read == kStreamIOError)
+		return false;
+	zstream->next_in = internalBuffer.data ();
+	zstream->avail_in = read;
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 uint32_t ZLibInputStream::readRaw (void* buffer, uint32_t size)
 {
@@ -205,16 +303,15 @@ uint32_t ZLibInputStream::readRaw (void* buffer, uint32_t size)
 		return kStreamIOError;
 	zstream->next_out = static_cast<Bytef*> (buffer);
 	zstream->avail_out = size;
+	uint32_t numRefills = 0;
 	while (zstream->avail_out > 0)
 	{
 		if (zstream->avail_in == 0)
 		{
-			auto read = stream->readRaw (internalBuffer.data (), static_cast<uint32_t> (internalBuffer.size ()));
-			if (read > 0 && read != kStreamIOError)
-			{
-				zstream->next_in = internalBuffer.data ();
-				zstream->avail_in = read;
-			}
+			// the reader asks for more than one input buffer inflates to, read bigger chunks
+			if (++numRefills > 1 && stream && internalBuffer.size () < kMaxBufferSize)
+				internalBuffer.allocate (internalBuffer.size () * 2);
+			fillInput ();
 		}
 		auto zres = inflate (zstream.get (), Z_SYNC_FLUSH);
 		if (zres == Z_STREAM_END)
@@ -241,7 +338,7 @@ ZLibOutputStream::~ZLibOutputStream ()
 }
 
 //-----------------------------------------------------------------------------
-bool ZLibOutputStream::open (OutputStream& _stream, int32_t compressionLevel)
+bool ZLibOutputStream::open (OutputStream& _stream, int32_t compressionLevel, bool rawDeflate)
 {
 	if (zstream != nullptr || stream != nullptr)
 		return false;
@@ -250,11 +347,14 @@ bool ZLibOutputStream::open (OutputStream& _stream, int32_t compressionLevel)
 	zstream = std::unique_ptr<z_stream> (new z_stream);
 	memset (zstream.get (), 0, sizeof (z_stream));
 
-	if (deflateInit (zstream.get (), compressionLevel) != Z_OK)
+	auto windowBits = rawDeflate ? -MZ_DEFAULT_WINDOW_BITS : MZ_DEFAULT_WINDOW_BITS;
+	if (deflateInit2 (zstream.get (), compressionLevel, Z_DEFLATED, windowBits, 9,
+	                  Z_DEFAULT_STRATEGY) != Z_OK)
 	{
 		zstream = nullptr;
 		return false;
 	}
+	internalBuffer.allocate (kBufferSize);
 	return true;
 }
 
@@ -17,6 +17,7 @@ protected:
 	{
 		NoPlainXmlFileBackupBit = UIDescription::LastSaveFlagBit,
 		ForceWriteCompressedDesc,
+		WriteRawDeflateBit,
 		LastCompressedSaveFlagBit,
 	};
 public:
@@ -25,19 +26,31 @@ public:
 	enum SaveFlags
 	{
 		kNoPlainXmlFileBackup = 1 << NoPlainXmlFileBackupBit,
-		kForceWriteCompressedDesc = 1 << ForceWriteCompressedDesc
+		kForceWriteCompressedDesc = 1 << ForceWriteCompressedDesc,
+		/** write a deflate stream without zlib header and checksum, older versions can not read
+		 *	it */
+		kWriteRawDeflate = 1 << WriteRawDeflateBit
 	};
 
 	bool parse () override;
 	bool save (UTF8StringPtr filename, int32_t flags = kWriteWindowsResourceFile) override;
 
 	bool getOriginalIsCompressed () const { return originalIsCompressed; }
+	/** 0 (stored) to 9 (smallest), 1 is the fastest to compress */
 	void setCompressionLevel (uint32_t level) { compressionLevel = level; }
 
+	/** files with an absolute path are memory mapped and inflated without an intermediate buffer
+	 *	(default on) */
+	void setUseMemoryMapping (bool state) { useMemoryMapping = state; }
+	bool getUseMemoryMapping () const { return useMemoryMapping; }
+
 private:
 	bool parseWithStream (InputStream& stream);
+	bool parseWithMemory (const uint8_t* data, size_t size);
+	bool parseInflated (InputStream& inflateStream);
 
 	bool originalIsCompressed {false};
+	bool useMemoryMapping {true};
 	uint32_t compressionLevel {1};
 };
 
@@ -12,6 +12,12 @@
 #if WINDOWS
 	#define fseeko _fseeki64
 	#define ftello _ftelli64
+	#include <windows.h>
+#elif MAC || LINUX
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
 #endif
 
 namespace VSTGUI {
@@ -319,6 +325,148 @@ bool CFileStream::operator<< (const std::string& str)
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+struct CMemoryMappedFile::Impl
+{
+	const uint8_t* data {nullptr};
+	size_t size {0};
+	Buffer<uint8_t> buffer;
+#if WINDOWS
+	HANDLE fileMapping {nullptr};
+#elif MAC || LINUX
+	void* mapping {nullptr};
+#endif
+};
+
+//-----------------------------------------------------------------------------
+CMemoryMappedFile::CMemoryMappedFile ()
+{
+	impl = std::unique_ptr<Impl> (new Impl);
+}
+
+//-----------------------------------------------------------------------------
+CMemoryMappedFile::~CMemoryMappedFile () noexcept
+{
+	close ();
+}
+
+//-----------------------------------------------------------------------------
+bool CMemoryMappedFile::open (UTF8StringPtr path)
+{
+	close ();
+#if WINDOWS
+	auto file = CreateFileA (path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+	                         FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER fileSize;
+	if (GetFileSizeEx (file, &fileSize) && fileSize.QuadPart > 0)
+		impl->fileMapping = CreateFileMappingA (file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle (file);
+	if (!impl->fileMapping)
+		return false;
+	impl->data = static_cast<const uint8_t*> (MapViewOfFile (impl->fileMapping, FILE_MAP_READ, 0, 0, 0));
+	if (!impl->data)
+	{
+		close ();
+		return false;
+	}
+	impl->size = static_cast<size_t> (fileSize.QuadPart);
+	return true;
+#elif MAC || LINUX
+	auto fd = ::open (path, O_RDONLY);
+	if (fd == -1)
+		return false;
+	struct stat fileStat;
+	if (fstat (fd, &fileStat) == 0 && fileStat.st_size > 0)
+	{
+		auto mapping = mmap (nullptr, static_cast<size_t> (fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED)
+		{
+			impl->mapping = mapping;
+			impl->data = static_cast<const uint8_t*> (mapping);
+			impl->size = static_cast<size_t> (fileStat.st_size);
+		}
+	}
+	::close (fd);
+	return impl->data != nullptr;
+#else
+	CFileStream stream;
+	if (!stream.open (path, CFileStream::kReadMode | CFileStream::kBinaryMode))
+		return false;
+	return open (stream);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool CMemoryMappedFile::open (InputStream& stream)
+{
+	close ();
+	constexpr uint32_t kChunkSize = 64 * 1024;
+	size_t size = 0;
+	while (true)
+	{
+		Buffer<uint8_t> newBuffer (std::max<size_t> (impl->buffer.size () * 2, kChunkSize));
+		if (size)
+			memcpy (newBuffer.data (), impl->buffer.data (), size);
+		impl->buffer = std::move (newBuffer);
+		while (size < impl->buffer.size ())
+		{
+			auto toRead = static_cast<uint32_t> (std::min<size_t> (impl->buffer.size () - size, kChunkSize));
+			auto read = stream.readRaw (impl->buffer.data () + size, toRead);
+			if (read == kStreamIOError)
+			{
+				close ();
+				return false;
+			}
+			size += read;
+			if (read < toRead)
+			{
+				impl->data = impl->buffer.data ();
+				impl->size = size;
+				return size > 0;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void CMemoryMappedFile::close ()
+{
+#if WINDOWS
+	if (impl->fileMapping)
+	{
+		if (impl->data)
+			UnmapViewOfFile (impl->data);
+		CloseHandle (impl->fileMapping);
+		impl->fileMapping = nullptr;
+	}
+#elif MAC || LINUX
+	if (impl->mapping)
+	{
+		munmap (impl->mapping, impl->size);
+		impl->mapping = nullptr;
+	}
+#endif
+	impl->buffer.deallocate ();
+	impl->data = nullptr;
+	impl->size = 0;
+}
+
+//-----------------------------------------------------------------------------
+const uint8_t* CMemoryMappedFile::data () const
+{
+	return impl->data;
+}
+
+//-----------------------------------------------------------------------------
+size_t CMemoryMappedFile::size () const
+{
+	return impl->size;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -164,6 +164,30 @@ protected:
 	int32_t openMode;
 };
 
+/**
+	Read only memory mapping of a file
+
+	If the content comes from a stream it is read into memory instead.
+ */
+class CMemoryMappedFile : public NonAtomicReferenceCounted
+{
+public:
+	CMemoryMappedFile ();
+	~CMemoryMappedFile () noexcept override;
+
+	bool open (UTF8StringPtr path);
+	/** reads the remaining content of the stream */
+	bool open (InputStream& stream);
+	void close ();
+
+	const uint8_t* data () const;
+	size_t size () const;
+
+private:
+	struct Impl;
+	std::unique_ptr<Impl> impl;
+};
+
 static const int8_t unixPathSeparator = '/';
 static const int8_t windowsPathSeparator = '\\';
 /**
@@ -245,21 +269,17 @@ public:
 	}
 	uint32_t writeRaw (const void* inBuffer, uint32_t size) override
 	{
-		auto written = size;
 		const uint8_t* ptr = reinterpret_cast<const uint8_t*> (inBuffer);
-		while (size)
+		if (buffer.size () + size > bufferSize)
 		{
-			auto toWrite = 1;
-			buffer.emplace_back (*ptr);
-			if (buffer.size () == bufferSize)
-			{
-				if (!flush ())
-					return kStreamIOError;
-			}
-			size -= toWrite;
-			ptr += toWrite;
+			if (!flush ())
+				return kStreamIOError;
+			// large blocks are passed through instead of being copied in buffer sized chunks
+			if (size >= bufferSize)
+				return stream.writeRaw (ptr, size);
 		}
-		return written;
+		buffer.insert (buffer.end (), ptr, ptr + size);
+		return size;
 	}
 	bool flush ()
 	{
@@ -89,6 +89,7 @@ static const std::string kAttrOpacity = "opacity";
 //-----------------------------------------------------------------------------
 static const std::string kAttrBackgroundColor = "background-color";
 static const std::string kAttrBackgroundColorDrawStyle = "background-color-draw-style";
+static const std::string kAttrCacheAsBitmap = "cache-as-bitmap";
 
 //-----------------------------------------------------------------------------
 // CLayeredViewContainerCreator attributes
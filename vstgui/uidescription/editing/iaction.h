@@ -22,6 +22,14 @@ public:
 	virtual UTF8StringPtr getName () = 0;
 	virtual void perform () = 0;
 	virtual void undo () = 0;
+
+	/** approximate number of bytes the action keeps alive for undo and redo */
+	virtual size_t getMemorySize () const { return 0; }
+	/** merge the following, already performed action into this one.
+	 *
+	 *	Returns true if this action now also undoes and redoes nextAction, which is then deleted.
+	 */
+	virtual bool coalesce (IAction* nextAction) { return false; }
 };
 
 //----------------------------------------------------------------------------------------------------
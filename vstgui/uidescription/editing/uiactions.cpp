@@ -13,9 +13,29 @@
 #include "../../lib/cgraphicspath.h"
 #include "../../lib/cbitmap.h"
 #include "../detail/uiviewcreatorattributes.h"
+#include <unordered_map>
 
 namespace VSTGUI {
 
+//----------------------------------------------------------------------------------------------------
+static size_t getStringMemorySize (const std::string& str)
+{
+	return sizeof (str) + str.capacity ();
+}
+
+//----------------------------------------------------------------------------------------------------
+static size_t getAttributesMemorySize (const std::list<SharedPointer<UIAttributes>>& attributes)
+{
+	size_t result = 0;
+	for (const auto& attr : attributes)
+	{
+		result += sizeof (UIAttributes) + 2 * sizeof (void*);
+		for (const auto& entry : *attr)
+			result += sizeof (entry.first) + getStringMemorySize (entry.second);
+	}
+	return result;
+}
+
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------
@@ -223,25 +243,28 @@ ViewCopyOperation::ViewCopyOperation (UISelection* copySelection, UISelection* w
 : parent (parent), copySelection (copySelection), workingSelection (workingSelection)
 {
 	CRect selectionBounds = copySelection->getBounds ();
-	for (auto view : *copySelection)
+	for (auto view : copySelection->getTopLevelViews ())
 	{
-		if (!copySelection->containsParent (view))
-		{
-			CRect viewSize = UISelection::getGlobalViewCoordinates (view);
-			CRect newSize (0, 0, view->getWidth (), view->getHeight ());
-			newSize.offset (offset.x, offset.y);
-			newSize.offset (viewSize.left - selectionBounds.left, viewSize.top - selectionBounds.top);
-
-			view->setViewSize (newSize);
-			view->setMouseableArea (newSize);
-			emplace_back (view);
-		}
+		CRect viewSize = UISelection::getGlobalViewCoordinates (view);
+		CRect newSize (0, 0, view->getWidth (), view->getHeight ());
+		newSize.offset (offset.x, offset.y);
+		newSize.offset (viewSize.left - selectionBounds.left, viewSize.top - selectionBounds.top);
+
+		view->setViewSize (newSize);
+		view->setMouseableArea (newSize);
+		emplace_back (view);
 	}
 
 	for (auto view : *workingSelection)
 		oldSelectedViews.emplace_back (view);
 }
 
+//-----------------------------------------------------------------------------
+size_t ViewCopyOperation::getMemorySize () const
+{
+	return sizeof (*this) + (size () + oldSelectedViews.size ()) * 3 * sizeof (void*);
+}
+
 //-----------------------------------------------------------------------------
 UTF8StringPtr ViewCopyOperation::getName () 
 {
@@ -386,6 +409,12 @@ DeleteOperation::DeleteOperation (UISelection* selection)
 	}
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t DeleteOperation::getMemorySize () const
+{
+	return sizeof (*this) + size () * (sizeof (value_type) + 4 * sizeof (void*));
+}
+
 //----------------------------------------------------------------------------------------------------
 UTF8StringPtr DeleteOperation::getName ()
 {
@@ -559,12 +588,23 @@ AttributeChangeAction::AttributeChangeAction (UIDescription* desc, UISelection*
 , attrValue (attrValue)
 {
 	const UIViewFactory* viewFactory = dynamic_cast<const UIViewFactory*> (desc->getViewFactory ());
+	// most selections share a few old values, so every distinct value is stored only once
+	std::unordered_map<std::string, uint32_t> valueIndices;
 	std::string attrOldValue;
+	views.reserve (static_cast<size_t> (selection->total ()));
 	for (auto view : *selection)
 	{
+		attrOldValue.clear ();
 		viewFactory->getAttributeValue (view, attrName, attrOldValue, desc);
-		insert (std::make_pair (view, attrOldValue));
+		auto it = valueIndices.find (attrOldValue);
+		if (it == valueIndices.end ())
+		{
+			it = valueIndices.emplace (attrOldValue, static_cast<uint32_t> (oldValues.size ())).first;
+			oldValues.emplace_back (attrOldValue);
+		}
+		views.emplace_back (view, it->second);
 	}
+	oldValues.shrink_to_fit ();
 	name = "'" + attrName + "' change";
 }
 
@@ -574,16 +614,43 @@ UTF8StringPtr AttributeChangeAction::getName ()
 	return name.c_str ();
 }
 
+//-----------------------------------------------------------------------------
+size_t AttributeChangeAction::getMemorySize () const
+{
+	auto result = sizeof (*this) + views.capacity () * sizeof (ViewAndOldValue) +
+	              getStringMemorySize (attrValue) + getStringMemorySize (name);
+	for (const auto& value : oldValues)
+		result += getStringMemorySize (value);
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+bool AttributeChangeAction::coalesce (IAction* nextAction)
+{
+	auto next = dynamic_cast<AttributeChangeAction*> (nextAction);
+	if (!next || next->desc != desc || next->selection != selection ||
+	    next->attrName != attrName || next->views.size () != views.size ())
+		return false;
+	for (auto i = 0u; i < views.size (); ++i)
+	{
+		if (views[i].first != next->views[i].first)
+			return false;
+	}
+	// the old values of this action are still the ones to restore on undo
+	attrValue = std::move (next->attrValue);
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 void AttributeChangeAction::updateSelection ()
 {
-	for (auto& element : *this)
+	for (auto& element : views)
 	{
 		if (selection->contains (element.first) == false)
 		{
 			UISelection::DeferChange dc (*selection);
 			selection->clear ();
-			for (auto& it2 : *this)
+			for (auto& it2 : views)
 				selection->add (it2.first);
 			break;
 		}
@@ -597,7 +664,7 @@ void AttributeChangeAction::perform ()
 	UIAttributes attr;
 	attr.setAttribute (attrName, attrValue);
 	selection->viewsWillChange ();
-	for (auto& element : *this)
+	for (auto& element : views)
 	{
 		element.first->invalid ();	// we need to invalid before changing anything as the size may change
 		viewFactory->applyAttributeValues (element.first, attr, desc);
@@ -612,10 +679,10 @@ void AttributeChangeAction::undo ()
 {
 	const IViewFactory* viewFactory = desc->getViewFactory ();
 	selection->viewsWillChange ();
-	for (auto& element : *this)
+	for (auto& element : views)
 	{
 		UIAttributes attr;
-		attr.setAttribute (attrName, element.second);
+		attr.setAttribute (attrName, oldValues[element.second]);
 		element.first->invalid ();	// we need to invalid before changing anything as the size may change
 		viewFactory->applyAttributeValues (element.first, attr, desc);
 		element.first->invalid ();	// and afterwards also
@@ -656,7 +723,7 @@ void MultipleAttributeChangeAction::collectViewsWithAttributeValue (const UIView
 					{
 						if (typeValue == value)
 						{
-							emplace_back (view, attrName);
+							emplace_back (view, UIAttributeName (attrName));
 						}
 					}
 				}
@@ -691,6 +758,13 @@ void MultipleAttributeChangeAction::setAttributeValue (UTF8StringPtr value)
 	}
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t MultipleAttributeChangeAction::getMemorySize () const
+{
+	return sizeof (*this) + capacity () * sizeof (value_type) + getStringMemorySize (oldValue) +
+	       getStringMemorySize (newValue);
+}
+
 //----------------------------------------------------------------------------------------------------
 void MultipleAttributeChangeAction::perform ()
 {
@@ -874,6 +948,12 @@ BitmapChangeAction::BitmapChangeAction (UIDescription* description, UTF8StringPt
 		originalPath = bitmap->getResourceDescription().u.name;
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t BitmapChangeAction::getMemorySize () const
+{
+	return sizeof (*this) + name.capacity () + path.capacity () + originalPath.capacity ();
+}
+
 //----------------------------------------------------------------------------------------------------
 UTF8StringPtr BitmapChangeAction::getName ()
 {
@@ -1014,6 +1094,13 @@ BitmapFilterChangeAction::BitmapFilterChangeAction (UIDescription* description,
 	description->collectBitmapFilters (bitmapName, oldAttributes);
 }
 
+//----------------------------------------------------------------------------------------------------
+size_t BitmapFilterChangeAction::getMemorySize () const
+{
+	return sizeof (*this) + bitmapName.capacity () + getAttributesMemorySize (newAttributes) +
+	       getAttributesMemorySize (oldAttributes);
+}
+
 //----------------------------------------------------------------------------------------------------
 UTF8StringPtr BitmapFilterChangeAction::getName ()
 {
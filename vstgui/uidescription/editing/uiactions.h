@@ -9,6 +9,7 @@
 #if VSTGUI_LIVE_EDITING
 
 #include "uiselection.h"
+#include "../uiattributes.h"
 #include "../uiviewfactory.h"
 #include "../../lib/ccolor.h"
 #include "../../lib/cgradient.h"
@@ -31,6 +32,11 @@ class BaseSelectionOperation : public IAction, protected std::list<T>
 public:
 	BaseSelectionOperation (UISelection* selection) : selection (selection) {}
 
+	size_t getMemorySize () const override
+	{
+		return sizeof (*this) + this->size () * (sizeof (T) + 2 * sizeof (void*));
+	}
+
 protected:
 	SharedPointer<UISelection> selection;	
 };
@@ -93,6 +99,7 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
 protected:
 	SharedPointer<CViewContainer> parent;
 	SharedPointer<UISelection> copySelection;
@@ -137,6 +144,7 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
 protected:
 	SharedPointer<UISelection> selection;
 };
@@ -181,7 +189,12 @@ protected:
 };
 
 //-----------------------------------------------------------------------------
-class AttributeChangeAction : public IAction, protected std::map<SharedPointer<CView>, std::string>
+/** Changes one attribute of all selected views
+ *
+ *	The old values are stored once per distinct value. A following change of the same attribute
+ *	on the same views is coalesced into this action.
+ */
+class AttributeChangeAction : public IAction
 {
 public:
 	AttributeChangeAction (UIDescription* desc, UISelection* selection, const std::string& attrName, const std::string& attrValue);
@@ -190,24 +203,31 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
+	bool coalesce (IAction* nextAction) override;
 protected:
 	void updateSelection ();
-	
+
+	using ViewAndOldValue = std::pair<SharedPointer<CView>, uint32_t>;
+
 	UIDescription* desc;
 	SharedPointer<UISelection> selection;
-	std::string attrName;
+	std::vector<ViewAndOldValue> views;
+	std::vector<std::string> oldValues;
+	UIAttributeName attrName;
 	std::string attrValue;
 	std::string name;
 };
 
 //----------------------------------------------------------------------------------------------------
-class MultipleAttributeChangeAction : public IAction, public std::vector<std::pair<SharedPointer<CView>, std::string> >
+class MultipleAttributeChangeAction : public IAction, public std::vector<std::pair<SharedPointer<CView>, UIAttributeName> >
 {
 public:
 	MultipleAttributeChangeAction (UIDescription* description, const std::list<CView*>& views, IViewCreator::AttrType attrType, UTF8StringPtr oldValue, UTF8StringPtr newValue);
 	UTF8StringPtr getName () override { return "multiple view attribute changes"; }
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
 protected:
 	void setAttributeValue (UTF8StringPtr value);
 	static void collectAllSubViews (CView* view, std::list<CView*>& views);
@@ -301,6 +321,7 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
 	
 	bool isAddBitmap () const { return isNewBitmap; }
 protected:
@@ -357,6 +378,7 @@ public:
 	UTF8StringPtr getName () override;
 	void perform () override;
 	void undo () override;
+	size_t getMemorySize () const override;
 protected:
 	SharedPointer<UIDescription> description;
 	std::string bitmapName;
@@ -17,6 +17,7 @@
 #include "../../lib/cbitmap.h"
 #include <sstream>
 #include <algorithm>
+#include <unordered_map>
 
 namespace VSTGUI {
 
@@ -66,10 +67,14 @@ void UISelection::setStyle (int32_t _style)
 void UISelection::add (CView* view)
 {
 	vstgui_assert (view, "view cannot be nullptr");
+	if (style != kSingleSelectionStyle && contains (view))
+		return;
 	willChange ();
 	if (style == kSingleSelectionStyle)
 		clear ();
 	viewList.emplace_back (view);
+	viewSet.emplace (view);
+	invalidateTopLevelViews ();
 	didChange ();
 }
 
@@ -81,6 +86,8 @@ void UISelection::remove (CView* view)
 	{
 		willChange ();
 		viewList.remove (view);
+		viewSet.erase (view);
+		invalidateTopLevelViews ();
 		didChange ();
 	}
 }
@@ -93,6 +100,7 @@ void UISelection::setExclusive (CView* view)
 		return;
 	UISelection::DeferChange dc (*this);
 	viewList.clear ();
+	viewSet.clear ();
 	add (view);
 }
 
@@ -101,28 +109,82 @@ void UISelection::clear ()
 {
 	willChange ();
 	viewList.clear ();
+	viewSet.clear ();
+	invalidateTopLevelViews ();
 	didChange ();
 }
 
+//----------------------------------------------------------------------------------------------------
+void UISelection::rebuildViewSet ()
+{
+	viewSet.clear ();
+	viewSet.reserve (viewList.size ());
+	for (auto it = viewList.begin (); it != viewList.end ();)
+	{
+		if (viewSet.emplace (*it).second)
+			++it;
+		else
+			it = viewList.erase (it);
+	}
+	invalidateTopLevelViews ();
+}
+
 //----------------------------------------------------------------------------------------------------
 bool UISelection::contains (CView* view) const
 {
-	return std::find (begin (), end (), view) != end ();
+	return viewSet.find (view) != viewSet.end ();
 }
 
 //----------------------------------------------------------------------------------------------------
 bool UISelection::containsParent (CView* view) const
 {
-	CView* parent = view->getParentView ();
-	if (parent)
+	for (auto parent = view->getParentView (); parent; parent = parent->getParentView ())
 	{
 		if (contains (parent))
 			return true;
-		return containsParent (parent);
 	}
 	return false;
 }
 
+//----------------------------------------------------------------------------------------------------
+auto UISelection::getTopLevelViews () const -> const TopLevelViewList&
+{
+	if (topLevelViewsValid)
+		return topLevelViews;
+
+	topLevelViews.clear ();
+	topLevelViews.reserve (viewList.size ());
+	// unselected ancestors shared by many selected views are resolved only once
+	std::unordered_map<CView*, bool> coveredAncestors;
+	std::vector<CView*> path;
+	for (const auto& view : viewList)
+	{
+		auto covered = false;
+		path.clear ();
+		for (auto parent = view->getParentView (); parent; parent = parent->getParentView ())
+		{
+			if (contains (parent))
+			{
+				covered = true;
+				break;
+			}
+			auto it = coveredAncestors.find (parent);
+			if (it != coveredAncestors.end ())
+			{
+				covered = it->second;
+				break;
+			}
+			path.emplace_back (parent);
+		}
+		for (auto parent : path)
+			coveredAncestors.emplace (parent, covered);
+		if (!covered)
+			topLevelViews.emplace_back (view);
+	}
+	topLevelViewsValid = true;
+	return topLevelViews;
+}
+
 //----------------------------------------------------------------------------------------------------
 int32_t UISelection::total () const
 {
@@ -168,17 +230,12 @@ CRect UISelection::getGlobalViewCoordinates (CView* view)
 void UISelection::moveBy (const CPoint& p)
 {
 	viewsWillChange ();
-	const_iterator it = begin ();
-	while (it != end ())
+	for (auto view : getTopLevelViews ())
 	{
-		if (!containsParent ((*it)))
-		{
-			CRect viewRect = (*it)->getViewSize ();
-			viewRect.offset (p.x, p.y);
-			(*it)->setViewSize (viewRect);
-			(*it)->setMouseableArea (viewRect);
-		}
-		it++;
+		CRect viewRect = view->getViewSize ();
+		viewRect.offset (p.x, p.y);
+		view->setViewSize (viewRect);
+		view->setMouseableArea (viewRect);
 	}
 	viewsDidChange ();
 }
@@ -203,20 +260,14 @@ void UISelection::sizeBy (const CRect& r)
 //----------------------------------------------------------------------------------------------------
 void UISelection::invalidRects () const
 {
-	const_iterator it = begin ();
-	while (it != end ())
-	{
-		if (!containsParent ((*it)))
-		{
-			(*it)->invalid ();
-		}
-		it++;
-	}
+	for (auto view : getTopLevelViews ())
+		view->invalid ();
 }
 
 //----------------------------------------------------------------------------------------------------
 void UISelection::willChange ()
 {
+	invalidateTopLevelViews ();
 	if (++inChange == 1)
 		forEachListener ([this] (IUISelectionListener* l) { l->selectionWillChange (this); });
 }
@@ -224,6 +275,7 @@ void UISelection::willChange ()
 //----------------------------------------------------------------------------------------------------
 void UISelection::didChange ()
 {
+	invalidateTopLevelViews ();
 	if (--inChange == 0)
 		forEachListener ([this] (IUISelectionListener* l) { l->selectionDidChange (this); });
 }
@@ -254,14 +306,8 @@ bool UISelection::store (OutputStream& stream, IUIDescription* uiDescription)
 	UIDescription* desc = dynamic_cast<UIDescription*>(uiDescription);
 	if (desc)
 	{
-		std::list<CView*> views;
-		for (auto view : *this)
-		{
-			if (!containsParent (view))
-			{
-				views.emplace_back (view);
-			}
-		}
+		const auto& topLevel = getTopLevelViews ();
+		std::list<CView*> views (topLevel.begin (), topLevel.end ());
 		
 		auto attr = makeOwned<UIAttributes> ();
 		attr->setPointAttribute ("selection-drag-offset", dragOffset);
@@ -278,7 +324,9 @@ bool UISelection::restore (InputStream& stream, IUIDescription* uiDescription)
 	if (desc)
 	{
 		UIAttributes* attr = nullptr;
-		if (desc->restoreViews (stream, viewList, &attr))
+		auto result = desc->restoreViews (stream, viewList, &attr);
+		rebuildViewSet ();
+		if (result)
 		{
 			if (attr)
 			{
@@ -318,27 +366,24 @@ SharedPointer<CBitmap> createBitmapFromSelection (UISelection* selection, CFrame
 			anchorView->getFrame ()->setZoom (1.);
 		}
 		CDrawContext::Transform tr (*context, tm);
-		for (auto view : *selection)
+		for (auto view : selection->getTopLevelViews ())
 		{
-			if (!selection->containsParent (view))
+			CPoint p;
+			p = view->translateToGlobal (p);
+			if (anchorView)
+				invTm.transform (p);
+			CDrawContext::Transform transform (*context,
+			                                   CGraphicsTransform ().translate (p.x, p.y));
+			context->setClipRect (view->getViewSize ());
+			if (auto layer = dynamic_cast<IPlatformViewLayerDelegate*> (view))
+			{
+				CRect r (view->getViewSize ());
+				r.originize ();
+				layer->drawViewLayer (context, r);
+			}
+			else
 			{
-				CPoint p;
-				p = view->translateToGlobal (p);
-				if (anchorView)
-					invTm.transform (p);
-				CDrawContext::Transform transform (*context,
-				                                   CGraphicsTransform ().translate (p.x, p.y));
-				context->setClipRect (view->getViewSize ());
-				if (IPlatformViewLayerDelegate* layer = view.cast<IPlatformViewLayerDelegate> ())
-				{
-					CRect r (view->getViewSize ());
-					r.originize ();
-					layer->drawViewLayer (context, r);
-				}
-				else
-				{
-					view->drawRect (context, view->getViewSize ());
-				}
+				view->drawRect (context, view->getViewSize ());
 			}
 		}
 		if (anchorView && anchorView->isAttached ())
@@ -10,6 +10,8 @@
 #include "../../lib/dispatchlist.h"
 #include <list>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace VSTGUI {
 class UIViewFactory;
@@ -41,6 +43,12 @@ public:
 };
 
 //----------------------------------------------------------------------------------------------------
+/** Ordered list of selected views
+ *
+ *	Membership is indexed by a hash set, so contains () and containsParent () do not scan the list.
+ *	The views without a selected ancestor are resolved once and cached until the selection changes.
+ *	Code reparenting selected views must do this inside a willChange ()/didChange () bracket.
+ */
 class UISelection : public NonAtomicReferenceCounted,
                     protected ListenerProvider<UISelection, IUISelectionListener>
 //----------------------------------------------------------------------------------------------------
@@ -48,6 +56,7 @@ class UISelection : public NonAtomicReferenceCounted,
 public:
 
 	using UISelectionViewList = std::list<SharedPointer<CView>>;
+	using TopLevelViewList = std::vector<CView*>;
 
 	using const_iterator = UISelectionViewList::const_iterator;
 	using const_reverse_iterator = UISelectionViewList::const_reverse_iterator;
@@ -76,6 +85,8 @@ public:
 
 	bool contains (CView* view) const;
 	bool containsParent (CView* view) const;
+	/** the selected views without a selected ancestor in selection order */
+	const TopLevelViewList& getTopLevelViews () const;
 
 	int32_t total () const;
 	CRect getBounds () const;
@@ -118,7 +129,13 @@ protected:
 	
 	CPoint dragOffset;
 	
+	void invalidateTopLevelViews () { topLevelViewsValid = false; }
+	void rebuildViewSet ();
+
 	UISelectionViewList viewList;
+	std::unordered_set<CView*> viewSet;
+	mutable TopLevelViewList topLevelViews;
+	mutable bool topLevelViewsValid {false};
 	
 	int32_t inChange {0};
 	int32_t inViewsChange {0};
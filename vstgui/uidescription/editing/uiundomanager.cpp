@@ -7,6 +7,8 @@
 #if VSTGUI_LIVE_EDITING
 
 #include "iaction.h"
+#include <algorithm>
+#include <iterator>
 #include <string>
 
 namespace VSTGUI {
@@ -36,6 +38,14 @@ public:
 
 	UTF8StringPtr getName () override { return name.c_str (); }
 
+	size_t getMemorySize () const override
+	{
+		auto result = sizeof (*this) + name.capacity ();
+		for (auto action : *this)
+			result += action->getMemorySize () + 2 * sizeof (void*);
+		return result;
+	}
+
 	void perform () override
 	{
 		std::for_each (begin (), end (), doPerform);
@@ -50,6 +60,23 @@ protected:
 	std::string name;
 };
 
+//----------------------------------------------------------------------------------------------------
+template <typename Proc>
+void UIUndoManager::updateMemorySize (IAction* action, Proc proc)
+{
+	auto before = action->getMemorySize ();
+	proc ();
+	memorySize -= std::min (memorySize, before);
+	memorySize += action->getMemorySize ();
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::deleteAction (IAction* action)
+{
+	memorySize -= std::min (memorySize, action->getMemorySize ());
+	delete action;
+}
+
 //----------------------------------------------------------------------------------------------------
 UIUndoManager::UIUndoManager ()
 {
@@ -80,24 +107,71 @@ void UIUndoManager::pushAndPerform (IAction* action)
 		{
 			if (position == savePosition)
 				savePosition = end ();
-			delete (*position);
+			deleteAction (*position);
 			position++;
 		}
 		erase (oldStack, end ());
 	}
-	emplace_back (action);
-	position = end ();
-	position--;
 	action->perform ();
+	auto current = std::prev (end ());
+	bool coalesced = false;
+	if (current != begin () && current != savePosition)
+		updateMemorySize (*current, [&] () { coalesced = (*current)->coalesce (action); });
+	if (coalesced)
+	{
+		position = current;
+		delete action;
+	}
+	else
+	{
+		memorySize += action->getMemorySize ();
+		emplace_back (action);
+		position = end ();
+		position--;
+		enforceLimits ();
+	}
 	forEachListener ([] (IUIUndoManagerListener* l) { l->onUndoManagerChange (); });
 }
 
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::setLimits (size_t _maxSteps, size_t _maxMemorySize)
+{
+	maxSteps = _maxSteps;
+	maxMemorySize = _maxMemorySize;
+	enforceLimits ();
+}
+
+//----------------------------------------------------------------------------------------------------
+void UIUndoManager::enforceLimits ()
+{
+	auto numSteps = getNumSteps ();
+	while (numSteps > maxSteps || memorySize > maxMemorySize)
+	{
+		// only steps older than the current undo step are dropped
+		if (position == end () || position == begin ())
+			break;
+		auto oldest = std::next (begin ());
+		if (oldest == position)
+			break;
+		--numSteps;
+		// the state before the oldest step is not reachable anymore, the state after it is the new
+		// bottom of the stack
+		if (savePosition == begin ())
+			savePosition = end ();
+		else if (savePosition == oldest)
+			savePosition = begin ();
+		deleteAction (*oldest);
+		erase (oldest);
+	}
+}
+
 //----------------------------------------------------------------------------------------------------
 void UIUndoManager::performUndo ()
 {
 	if (position != end () && position != begin ())
 	{
-		(*position)->undo ();
+		auto action = *position;
+		updateMemorySize (action, [action] () { action->undo (); });
 		position--;
 		forEachListener ([] (IUIUndoManagerListener* l) { l->onUndoManagerChange (); });
 	}
@@ -111,7 +185,8 @@ void UIUndoManager::performRedo ()
 		position++;
 		if (position != end ())
 		{
-			(*position)->perform ();
+			auto action = *position;
+			updateMemorySize (action, [action] () { action->perform (); });
 			forEachListener ([] (IUIUndoManagerListener* l) { l->onUndoManagerChange (); });
 		}
 	}
@@ -161,6 +236,7 @@ void UIUndoManager::clear ()
 {
 	std::for_each (begin (), end (), [] (IAction* action) { delete action; });
 	std::list<IAction*>::clear ();
+	memorySize = 0;
 	emplace_back (new UndoStackTop);
 	position = end ();
 	savePosition = begin ();
@@ -25,11 +25,22 @@ struct IUIUndoManagerListener
 };
 
 //----------------------------------------------------------------------------------------------------
+/** Undo history of the editor
+ *
+ *	The history is bounded by a number of steps and by the memory the actions report via
+ *	IAction::getMemorySize (). If one of the limits is exceeded the oldest undo steps are dropped,
+ *	the current undo step and the redo steps are always kept.
+ *	A pushed action is coalesced into the current undo step if that step accepts it via
+ *	IAction::coalesce () and the current step is not the save position.
+ */
 class UIUndoManager : public NonAtomicReferenceCounted,
                       protected ListenerProvider<UIUndoManager, IUIUndoManagerListener>,
                       protected std::list<IAction*>
 {
 public:
+	static constexpr size_t kDefaultMaxSteps = 1000;
+	static constexpr size_t kDefaultMaxMemorySize = 64 * 1024 * 1024;
+
 	UIUndoManager ();
 	~UIUndoManager () override;
 
@@ -51,12 +62,31 @@ public:
 
 	void markSavePosition ();
 	bool isSavePosition () const;
+
+	void setLimits (size_t maxSteps, size_t maxMemorySize);
+	size_t getMaxSteps () const { return maxSteps; }
+	size_t getMaxMemorySize () const { return maxMemorySize; }
+
+	/** number of undo and redo steps */
+	size_t getNumSteps () const { return size () - 1; }
+	/** memory reported by all undo and redo steps */
+	size_t getMemorySize () const { return memorySize; }
 	
 	using ListenerProvider<UIUndoManager, IUIUndoManagerListener>::registerListener;
 	using ListenerProvider<UIUndoManager, IUIUndoManagerListener>::unregisterListener;
 protected:
+	void enforceLimits ();
+	void deleteAction (IAction* action);
+	/** performs proc on action and updates the memory size if the action changed its size */
+	template <typename Proc>
+	void updateMemorySize (IAction* action, Proc proc);
+
+	size_t maxSteps {kDefaultMaxSteps};
+	size_t maxMemorySize {kDefaultMaxMemorySize};
 	iterator position;
 	iterator savePosition;
+	/** the sum of IAction::getMemorySize () of all steps */
+	size_t memorySize {0};
 	using GroupActionDeque = std::deque<UIGroupAction*>;
 	GroupActionDeque groupQueue;
 };
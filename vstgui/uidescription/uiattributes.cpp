@@ -9,6 +9,10 @@
 #include "../lib/cstring.h"
 #include <sstream>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
 
 namespace VSTGUI {
 namespace {
@@ -44,8 +48,56 @@ Optional<std::string> trimmedNumericalString (const std::string& str, size_t fro
 	return Optional<std::string> {std::move (result)};
 }
 
+//------------------------------------------------------------------------
+const std::string& emptyAttributeName ()
+{
+	static const std::string name;
+	return name;
+}
+
+//------------------------------------------------------------------------
+class AttributeNameTable
+{
+public:
+	static AttributeNameTable& instance ()
+	{
+		static AttributeNameTable table;
+		return table;
+	}
+
+	const std::string* intern (const std::string& name)
+	{
+		if (name.empty ())
+			return &emptyAttributeName ();
+		std::lock_guard<std::mutex> guard (mutex);
+		return &*names.insert (name).first;
+	}
+
+private:
+	std::mutex mutex;
+	std::unordered_set<std::string> names;
+};
+
 } // anonymous
 
+//-----------------------------------------------------------------------------
+UIAttributeName::UIAttributeName ()
+: str (&emptyAttributeName ())
+{
+}
+
+//-----------------------------------------------------------------------------
+UIAttributeName::UIAttributeName (const std::string& name)
+: str (AttributeNameTable::instance ().intern (name))
+{
+}
+
+//-----------------------------------------------------------------------------
+UIAttributeName::UIAttributeName (UTF8StringPtr name)
+: UIAttributeName (std::string (name))
+{
+}
+
 //-----------------------------------------------------------------------------
 std::string UIAttributes::pointToString (CPoint p)
 {
@@ -221,20 +273,103 @@ bool UIAttributes::stringToStringArray (const std::string& str, std::vector<std:
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+uint64_t UIAttributes::nextVersion ()
+{
+	static std::atomic<uint64_t> counter {0};
+	return ++counter;
+}
+
 //-----------------------------------------------------------------------------
 UIAttributes::UIAttributes (UTF8StringPtr* attributes)
+: version (nextVersion ())
 {
 	if (attributes)
 	{
-		int32_t i = 0;
-		while (attributes[i] != nullptr && attributes[i+1] != nullptr)
+		size_t numAttributes = 0;
+		while (attributes[numAttributes * 2] != nullptr && attributes[numAttributes * 2 + 1] != nullptr)
+			++numAttributes;
+		if (numAttributes > kInlineCapacity)
 		{
-			emplace (attributes[i], attributes[i+1]);
-			i += 2;
+			heapKeys.reserve (numAttributes);
+			heapEntries.reserve (numAttributes);
 		}
+		for (size_t i = 0; i < numAttributes; ++i)
+			setAttribute (attributes[i * 2], attributes[i * 2 + 1]);
 	}
 }
 
+//-----------------------------------------------------------------------------
+uint64_t UIAttributes::makeKey (const std::string& name)
+{
+	// the length and the first and last four characters, a matching key is verified by comparing
+	// the names
+	auto size = name.size ();
+	auto str = name.data ();
+	uint32_t head = 0;
+	uint32_t tail = 0;
+	if (size >= sizeof (uint32_t))
+	{
+		memcpy (&head, str, sizeof (uint32_t));
+		memcpy (&tail, str + size - sizeof (uint32_t), sizeof (uint32_t));
+	}
+	else
+	{
+		for (auto i = 0u; i < size; ++i)
+			head |= static_cast<uint32_t> (static_cast<uint8_t> (str[i])) << (i * 8);
+	}
+	return ((static_cast<uint64_t> (tail) << 32) | head) ^ size;
+}
+
+//-----------------------------------------------------------------------------
+UIAttributes::iterator UIAttributes::find (const std::string& name)
+{
+	auto key = makeKey (name);
+	auto keyList = keys ();
+	auto entryList = begin ();
+	auto numEntries = size ();
+	for (size_t i = 0; i < numEntries; ++i)
+	{
+		if (keyList[i] == key && entryList[i].first.getString () == name)
+			return entryList + i;
+	}
+	return entryList + numEntries;
+}
+
+//-----------------------------------------------------------------------------
+UIAttributes::iterator UIAttributes::find (const UIAttributeName& name)
+{
+	return std::find_if (begin (), end (),
+	                     [&] (const value_type& entry) { return entry.first == name; });
+}
+
+//-----------------------------------------------------------------------------
+void UIAttributes::append (const UIAttributeName& name, std::string&& value)
+{
+	if (heapEntries.empty ())
+	{
+		if (numInline < kInlineCapacity)
+		{
+			inlineKeys[numInline] = makeKey (name);
+			inlineEntries[numInline].first = name;
+			inlineEntries[numInline].second = std::move (value);
+			++numInline;
+			return;
+		}
+		heapKeys.reserve (std::max (heapKeys.capacity (), kInlineCapacity * 2));
+		heapEntries.reserve (std::max (heapEntries.capacity (), kInlineCapacity * 2));
+		for (auto i = 0u; i < kInlineCapacity; ++i)
+		{
+			heapKeys.emplace_back (inlineKeys[i]);
+			heapEntries.emplace_back (inlineEntries[i].first, std::move (inlineEntries[i].second));
+			inlineEntries[i] = value_type ();
+		}
+		numInline = 0;
+	}
+	heapKeys.emplace_back (makeKey (name));
+	heapEntries.emplace_back (name, std::move (value));
+}
+
 //-----------------------------------------------------------------------------
 bool UIAttributes::hasAttribute (const std::string& name) const
 {
@@ -243,10 +378,25 @@ bool UIAttributes::hasAttribute (const std::string& name) const
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+bool UIAttributes::hasAttribute (const UIAttributeName& name) const
+{
+	return getAttributeValue (name) != nullptr;
+}
+
 //-----------------------------------------------------------------------------
 const std::string* UIAttributes::getAttributeValue (const std::string& name) const
 {
-	const_iterator iter = find (name);
+	auto iter = const_cast<UIAttributes*> (this)->find (name);
+	if (iter != end ())
+		return &iter->second;
+	return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+const std::string* UIAttributes::getAttributeValue (const UIAttributeName& name) const
+{
+	auto iter = const_cast<UIAttributes*> (this)->find (name);
 	if (iter != end ())
 		return &iter->second;
 	return nullptr;
@@ -255,39 +405,84 @@ const std::string* UIAttributes::getAttributeValue (const std::string& name) con
 //-----------------------------------------------------------------------------
 void UIAttributes::setAttribute (const std::string& name, const std::string& value)
 {
+	version = nextVersion ();
 	iterator iter = find (name);
 	if (iter != end ())
 		iter->second = value;
 	else
-		emplace (name, value);
+		append (UIAttributeName (name), std::string (value));
 }
 
 //-----------------------------------------------------------------------------
 void UIAttributes::setAttribute (const std::string& name, std::string&& value)
 {
+	version = nextVersion ();
 	iterator iter = find (name);
 	if (iter != end ())
 		iter->second = std::move (value);
 	else
-		emplace (name, std::move (value));
+		append (UIAttributeName (name), std::move (value));
 }
 
 //-----------------------------------------------------------------------------
 void UIAttributes::setAttribute (std::string&& name, std::string&& value)
 {
+	setAttribute (static_cast<const std::string&> (name), std::move (value));
+}
+
+//-----------------------------------------------------------------------------
+void UIAttributes::setAttribute (const UIAttributeName& name, const std::string& value)
+{
+	version = nextVersion ();
+	iterator iter = find (name);
+	if (iter != end ())
+		iter->second = value;
+	else
+		append (name, std::string (value));
+}
+
+//-----------------------------------------------------------------------------
+void UIAttributes::setAttribute (const UIAttributeName& name, std::string&& value)
+{
+	version = nextVersion ();
 	iterator iter = find (name);
 	if (iter != end ())
 		iter->second = std::move (value);
 	else
-		emplace (std::move (name), std::move (value));
+		append (name, std::move (value));
 }
 
 //-----------------------------------------------------------------------------
 void UIAttributes::removeAttribute (const std::string& name)
 {
 	iterator iter = find (name);
-	if (iter != end ())
-		erase (iter);
+	if (iter == end ())
+		return;
+	version = nextVersion ();
+	auto index = iter - begin ();
+	if (heapEntries.empty ())
+	{
+		std::move (inlineKeys.begin () + index + 1, inlineKeys.begin () + numInline,
+		           inlineKeys.begin () + index);
+		std::move (iter + 1, end (), iter);
+		inlineEntries[--numInline] = value_type ();
+	}
+	else
+	{
+		heapKeys.erase (heapKeys.begin () + index);
+		heapEntries.erase (heapEntries.begin () + index);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void UIAttributes::removeAll ()
+{
+	version = nextVersion ();
+	for (auto i = 0u; i < numInline; ++i)
+		inlineEntries[i] = value_type ();
+	numInline = 0;
+	std::vector<uint64_t> ().swap (heapKeys);
+	std::vector<value_type> ().swap (heapEntries);
 }
 
 //-----------------------------------------------------------------------------
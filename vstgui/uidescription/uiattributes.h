@@ -7,28 +7,71 @@
 #include "../lib/vstguifwd.h"
 #include "../lib/cstring.h"
 
+#include <array>
+#include <string>
+#include <utility>
 #include <vector>
-#include "../lib/platform/std_unorderedmap.h"
 
 namespace VSTGUI {
 class OutputStream;
 class InputStream;
 
-using UIAttributesMap = std::unordered_map<std::string,std::string>;
+//-----------------------------------------------------------------------------
+/** Interned attribute name
+ *
+ *	Every distinct name is stored only once for the lifetime of the process, names created from
+ *	equal strings share the same storage and compare by pointer.
+ */
+class UIAttributeName
+{
+public:
+	UIAttributeName ();
+	explicit UIAttributeName (const std::string& name);
+	explicit UIAttributeName (UTF8StringPtr name);
+
+	const std::string& getString () const { return *str; }
+	operator const std::string& () const { return *str; }
+
+	bool operator== (const UIAttributeName& other) const { return str == other.str; }
+	bool operator!= (const UIAttributeName& other) const { return str != other.str; }
+
+private:
+	const std::string* str;
+};
 
 //-----------------------------------------------------------------------------
-class UIAttributes : public NonAtomicReferenceCounted, private UIAttributesMap
+/** Attributes of a UINode
+ *
+ *	The attributes are stored as a flat list of (name, value) pairs in insertion order. Up to
+ *	kInlineCapacity pairs live inside the object, only nodes with more attributes allocate. Lookups
+ *	by string scan a dense array of keys made of the name length and its first and last characters.
+ */
+class UIAttributes : public NonAtomicReferenceCounted
 {
 public:
 	using StringArray = std::vector<std::string>;
-	
+	using value_type = std::pair<UIAttributeName, std::string>;
+	using iterator = value_type*;
+	using const_iterator = const value_type*;
+
+	/** covers the attributes of typical view nodes, which have 6 to 15 */
+	static constexpr size_t kInlineCapacity = 16;
+
 	explicit UIAttributes (UTF8StringPtr* attributes = nullptr);
 	~UIAttributes () noexcept override = default;
 
-	using UIAttributesMap::begin;
-	using UIAttributesMap::end;
-	using UIAttributesMap::iterator;
-	using UIAttributesMap::const_iterator;
+	iterator begin () { return entries (); }
+	iterator end () { return entries () + size (); }
+	const_iterator begin () const { return entries (); }
+	const_iterator end () const { return entries () + size (); }
+	size_t size () const { return heapEntries.empty () ? numInline : heapEntries.size (); }
+	bool empty () const { return size () == 0; }
+
+	/** lookup by interned name, compares pointers instead of strings */
+	bool hasAttribute (const UIAttributeName& name) const;
+	const std::string* getAttributeValue (const UIAttributeName& name) const;
+	void setAttribute (const UIAttributeName& name, const std::string& value);
+	void setAttribute (const UIAttributeName& name, std::string&& value);
 
 	bool hasAttribute (const std::string& name) const;
 	const std::string* getAttributeValue (const std::string& name) const;
@@ -55,7 +98,10 @@ public:
 	void setStringArrayAttribute (const std::string& name, const StringArray& values);
 	bool getStringArrayAttribute (const std::string& name, StringArray& values) const;
 	
-	void removeAll () { clear (); }
+	void removeAll ();
+
+	/** changes with every modification. Versions are unique across all attribute objects */
+	uint64_t getVersion () const { return version; }
 
 	bool store (OutputStream& stream) const;
 	bool restore (InputStream& stream);
@@ -72,7 +118,32 @@ public:
 	static bool stringToRect (const std::string& str, CRect& r);
 	static std::string stringArrayToString (const StringArray& values);
 	static bool stringToStringArray (const std::string& str, StringArray& values);
-	
+
+private:
+	value_type* entries ()
+	{
+		return heapEntries.empty () ? inlineEntries.data () : heapEntries.data ();
+	}
+	const value_type* entries () const
+	{
+		return heapEntries.empty () ? inlineEntries.data () : heapEntries.data ();
+	}
+	const uint64_t* keys () const
+	{
+		return heapEntries.empty () ? inlineKeys.data () : heapKeys.data ();
+	}
+	static uint64_t makeKey (const std::string& name);
+	static uint64_t nextVersion ();
+	iterator find (const std::string& name);
+	iterator find (const UIAttributeName& name);
+	void append (const UIAttributeName& name, std::string&& value);
+
+	std::array<uint64_t, kInlineCapacity> inlineKeys;
+	std::array<value_type, kInlineCapacity> inlineEntries;
+	std::vector<uint64_t> heapKeys;
+	std::vector<value_type> heapEntries;
+	size_t numInline {0};
+	uint64_t version;
 };
 
 } // VSTGUI
@@ -19,6 +19,7 @@
 #include "../lib/cgraphicspath.h"
 #include "../lib/cbitmap.h"
 #include "../lib/cbitmapfilter.h"
+#include "../lib/crowcolumnview.h"
 #include "../lib/dispatchlist.h"
 #include "../lib/platform/std_unorderedmap.h"
 #include "../lib/platform/iplatformbitmap.h"
@@ -28,7 +29,14 @@
 #include <fstream>
 #include <algorithm>
 #include <cassert>
+#include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 namespace VSTGUI {
 
@@ -97,9 +105,16 @@ public:
 	virtual void nodeAttributeChanged (UINode* child, const std::string& attributeName, const std::string& oldAttributeValue) {}
 
 	void sort ();
+
+	/** changes when children are added, removed or reordered. Versions are unique across all
+	 *	lists */
+	uint64_t getVersion () const { return version; }
 	
 protected:
+	static uint64_t nextVersion ();
+
 	bool ownsObjects;
+	uint64_t version;
 };
 
 //-----------------------------------------------------------------------------
@@ -134,12 +149,24 @@ public:
 	void sortChildren ();
 	virtual void freePlatformResources () {}
 
+	/** remembers the state of the node when the writer wrote it */
+	void setWritten ();
+	/** true if neither the node nor one of its descendants changed since they were written */
+	bool unchangedSinceWritten () const;
+	/** the XML the writer created for this node and its descendants */
+	std::string& getWrittenXML () { return writtenXML; }
+
 protected:
 	std::string name;
 	DataStorage data;
 	SharedPointer<UIAttributes> attributes;
 	SharedPointer<UIDescList> children;
 	int32_t flags;
+
+	std::string writtenXML;
+	uint64_t writtenAttributesVersion {0};
+	uint64_t writtenChildrenVersion {0};
+	int32_t writtenFlags {0};
 };
 
 //-----------------------------------------------------------------------------
@@ -215,6 +242,52 @@ protected:
 	bool scaledBitmapsAdded;
 };
 
+//-----------------------------------------------------------------------------
+/** base64 encoded bitmap data node
+ *
+ *	Stores the decoded binary data. The encoded character data is decoded while parsing and
+ *	only encoded again when the description is written.
+ */
+class UIBitmapDataNode : public UINode
+{
+public:
+	explicit UIBitmapDataNode (const SharedPointer<UIAttributes>& attributes);
+	UIBitmapDataNode (const void* data, size_t dataSize);
+	/** references the data inside the mapped file instead of copying it */
+	UIBitmapDataNode (const SharedPointer<UIAttributes>& attributes,
+	                  const SharedPointer<CMemoryMappedFile>& file, const uint8_t* data,
+	                  uint32_t dataSize);
+
+	void appendEncodedData (const int8_t* data, size_t size);
+	/** collects the encoded data to decode it later in finishDecoding (), possibly on another
+	 *	thread */
+	void collectEncodedData (const int8_t* data, size_t size);
+	void finishDecoding ();
+
+	const uint8_t* getDecodedData () const
+	{
+		return mappedFile ? mappedData : decodedData.data.get ();
+	}
+	uint32_t getDecodedDataSize () const
+	{
+		return mappedFile ? mappedDataSize : decodedData.dataSize;
+	}
+	Base64Codec::Result encodeData () const;
+
+	/** remembers that the data was compared to or created from the bitmap, so that saving again
+	 *	does not need to compare it */
+	void setVerifiedWith (const SharedPointer<IPlatformBitmap>& bitmap) { verifiedBitmap = bitmap; }
+	bool isVerifiedWith (IPlatformBitmap* bitmap) const { return verifiedBitmap == bitmap; }
+
+protected:
+	std::unique_ptr<Base64Codec::StreamDecoder> decoder;
+	SharedPointer<IPlatformBitmap> verifiedBitmap;
+	Base64Codec::Result decodedData;
+	SharedPointer<CMemoryMappedFile> mappedFile;
+	const uint8_t* mappedData {nullptr};
+	uint32_t mappedDataSize {0};
+};
+
 //-----------------------------------------------------------------------------
 class UIFontNode : public UINode
 {
@@ -319,12 +392,14 @@ private:
 //-----------------------------------------------------------------------------
 UIDescList::UIDescList (bool ownsObjects)
 : ownsObjects (ownsObjects)
+, version (nextVersion ())
 {
 }
 
 //------------------------------------------------------------------------
 UIDescList::UIDescList (const UIDescList& uiDesc)
 : ownsObjects (false)
+, version (nextVersion ())
 {
 	for (auto& child : uiDesc)
 		add (child);
@@ -336,9 +411,17 @@ UIDescList::~UIDescList () noexcept
 	removeAll ();
 }
 
+//-----------------------------------------------------------------------------
+uint64_t UIDescList::nextVersion ()
+{
+	static std::atomic<uint64_t> counter {0};
+	return ++counter;
+}
+
 //-----------------------------------------------------------------------------
 void UIDescList::add (UINode* obj)
 {
+	version = nextVersion ();
 	if (!ownsObjects)
 		obj->remember ();
 	UIDescListContainerType::emplace_back (obj);
@@ -350,6 +433,7 @@ void UIDescList::remove (UINode* obj)
 	UIDescListContainerType::iterator pos = std::find (UIDescListContainerType::begin (), UIDescListContainerType::end (), obj);
 	if (pos != UIDescListContainerType::end ())
 	{
+		version = nextVersion ();
 		UIDescListContainerType::erase (pos);
 		obj->forget ();
 	}
@@ -358,6 +442,7 @@ void UIDescList::remove (UINode* obj)
 //-----------------------------------------------------------------------------
 void UIDescList::removeAll ()
 {
+	version = nextVersion ();
 	for (const_reverse_iterator it = rbegin (), end = rend (); it != end; ++it)
 		(*it)->forget ();
 	clear ();
@@ -390,6 +475,7 @@ UINode* UIDescList::findChildNodeWithAttributeValue (const std::string& attribut
 //-----------------------------------------------------------------------------
 void UIDescList::sort ()
 {
+	version = nextVersion ();
 	std::sort (begin (), end (), [] (const UINode* n1, const UINode* n2) {
 		const std::string* str1 = n1->getAttributes ()->getAttributeValue ("name");
 		const std::string* str2 = n2->getAttributes ()->getAttributeValue ("name");
@@ -402,6 +488,34 @@ void UIDescList::sort ()
 }
 
 //-----------------------------------------------------------------------------
+class StringOutputStream : public OutputStream
+{
+public:
+	explicit StringOutputStream (std::string& str) : str (str) {}
+
+	bool operator<< (const std::string& s) override
+	{
+		str += s;
+		return true;
+	}
+	uint32_t writeRaw (const void* buffer, uint32_t size) override
+	{
+		str.append (static_cast<const char*> (buffer), size);
+		return size;
+	}
+
+private:
+	std::string& str;
+};
+
+//-----------------------------------------------------------------------------
+/** writes the node tree as XML
+ *
+ *	Named nodes (resources and templates) are the units the description changes. Their XML is
+ *	kept in the node and written again as long as neither the node nor one of its descendants
+ *	changed, so saving after a small edit only serializes the changed parts. Bitmaps with embedded
+ *	data are not kept, their encoded data is as big as the bitmap and is encoded again instead.
+ */
 class UIDescWriter
 {
 public:
@@ -410,16 +524,24 @@ protected:
 	static void encodeAttributeString (std::string& str);
 
 	bool writeNode (UINode* node, OutputStream& stream);
+	bool writeCachedNode (UINode* node, OutputStream& stream);
+	static bool hasEmbeddedBitmapData (UINode* node);
 	bool writeComment (UICommentNode* node, OutputStream& stream);
+	bool writeBitmapData (UIBitmapDataNode* node, OutputStream& stream);
 	bool writeNodeData (UINode::DataStorage& str, OutputStream& stream);
+	bool writeNodeData (const char* data, size_t dataSize, OutputStream& stream);
 	bool writeAttributes (UIAttributes* attr, OutputStream& stream);
+	bool writeIntend (OutputStream& stream);
 	int32_t intendLevel;
+	std::string lineBuffer;
+	UINode* cachingNode {nullptr};
 };
 
 //-----------------------------------------------------------------------------
 bool UIDescWriter::write (OutputStream& stream, UINode* rootNode)
 {
 	intendLevel = 0;
+	cachingNode = nullptr;
 	stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
 	return writeNode (rootNode, stream);
 }
@@ -427,60 +549,131 @@ bool UIDescWriter::write (OutputStream& stream, UINode* rootNode)
 //-----------------------------------------------------------------------------
 void UIDescWriter::encodeAttributeString (std::string& str)
 {
-	const int8_t entities[] = {'&', '<','>', '\'', '\"', 0};
-	const char* replacements[] = {"&amp;", "&lt;", "&gt;", "&apos;", "&quot;"};
-	int32_t i = 0;
-	while (entities[i] != 0)
+	auto pos = str.find_first_of ("&<>\'\"");
+	if (pos == std::string::npos)
+		return;
+	std::string encoded;
+	encoded.reserve (str.size () + 16);
+	encoded.append (str, 0, pos);
+	for (; pos < str.size (); ++pos)
 	{
-		size_t pos = 0;
-		while ((pos = str.find (entities[i], pos)) != std::string::npos)
+		switch (str[pos])
 		{
-			str.replace (pos, 1, replacements[i]);
-			pos++;
+			case '&': encoded += "&amp;"; break;
+			case '<': encoded += "&lt;"; break;
+			case '>': encoded += "&gt;"; break;
+			case '\'': encoded += "&apos;"; break;
+			case '\"': encoded += "&quot;"; break;
+			default: encoded += str[pos]; break;
 		}
-		i++;
 	}
+	str = std::move (encoded);
+}
+
+//-----------------------------------------------------------------------------
+bool UIDescWriter::writeIntend (OutputStream& stream)
+{
+	if (intendLevel <= 0)
+		return true;
+	lineBuffer.assign (static_cast<size_t> (intendLevel), '\t');
+	return stream.writeRaw (lineBuffer.data (), static_cast<uint32_t> (lineBuffer.size ())) ==
+	       lineBuffer.size ();
 }
 
 //-----------------------------------------------------------------------------
 bool UIDescWriter::writeAttributes (UIAttributes* attr, OutputStream& stream)
 {
-	bool result = true;
-	using SortedAttributes = std::map<std::string,std::string>;
-	SortedAttributes sortedAttributes (attr->begin (), attr->end ());
+	using AttributeRef = const UIAttributes::value_type*;
+	std::vector<AttributeRef> sortedAttributes;
+	for (auto& a : *attr)
+	{
+		if (!a.second.empty ())
+			sortedAttributes.emplace_back (&a);
+	}
+	if (sortedAttributes.empty ())
+		return true;
+	std::sort (sortedAttributes.begin (), sortedAttributes.end (), [] (AttributeRef lhs, AttributeRef rhs) {
+		return lhs->first.getString () < rhs->first.getString ();
+	});
+	std::string value;
+	lineBuffer.clear ();
 	for (auto& sa : sortedAttributes)
 	{
-		if (sa.second.length () > 0)
-		{
-			stream << " ";
-			stream << sa.first;
-			stream << "=\"";
-			std::string value (sa.second);
-			encodeAttributeString (value);
-			stream << value;
-			stream << "\"";
-		}
+		value = sa->second;
+		encodeAttributeString (value);
+		lineBuffer += " ";
+		lineBuffer += sa->first;
+		lineBuffer += "=\"";
+		lineBuffer += value;
+		lineBuffer += "\"";
 	}
-	return result;
+	return stream.writeRaw (lineBuffer.data (), static_cast<uint32_t> (lineBuffer.size ())) ==
+	       lineBuffer.size ();
 }
 
 //-----------------------------------------------------------------------------
 bool UIDescWriter::writeNodeData (UINode::DataStorage& str, OutputStream& stream)
 {
-	for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
-	uint32_t i = 0;
-	for (auto c : str)
+	return writeNodeData (str.data (), str.size (), stream);
+}
+
+//-----------------------------------------------------------------------------
+bool UIDescWriter::writeNodeData (const char* data, size_t dataSize, OutputStream& stream)
+{
+	// the data is wrapped after 82 characters and every line is indented. Lines are collected into
+	// blocks of about 64 KB and written with one call
+	static constexpr size_t kLineLength = 82;
+	static constexpr size_t kBlockSize = 64 * 1024;
+
+	const auto intend = static_cast<size_t> (std::max (intendLevel, 0));
+	lineBuffer.clear ();
+	lineBuffer.reserve (kBlockSize + kLineLength + intend + 2);
+	lineBuffer.append (intend, '\t');
+	for (auto end = data + dataSize; data != end;)
 	{
-		stream << static_cast<int8_t> (c);
-		if (i++ > 80)
+		auto lineLength = std::min<size_t> (kLineLength, end - data);
+		lineBuffer.append (data, lineLength);
+		data += lineLength;
+		if (lineLength == kLineLength)
 		{
-			stream << "\n";
-			i = 0;
-			for (int32_t i2 = 0; i2 < intendLevel; i2++) stream << "\t";
+			lineBuffer += '\n';
+			lineBuffer.append (intend, '\t');
+		}
+		if (lineBuffer.size () >= kBlockSize)
+		{
+			if (stream.writeRaw (lineBuffer.data (), static_cast<uint32_t> (lineBuffer.size ())) !=
+			    lineBuffer.size ())
+				return false;
+			lineBuffer.clear ();
 		}
 	}
-	stream << "\n";
-	return true;
+	lineBuffer += '\n';
+	return stream.writeRaw (lineBuffer.data (), static_cast<uint32_t> (lineBuffer.size ())) ==
+	       lineBuffer.size ();
+}
+
+//-----------------------------------------------------------------------------
+bool UIDescWriter::writeBitmapData (UIBitmapDataNode* node, OutputStream& stream)
+{
+	stream << "<";
+	stream << node->getName ();
+	if (!writeAttributes (node->getAttributes (), stream))
+		return false;
+	if (node->getDecodedDataSize () == 0)
+	{
+		stream << "/>\n";
+		return true;
+	}
+	stream << ">\n";
+	intendLevel++;
+	auto encoded = node->encodeData ();
+	auto result = writeNodeData (reinterpret_cast<const char*> (encoded.data.get ()), encoded.dataSize, stream);
+	intendLevel--;
+	writeIntend (stream);
+	stream << "</";
+	stream << node->getName ();
+	stream << ">\n";
+	return result;
 }
 
 //-----------------------------------------------------------------------------
@@ -492,17 +685,64 @@ bool UIDescWriter::writeComment (UICommentNode* node, OutputStream& stream)
 	return true;
 }
 
+//-----------------------------------------------------------------------------
+bool UIDescWriter::writeCachedNode (UINode* node, OutputStream& stream)
+{
+	auto& xml = node->getWrittenXML ();
+	if (xml.empty () || !node->unchangedSinceWritten ())
+	{
+		xml.clear ();
+		StringOutputStream xmlStream (xml);
+		cachingNode = node;
+		auto result = writeNode (node, xmlStream);
+		cachingNode = nullptr;
+		if (!result)
+		{
+			std::string ().swap (xml);
+			return false;
+		}
+		xml.shrink_to_fit ();
+	}
+	return stream.writeRaw (xml.data (), static_cast<uint32_t> (xml.size ())) == xml.size ();
+}
+
+//-----------------------------------------------------------------------------
+bool UIDescWriter::hasEmbeddedBitmapData (UINode* node)
+{
+	for (auto& child : node->getChildren ())
+	{
+		auto dataNode = dynamic_cast<UIBitmapDataNode*> (child);
+		if (dataNode && dataNode->getDecodedDataSize () > 0)
+			return true;
+	}
+	return false;
+}
+
 //-----------------------------------------------------------------------------
 bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 {
 	bool result = true;
 	if (node->noExport ())
+	{
+		node->setWritten ();
 		return result;
-	for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
+	}
+	if (cachingNode == nullptr && node->getAttributes ()->hasAttribute ("name"))
+	{
+		if (!hasEmbeddedBitmapData (node))
+			return writeCachedNode (node, stream);
+		std::string ().swap (node->getWrittenXML ());
+	}
+	node->setWritten ();
+	writeIntend (stream);
 	if (auto* commentNode = dynamic_cast<UICommentNode*> (node))
 	{
 		return writeComment (commentNode, stream);
 	}
+	if (auto* bitmapDataNode = dynamic_cast<UIBitmapDataNode*> (node))
+	{
+		return writeBitmapData (bitmapDataNode, stream);
+	}
 	stream << "<";
 	stream << node->getName ();
 	result = writeAttributes (node->getAttributes (), stream);
@@ -521,7 +761,7 @@ bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 					return false;
 			}
 			intendLevel--;
-			for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
+			writeIntend (stream);
 			stream << "</";
 			stream << node->getName ();
 			stream << ">\n";
@@ -532,7 +772,7 @@ bool UIDescWriter::writeNode (UINode* node, OutputStream& stream)
 			intendLevel++;
 			result = writeNodeData (node->getData (), stream);
 			intendLevel--;
-			for (int32_t i = 0; i < intendLevel; i++) stream << "\t";
+			writeIntend (stream);
 			stream << "</";
 			stream << node->getName ();
 			stream << ">\n";
@@ -660,9 +900,135 @@ static std::string removeScaleFactorFromName (const std::string& name)
 	return result;
 }
 
+//-----------------------------------------------------------------------------
+/** creates the node for an element of a description or returns nullptr if the element is not
+ *	allowed at this position */
+static UINode* createNode (UINode* parent, bool parentIsRoot, const std::string& name,
+                          const SharedPointer<UIAttributes>& attributes)
+{
+	if (parentIsRoot)
+	{
+		// only allowed second level elements
+		if (name == MainNodeNames::kControlTag || name == MainNodeNames::kColor || name == MainNodeNames::kBitmap)
+			return new UINode (name, attributes, true);
+		if (name == MainNodeNames::kFont || name == MainNodeNames::kTemplate
+		 || name == MainNodeNames::kControlTag || name == MainNodeNames::kCustom
+		 || name == MainNodeNames::kVariable || name == MainNodeNames::kGradient)
+			return new UINode (name, attributes);
+		return nullptr;
+	}
+	if (parent->getName () == MainNodeNames::kBitmap)
+		return name == "bitmap" ? new UIBitmapNode (name, attributes) : nullptr;
+	if (parent->getName () == MainNodeNames::kFont)
+		return name == "font" ? new UIFontNode (name, attributes) : nullptr;
+	if (parent->getName () == MainNodeNames::kColor)
+		return name == "color" ? new UIColorNode (name, attributes) : nullptr;
+	if (parent->getName () == MainNodeNames::kControlTag)
+		return name == "control-tag" ? new UIControlTagNode (name, attributes) : nullptr;
+	if (parent->getName () == MainNodeNames::kVariable)
+		return name == "var" ? new UIVariableNode (name, attributes) : nullptr;
+	if (parent->getName () == MainNodeNames::kGradient)
+		return name == "gradient" ? new UIGradientNode (name, attributes) : nullptr;
+	if (name == "data" && dynamic_cast<UIBitmapNode*> (parent))
+	{
+		auto encoding = attributes->getAttributeValue ("encoding");
+		if (encoding && *encoding == "base64")
+			return new UIBitmapDataNode (attributes);
+	}
+	return new UINode (name, attributes);
+}
+
+//-----------------------------------------------------------------------------
+/** runs tasks on worker threads. Without worker threads a task runs when it is added */
+class TaskQueue
+{
+public:
+	using Task = std::function<void ()>;
+
+	explicit TaskQueue (uint32_t numThreads)
+	{
+		for (auto i = 0u; i < numThreads; ++i)
+			threads.emplace_back ([this] () { work (); });
+	}
+
+	~TaskQueue () noexcept
+	{
+		{
+			std::lock_guard<std::mutex> guard (mutex);
+			exit = true;
+		}
+		taskAdded.notify_all ();
+		for (auto& thread : threads)
+			thread.join ();
+	}
+
+	void add (Task&& task)
+	{
+		if (threads.empty ())
+		{
+			task ();
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> guard (mutex);
+			tasks.emplace_back (std::move (task));
+		}
+		taskAdded.notify_one ();
+	}
+
+	/** runs queued tasks on the calling thread, too, until all added tasks are done */
+	void wait ()
+	{
+		std::unique_lock<std::mutex> lock (mutex);
+		while (!tasks.empty () || numRunning > 0)
+		{
+			if (tasks.empty ())
+				tasksDone.wait (lock);
+			else
+				runTask (lock);
+		}
+	}
+
+private:
+	void runTask (std::unique_lock<std::mutex>& lock)
+	{
+		auto task = std::move (tasks.front ());
+		tasks.pop_front ();
+		++numRunning;
+		lock.unlock ();
+		task ();
+		lock.lock ();
+		if (--numRunning == 0 && tasks.empty ())
+			tasksDone.notify_all ();
+	}
+
+	void work ()
+	{
+		std::unique_lock<std::mutex> lock (mutex);
+		while (true)
+		{
+			taskAdded.wait (lock, [this] () { return exit || !tasks.empty (); });
+			if (tasks.empty ())
+				break;
+			runTask (lock);
+		}
+	}
+
+	std::vector<std::thread> threads;
+	std::deque<Task> tasks;
+	std::mutex mutex;
+	std::condition_variable taskAdded;
+	std::condition_variable tasksDone;
+	uint32_t numRunning {0};
+	bool exit {false};
+};
+
 //-----------------------------------------------------------------------------
 struct Parser : public Xml::IHandler
 {
+	/** with a task queue the embedded bitmaps are decoded by its worker threads */
+	explicit Parser (TaskQueue* taskQueue = nullptr) : taskQueue (taskQueue) {}
+
 	SharedPointer<UINode> parse (Xml::IContentProvider* provider);
 
 	void startXmlElement (Xml::Parser* parser, IdStringPtr elementName, UTF8StringPtr* elementAttributes) override;
@@ -675,6 +1041,8 @@ struct Parser : public Xml::IHandler
 private:
 	SharedPointer<UINode> nodes;
 	std::deque<UINode*> nodeStack;
+	UIBitmapDataNode* bitmapDataNode {nullptr};
+	TaskQueue* taskQueue;
 	bool restoreViewsMode {false};
 };
 
@@ -682,7 +1050,11 @@ private:
 SharedPointer<UINode> Parser::parse (Xml::IContentProvider* provider)
 {
 	Xml::Parser parser;
-	if (parser.parse (provider, this))
+	auto result = parser.parse (provider, this);
+	// the decoding tasks reference the nodes
+	if (taskQueue)
+		taskQueue->wait ();
+	if (result)
 		return std::move (nodes);
 	return nullptr;
 }
@@ -705,62 +1077,11 @@ void Parser::startXmlElement (Xml::Parser* parser, IdStringPtr elementName, UTF8
 		}
 		else
 		{
-			if (parent == nodes)
-			{
-				// only allowed second level elements
-				if (name == MainNodeNames::kControlTag || name == MainNodeNames::kColor || name == MainNodeNames::kBitmap)
-					newNode = new UINode (name, makeOwned<UIAttributes> (elementAttributes), true);
-				else if (name == MainNodeNames::kFont || name == MainNodeNames::kTemplate
-					  || name == MainNodeNames::kControlTag || name == MainNodeNames::kCustom
-					  || name == MainNodeNames::kVariable || name == MainNodeNames::kGradient)
-					newNode = new UINode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kBitmap)
-			{
-				if (name == "bitmap")
-					newNode = new UIBitmapNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kFont)
-			{
-				if (name == "font")
-					newNode = new UIFontNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kColor)
-			{
-				if (name == "color")
-					newNode = new UIColorNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kControlTag)
-			{
-				if (name == "control-tag")
-					newNode = new UIControlTagNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kVariable)
-			{
-				if (name == "var")
-					newNode = new UIVariableNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else if (parent->getName () == MainNodeNames::kGradient)
-			{
-				if (name == "gradient")
-					newNode = new UIGradientNode (name, makeOwned<UIAttributes> (elementAttributes));
-				else
-					parser->stop ();
-			}
-			else
-				newNode = new UINode (name, makeOwned<UIAttributes> (elementAttributes));
+			newNode = createNode (parent, parent == nodes, name, makeOwned<UIAttributes> (elementAttributes));
+			if (!newNode)
+				parser->stop ();
+			else if (auto dataNode = dynamic_cast<UIBitmapDataNode*> (newNode))
+				bitmapDataNode = dataNode;
 		}
 		if (newNode)
 		{
@@ -787,6 +1108,17 @@ void Parser::endXmlElement (Xml::Parser* parser, IdStringPtr name)
 {
 	if (nodeStack.back () == nodes)
 		restoreViewsMode = false;
+	else if (nodeStack.back () == bitmapDataNode)
+	{
+		if (taskQueue)
+		{
+			auto dataNode = bitmapDataNode;
+			taskQueue->add ([dataNode] () { dataNode->finishDecoding (); });
+		}
+		else
+			bitmapDataNode->finishDecoding ();
+		bitmapDataNode = nullptr;
+	}
 	nodeStack.pop_back ();
 }
 
@@ -795,6 +1127,16 @@ void Parser::xmlCharData (Xml::Parser* parser, const int8_t* data, int32_t lengt
 {
 	if (nodeStack.empty ())
 		return;
+	if (bitmapDataNode)
+	{
+		// decode directly from the parser buffer without collecting the encoded string, unless
+		// the decoding runs in parallel to the parsing
+		if (taskQueue)
+			bitmapDataNode->collectEncodedData (data, static_cast<size_t> (length));
+		else
+			bitmapDataNode->appendEncodedData (data, static_cast<size_t> (length));
+		return;
+	}
 	auto& nodeData = nodeStack.back ()->getData ();
 	const int8_t* dataStart = nullptr;
 	uint32_t validChars = 0;
@@ -842,6 +1184,431 @@ void Parser::xmlComment (Xml::Parser* parser, IdStringPtr comment)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Compiled description
+//
+// A binary image of the node tree in native byte order which is memory mapped and turned into
+// nodes without parsing:
+//	CompiledHeader
+//	CompiledString[numStrings]
+//	CompiledNode[numNodes]				depth first, every node is followed by its descendants
+//	CompiledAttribute[numAttributes]
+//	string data							zero terminated, every string is stored only once
+//	blob data							decoded bitmap data, 16 byte aligned
+//-----------------------------------------------------------------------------
+static constexpr uint64_t kCompiledUIDescIdentifier = 0x6e62637365646975ULL; // "uidescbn"
+static constexpr uint32_t kCompiledUIDescByteOrderMark = 0x01020304;
+static constexpr uint32_t kCompiledUIDescVersion = 1;
+static constexpr uint32_t kCompiledNoString = 0xffffffff;
+static constexpr uint64_t kCompiledBlobAlignment = 16;
+
+//-----------------------------------------------------------------------------
+struct CompiledHeader
+{
+	uint64_t identifier;
+	uint32_t byteOrderMark;
+	uint32_t version;
+	uint32_t numStrings;
+	uint32_t numNodes;
+	uint32_t numAttributes;
+	uint32_t stringDataSize;
+	uint64_t stringsOffset;
+	uint64_t nodesOffset;
+	uint64_t attributesOffset;
+	uint64_t stringDataOffset;
+	uint64_t blobDataOffset;
+	uint64_t blobDataSize;
+};
+
+//-----------------------------------------------------------------------------
+struct CompiledString
+{
+	uint32_t offset;
+	uint32_t length;
+};
+
+//-----------------------------------------------------------------------------
+struct CompiledNode
+{
+	enum Type : uint32_t
+	{
+		kElement,
+		kComment,
+		kBitmapData
+	};
+
+	uint32_t name;
+	uint32_t type;
+	uint32_t firstAttribute;
+	uint32_t numAttributes;
+	uint32_t numDescendants;
+	uint32_t data;
+	uint64_t blobOffset;
+	uint64_t blobSize;
+};
+
+//-----------------------------------------------------------------------------
+struct CompiledAttribute
+{
+	uint32_t name;
+	uint32_t value;
+};
+
+//-----------------------------------------------------------------------------
+inline uint64_t alignCompiledBlob (uint64_t value)
+{
+	return (value + kCompiledBlobAlignment - 1) & ~(kCompiledBlobAlignment - 1);
+}
+
+//-----------------------------------------------------------------------------
+inline bool isCompiledDescription (const uint8_t* data, size_t size)
+{
+	uint64_t identifier;
+	if (size < sizeof (identifier))
+		return false;
+	memcpy (&identifier, data, sizeof (identifier));
+	return identifier == kCompiledUIDescIdentifier;
+}
+
+//-----------------------------------------------------------------------------
+class CompiledWriter
+{
+public:
+	bool write (OutputStream& stream, UINode* rootNode);
+
+private:
+	uint32_t addString (const std::string& str);
+	void addNode (UINode* node);
+	bool writePadding (OutputStream& stream, uint64_t size);
+	template<typename T>
+	bool writeTable (OutputStream& stream, const std::vector<T>& table);
+
+	std::unordered_map<std::string, uint32_t> stringIndices;
+	std::vector<CompiledString> strings;
+	std::string stringData;
+	std::vector<CompiledNode> nodes;
+	std::vector<CompiledAttribute> attributes;
+	std::vector<const UIBitmapDataNode*> blobs;
+	uint64_t blobDataSize {0};
+};
+
+//-----------------------------------------------------------------------------
+uint32_t CompiledWriter::addString (const std::string& str)
+{
+	auto it = stringIndices.find (str);
+	if (it != stringIndices.end ())
+		return it->second;
+	auto index = static_cast<uint32_t> (strings.size ());
+	CompiledString entry;
+	entry.offset = static_cast<uint32_t> (stringData.size ());
+	entry.length = static_cast<uint32_t> (str.size ());
+	strings.emplace_back (entry);
+	stringData += str;
+	stringData += '\0';
+	stringIndices.emplace (str, index);
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+void CompiledWriter::addNode (UINode* node)
+{
+	if (node->noExport ())
+		return;
+	CompiledNode entry {};
+	entry.name = addString (node->getName ());
+	entry.type = CompiledNode::kElement;
+	entry.data = kCompiledNoString;
+	if (dynamic_cast<UICommentNode*> (node))
+	{
+		entry.type = CompiledNode::kComment;
+		entry.data = addString (node->getData ());
+	}
+	else if (auto dataNode = dynamic_cast<UIBitmapDataNode*> (node))
+	{
+		entry.type = CompiledNode::kBitmapData;
+		entry.blobOffset = blobDataSize;
+		entry.blobSize = dataNode->getDecodedDataSize ();
+		blobs.emplace_back (dataNode);
+		blobDataSize += alignCompiledBlob (entry.blobSize);
+	}
+	else if (!node->getData ().empty ())
+		entry.data = addString (node->getData ());
+
+	using AttributeRef = const UIAttributes::value_type*;
+	std::vector<AttributeRef> sortedAttributes;
+	for (auto& a : *node->getAttributes ())
+	{
+		if (!a.second.empty ())
+			sortedAttributes.emplace_back (&a);
+	}
+	std::sort (sortedAttributes.begin (), sortedAttributes.end (), [] (AttributeRef lhs, AttributeRef rhs) {
+		return lhs->first.getString () < rhs->first.getString ();
+	});
+	entry.firstAttribute = static_cast<uint32_t> (attributes.size ());
+	entry.numAttributes = static_cast<uint32_t> (sortedAttributes.size ());
+	for (auto& a : sortedAttributes)
+	{
+		CompiledAttribute attribute;
+		attribute.name = addString (a->first);
+		attribute.value = addString (a->second);
+		attributes.emplace_back (attribute);
+	}
+
+	auto nodeIndex = nodes.size ();
+	nodes.emplace_back (entry);
+	for (auto& child : node->getChildren ())
+		addNode (child);
+	nodes[nodeIndex].numDescendants = static_cast<uint32_t> (nodes.size () - nodeIndex - 1);
+}
+
+//-----------------------------------------------------------------------------
+bool CompiledWriter::writePadding (OutputStream& stream, uint64_t size)
+{
+	static const uint8_t zeros[kCompiledBlobAlignment] = {};
+	if (size == 0)
+		return true;
+	return stream.writeRaw (zeros, static_cast<uint32_t> (size)) == size;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+bool CompiledWriter::writeTable (OutputStream& stream, const std::vector<T>& table)
+{
+	if (table.empty ())
+		return true;
+	auto size = static_cast<uint32_t> (table.size () * sizeof (T));
+	return stream.writeRaw (table.data (), size) == size;
+}
+
+//-----------------------------------------------------------------------------
+bool CompiledWriter::write (OutputStream& stream, UINode* rootNode)
+{
+	addNode (rootNode);
+	if (stringData.size () > std::numeric_limits<uint32_t>::max ())
+		return false;
+
+	CompiledHeader header {};
+	header.identifier = kCompiledUIDescIdentifier;
+	header.byteOrderMark = kCompiledUIDescByteOrderMark;
+	header.version = kCompiledUIDescVersion;
+	header.numStrings = static_cast<uint32_t> (strings.size ());
+	header.numNodes = static_cast<uint32_t> (nodes.size ());
+	header.numAttributes = static_cast<uint32_t> (attributes.size ());
+	header.stringDataSize = static_cast<uint32_t> (stringData.size ());
+	header.stringsOffset = sizeof (CompiledHeader);
+	header.nodesOffset = header.stringsOffset + strings.size () * sizeof (CompiledString);
+	header.attributesOffset = header.nodesOffset + nodes.size () * sizeof (CompiledNode);
+	header.stringDataOffset = header.attributesOffset + attributes.size () * sizeof (CompiledAttribute);
+	header.blobDataOffset = alignCompiledBlob (header.stringDataOffset + stringData.size ());
+	header.blobDataSize = blobDataSize;
+
+	if (stream.writeRaw (&header, sizeof (header)) != sizeof (header))
+		return false;
+	if (!writeTable (stream, strings) || !writeTable (stream, nodes) || !writeTable (stream, attributes))
+		return false;
+	if (stream.writeRaw (stringData.data (), static_cast<uint32_t> (stringData.size ())) != stringData.size ())
+		return false;
+	if (!writePadding (stream, header.blobDataOffset - (header.stringDataOffset + stringData.size ())))
+		return false;
+	for (auto& blob : blobs)
+	{
+		auto size = blob->getDecodedDataSize ();
+		if (size && stream.writeRaw (blob->getDecodedData (), size) != size)
+			return false;
+		if (!writePadding (stream, alignCompiledBlob (size) - size))
+			return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+class CompiledReader
+{
+public:
+	SharedPointer<UINode> read (const SharedPointer<CMemoryMappedFile>& file);
+
+private:
+	template<typename T>
+	const T* getTable (uint64_t offset, uint64_t count) const;
+	UTF8StringPtr getString (uint32_t index) const;
+	SharedPointer<UIAttributes> createAttributes (const CompiledNode& node);
+
+	const uint8_t* data {nullptr};
+	size_t dataSize {0};
+	const CompiledHeader* header {nullptr};
+	const CompiledString* strings {nullptr};
+	const CompiledAttribute* attributes {nullptr};
+	const char* stringData {nullptr};
+	std::vector<UTF8StringPtr> attributeStrings;
+};
+
+//-----------------------------------------------------------------------------
+template<typename T>
+const T* CompiledReader::getTable (uint64_t offset, uint64_t count) const
+{
+	if (offset > dataSize || offset % alignof (T) || count > (dataSize - offset) / sizeof (T))
+		return nullptr;
+	return reinterpret_cast<const T*> (data + offset);
+}
+
+//-----------------------------------------------------------------------------
+UTF8StringPtr CompiledReader::getString (uint32_t index) const
+{
+	if (index >= header->numStrings)
+		return nullptr;
+	const auto& entry = strings[index];
+	if (entry.offset >= header->stringDataSize ||
+	    entry.length >= header->stringDataSize - entry.offset ||
+	    stringData[entry.offset + entry.length] != 0)
+		return nullptr;
+	return stringData + entry.offset;
+}
+
+//-----------------------------------------------------------------------------
+SharedPointer<UIAttributes> CompiledReader::createAttributes (const CompiledNode& node)
+{
+	if (node.firstAttribute > header->numAttributes ||
+	    node.numAttributes > header->numAttributes - node.firstAttribute)
+		return nullptr;
+	attributeStrings.clear ();
+	for (auto i = node.firstAttribute; i < node.firstAttribute + node.numAttributes; ++i)
+	{
+		auto name = getString (attributes[i].name);
+		auto value = getString (attributes[i].value);
+		if (!name || !value)
+			return nullptr;
+		attributeStrings.emplace_back (name);
+		attributeStrings.emplace_back (value);
+	}
+	attributeStrings.emplace_back (nullptr);
+	return makeOwned<UIAttributes> (attributeStrings.data ());
+}
+
+//-----------------------------------------------------------------------------
+SharedPointer<UINode> CompiledReader::read (const SharedPointer<CMemoryMappedFile>& file)
+{
+	data = file->data ();
+	dataSize = file->size ();
+	if (!isCompiledDescription (data, dataSize) || !(header = getTable<CompiledHeader> (0, 1)))
+		return nullptr;
+	if (header->byteOrderMark != kCompiledUIDescByteOrderMark ||
+	    header->version != kCompiledUIDescVersion || header->numNodes == 0)
+		return nullptr;
+	strings = getTable<CompiledString> (header->stringsOffset, header->numStrings);
+	auto nodes = getTable<CompiledNode> (header->nodesOffset, header->numNodes);
+	attributes = getTable<CompiledAttribute> (header->attributesOffset, header->numAttributes);
+	stringData = getTable<char> (header->stringDataOffset, header->stringDataSize);
+	auto blobData = getTable<uint8_t> (header->blobDataOffset, header->blobDataSize);
+	if (!strings || !nodes || !attributes || !stringData || !blobData)
+		return nullptr;
+
+	auto rootName = getString (nodes[0].name);
+	auto rootAttributes = createAttributes (nodes[0]);
+	if (!rootName || !rootAttributes || strcmp (rootName, "vstgui-ui-description") != 0 ||
+	    nodes[0].numDescendants != header->numNodes - 1)
+		return nullptr;
+	auto rootNode = makeOwned<UINode> (rootName, rootAttributes);
+
+	struct StackEntry
+	{
+		UINode* node;
+		uint32_t end;
+	};
+	std::vector<StackEntry> nodeStack;
+	nodeStack.push_back ({rootNode, header->numNodes});
+	for (uint32_t index = 1; index < header->numNodes; ++index)
+	{
+		while (index >= nodeStack.back ().end)
+			nodeStack.pop_back ();
+		const auto& entry = nodes[index];
+		auto parent = nodeStack.back ().node;
+		if (entry.numDescendants >= nodeStack.back ().end - index)
+			return nullptr;
+		auto name = getString (entry.name);
+		auto nodeAttributes = createAttributes (entry);
+		if (!name || !nodeAttributes)
+			return nullptr;
+		UINode* newNode = nullptr;
+		switch (entry.type)
+		{
+			case CompiledNode::kComment:
+			{
+				auto comment = getString (entry.data);
+				if (!comment || entry.numDescendants)
+					return nullptr;
+#if VSTGUI_LIVE_EDITING
+				parent->getChildren ().add (new UICommentNode (comment));
+#endif
+				continue;
+			}
+			case CompiledNode::kBitmapData:
+			{
+				if (!dynamic_cast<UIBitmapNode*> (parent) || entry.numDescendants ||
+				    entry.blobOffset > header->blobDataSize ||
+				    entry.blobSize > header->blobDataSize - entry.blobOffset ||
+				    entry.blobSize > std::numeric_limits<uint32_t>::max ())
+					return nullptr;
+				newNode = new UIBitmapDataNode (nodeAttributes, file, blobData + entry.blobOffset,
+				                                static_cast<uint32_t> (entry.blobSize));
+				break;
+			}
+			case CompiledNode::kElement:
+			{
+				newNode = createNode (parent, parent == rootNode, name, nodeAttributes);
+				if (!newNode)
+					return nullptr;
+				if (auto dataNode = dynamic_cast<UIBitmapDataNode*> (newNode))
+					dataNode->finishDecoding ();
+				break;
+			}
+			default:
+				return nullptr;
+		}
+		parent->getChildren ().add (newNode);
+		if (entry.data != kCompiledNoString)
+		{
+			auto nodeData = getString (entry.data);
+			if (!nodeData)
+				return nullptr;
+			newNode->getData () = nodeData;
+		}
+		nodeStack.push_back ({newNode, index + 1 + entry.numDescendants});
+	}
+	return rootNode;
+}
+
+//-----------------------------------------------------------------------------
+/** opens the description if it is a compiled one. Files are memory mapped, other resources are
+ *	read into memory */
+static SharedPointer<CMemoryMappedFile> openCompiledDescription (const CResourceDescription& desc)
+{
+	auto file = makeOwned<CMemoryMappedFile> ();
+	bool isFilePath = desc.type == CResourceDescription::kStringType && desc.u.name;
+	if (isFilePath && pathIsAbsolute (desc.u.name))
+	{
+		if (file->open (desc.u.name) && isCompiledDescription (file->data (), file->size ()))
+			return file;
+		return nullptr;
+	}
+	CResourceInputStream resStream;
+	if (resStream.open (desc))
+	{
+		uint8_t identifier[sizeof (kCompiledUIDescIdentifier)];
+		if (resStream.readRaw (identifier, sizeof (identifier)) != sizeof (identifier) ||
+		    !isCompiledDescription (identifier, sizeof (identifier)))
+			return nullptr;
+		resStream.rewind ();
+		if (file->open (resStream))
+			return file;
+	}
+	else if (isFilePath)
+	{
+		if (file->open (desc.u.name) && isCompiledDescription (file->data (), file->size ()))
+			return file;
+	}
+	return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 } // UIDescriptionPrivate
 
@@ -857,6 +1624,7 @@ struct UIDescription::Impl : ListenerProvider<Impl, UIDescriptionListener>
 	IViewFactory* viewFactory {nullptr};
 	Xml::IContentProvider* xmlContentProvider {nullptr};
 	IBitmapCreator* bitmapCreator { nullptr};
+	uint32_t numWorkerThreads {0};
 
 	SharedPointer<UINode> nodes;
 	SharedPointer<UIDescription> sharedResources;
@@ -874,6 +1642,8 @@ struct UIDescription::Impl : ListenerProvider<Impl, UIDescriptionListener>
 		}
 		return *variableBaseNode;
 	}
+
+	void prepareBitmaps (const UIDescription& description);
 };
 
 //-----------------------------------------------------------------------------
@@ -1013,14 +1783,19 @@ bool UIDescription::parse ()
 {
 	if (parsed ())
 		return true;
-	UIDescriptionPrivate::Parser parser;
+	std::unique_ptr<UIDescriptionPrivate::TaskQueue> taskQueue;
+	if (impl->numWorkerThreads > 0)
+		taskQueue = std::unique_ptr<UIDescriptionPrivate::TaskQueue> (
+		    new UIDescriptionPrivate::TaskQueue (impl->numWorkerThreads));
+	UIDescriptionPrivate::Parser parser (taskQueue.get ());
 	if (impl->xmlContentProvider)
 	{
-		if ((impl->nodes = parser.parse (impl->xmlContentProvider)))
-		{
-			addDefaultNodes ();
-			return true;
-		}
+		impl->nodes = parser.parse (impl->xmlContentProvider);
+	}
+	else if (auto compiledFile = UIDescriptionPrivate::openCompiledDescription (impl->xmlFile))
+	{
+		UIDescriptionPrivate::CompiledReader reader;
+		impl->nodes = reader.read (compiledFile);
 	}
 	else
 	{
@@ -1028,11 +1803,7 @@ bool UIDescription::parse ()
 		if (resInputStream.open (impl->xmlFile))
 		{
 			Xml::InputStreamContentProvider contentProvider (resInputStream);
-			if ((impl->nodes = parser.parse (&contentProvider)))
-			{
-				addDefaultNodes ();
-				return true;
-			}
+			impl->nodes = parser.parse (&contentProvider);
 		}
 		else if (impl->xmlFile.type == CResourceDescription::kStringType)
 		{
@@ -1040,19 +1811,22 @@ bool UIDescription::parse ()
 			if (fileStream.open (impl->xmlFile.u.name, CFileStream::kReadMode))
 			{
 				Xml::InputStreamContentProvider contentProvider (fileStream);
-				if ((impl->nodes = parser.parse (&contentProvider)))
-				{
-					addDefaultNodes ();
-					return true;
-				}
+				impl->nodes = parser.parse (&contentProvider);
 			}
 		}
 	}
-	if (!impl->nodes)
+	if (impl->nodes)
 	{
-		impl->nodes = makeOwned<UINode> ("vstgui-ui-description");
 		addDefaultNodes ();
+		if (taskQueue)
+		{
+			taskQueue->wait ();
+			impl->prepareBitmaps (*this);
+		}
+		return true;
 	}
+	impl->nodes = makeOwned<UINode> ("vstgui-ui-description");
+	addDefaultNodes ();
 	return false;
 }
 
@@ -1092,6 +1866,18 @@ void UIDescription::setBitmapCreator (IBitmapCreator* creator)
 	impl->bitmapCreator = creator;
 }
 
+//-----------------------------------------------------------------------------
+void UIDescription::setNumWorkerThreads (uint32_t numThreads)
+{
+	impl->numWorkerThreads = numThreads;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t UIDescription::getNumWorkerThreads () const
+{
+	return impl->numWorkerThreads;
+}
+
 //-----------------------------------------------------------------------------
 static void FreeNodePlatformResources (UINode* node)
 {
@@ -1213,6 +1999,11 @@ bool UIDescription::saveToStream (OutputStream& stream, int32_t flags)
 	impl->nodes->getAttributes ()->setAttribute ("version", "1");
 	
 	BufferedOutputStream bufferedStream (stream);
+	if (flags & kWriteCompiledDesc)
+	{
+		UIDescriptionPrivate::CompiledWriter writer;
+		return writer.write (bufferedStream, impl->nodes);
+	}
 	UIDescWriter writer;
 	return writer.write (bufferedStream, impl->nodes);
 }
@@ -1417,6 +2208,10 @@ CView* UIDescription::createViewFromNode (UINode* node) const
 	if (result && node->hasChildren ())
 	{
 		CViewContainer* viewContainer = result->asViewContainer ();
+		// layout auto layout containers only once after all children were added
+		auto autoLayoutContainer = dynamic_cast<CAutoLayoutContainerView*> (viewContainer);
+		if (autoLayoutContainer)
+			autoLayoutContainer->beginLayoutUpdates ();
 		for (const auto& itNode : node->getChildren ())
 		{
 			if (viewContainer)
@@ -1453,6 +2248,8 @@ CView* UIDescription::createViewFromNode (UINode* node) const
 				}
 			}
 		}
+		if (autoLayoutContainer)
+			autoLayoutContainer->endLayoutUpdates ();
 	}
 	if (result && impl->controller)
 		result = impl->controller->verifyView (result, *node->getAttributes (), this);
@@ -1639,6 +2436,95 @@ IControlListener* UIDescription::getControlListener (UTF8StringPtr name) const
 	return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+static void applyBitmapFilters (const UIDescription& description, UIBitmapNode* bitmapNode,
+                                CBitmap* bitmap)
+{
+	std::list<SharedPointer<BitmapFilter::IFilter> > filters;
+	for (auto& childNode : bitmapNode->getChildren ())
+	{
+		const std::string* filterName = nullptr;
+		if (childNode->getName () == "filter" && (filterName = childNode->getAttributes ()->getAttributeValue ("name")))
+		{
+			auto filter = owned (BitmapFilter::Factory::getInstance().createFilter (filterName->c_str ()));
+			if (filter == nullptr)
+				continue;
+			filters.emplace_back (filter);
+			for (auto& propertyNode : childNode->getChildren ())
+			{
+				if (propertyNode->getName () != "property")
+					continue;
+				const std::string* propName = propertyNode->getAttributes ()->getAttributeValue ("name");
+				if (propName == nullptr)
+					continue;
+				switch (filter->getProperty (propName->c_str ()).getType ())
+				{
+					case BitmapFilter::Property::kInteger:
+					{
+						int32_t intValue;
+						if (propertyNode->getAttributes ()->getIntegerAttribute ("value", intValue))
+							filter->setProperty (propName->c_str (), intValue);
+						break;
+					}
+					case BitmapFilter::Property::kFloat:
+					{
+						double floatValue;
+						if (propertyNode->getAttributes ()->getDoubleAttribute ("value", floatValue))
+							filter->setProperty (propName->c_str (), floatValue);
+						break;
+					}
+					case BitmapFilter::Property::kPoint:
+					{
+						CPoint pointValue;
+						if (propertyNode->getAttributes ()->getPointAttribute ("value", pointValue))
+							filter->setProperty (propName->c_str (), pointValue);
+						break;
+					}
+					case BitmapFilter::Property::kRect:
+					{
+						CRect rectValue;
+						if (propertyNode->getAttributes ()->getRectAttribute ("value", rectValue))
+							filter->setProperty (propName->c_str (), rectValue);
+						break;
+					}
+					case BitmapFilter::Property::kColor:
+					{
+						const std::string* colorString = propertyNode->getAttributes()->getAttributeValue ("value");
+						if (colorString)
+						{
+							CColor color;
+							if (description.getColor (colorString->c_str (), color))
+								filter->setProperty(propName->c_str (), color);
+						}
+						break;
+					}
+					case BitmapFilter::Property::kTransformMatrix:
+					{
+						// TODO
+						break;
+					}
+					case BitmapFilter::Property::kObject: // objects can not be stored/restored
+					case BitmapFilter::Property::kUnknown:
+						break;
+				}
+			}
+		}
+	}
+	for (auto& filter : filters)
+	{
+		filter->setProperty (BitmapFilter::Standard::Property::kInputBitmap, bitmap);
+		if (filter->run ())
+		{
+			auto obj = filter->getProperty (BitmapFilter::Standard::Property::kOutputBitmap).getObject ();
+			if (auto* outputBitmap = dynamic_cast<CBitmap*>(obj))
+			{
+				bitmap->setPlatformBitmap (outputBitmap->getPlatformBitmap ());
+			}
+		}
+	}
+	bitmapNode->setFilterProcessed ();
+}
+
 //-----------------------------------------------------------------------------
 CBitmap* UIDescription::getBitmap (UTF8StringPtr name) const
 {
@@ -1658,91 +2544,7 @@ CBitmap* UIDescription::getBitmap (UTF8StringPtr name) const
 			}
 		}
 		if (bitmap && bitmapNode->getFilterProcessed () == false)
-		{
-			std::list<SharedPointer<BitmapFilter::IFilter> > filters;
-			for (auto& childNode : bitmapNode->getChildren ())
-			{
-				const std::string* filterName = nullptr;
-				if (childNode->getName () == "filter" && (filterName = childNode->getAttributes ()->getAttributeValue ("name")))
-				{
-					auto filter = owned (BitmapFilter::Factory::getInstance().createFilter (filterName->c_str ()));
-					if (filter == nullptr)
-						continue;
-					filters.emplace_back (filter);
-					for (auto& propertyNode : childNode->getChildren ())
-					{
-						if (propertyNode->getName () != "property")
-							continue;
-						const std::string* propName = propertyNode->getAttributes ()->getAttributeValue ("name");
-						if (propName == nullptr)
-							continue;
-						switch (filter->getProperty (propName->c_str ()).getType ())
-						{
-							case BitmapFilter::Property::kInteger:
-							{
-								int32_t intValue;
-								if (propertyNode->getAttributes ()->getIntegerAttribute ("value", intValue))
-									filter->setProperty (propName->c_str (), intValue);
-								break;
-							}
-							case BitmapFilter::Property::kFloat:
-							{
-								double floatValue;
-								if (propertyNode->getAttributes ()->getDoubleAttribute ("value", floatValue))
-									filter->setProperty (propName->c_str (), floatValue);
-								break;
-							}
-							case BitmapFilter::Property::kPoint:
-							{
-								CPoint pointValue;
-								if (propertyNode->getAttributes ()->getPointAttribute ("value", pointValue))
-									filter->setProperty (propName->c_str (), pointValue);
-								break;
-							}
-							case BitmapFilter::Property::kRect:
-							{
-								CRect rectValue;
-								if (propertyNode->getAttributes ()->getRectAttribute ("value", rectValue))
-									filter->setProperty (propName->c_str (), rectValue);
-								break;
-							}
-							case BitmapFilter::Property::kColor:
-							{
-								const std::string* colorString = propertyNode->getAttributes()->getAttributeValue ("value");
-								if (colorString)
-								{
-									CColor color;
-									if (getColor (colorString->c_str (), color))
-										filter->setProperty(propName->c_str (), color);
-								}
-								break;
-							}
-							case BitmapFilter::Property::kTransformMatrix:
-							{
-								// TODO
-								break;
-							}
-							case BitmapFilter::Property::kObject: // objects can not be stored/restored
-							case BitmapFilter::Property::kUnknown:
-								break;
-						}
-					}
-				}
-			}
-			for (auto& filter : filters)
-			{
-				filter->setProperty (BitmapFilter::Standard::Property::kInputBitmap, bitmap);
-				if (filter->run ())
-				{
-					auto obj = filter->getProperty (BitmapFilter::Standard::Property::kOutputBitmap).getObject ();
-					if (auto* outputBitmap = dynamic_cast<CBitmap*>(obj))
-					{
-						bitmap->setPlatformBitmap (outputBitmap->getPlatformBitmap ());
-					}
-				}
-			}
-			bitmapNode->setFilterProcessed ();
-		}
+			applyBitmapFilters (*this, bitmapNode, bitmap);
 		if (bitmap && bitmapNode->getScaledBitmapsAdded () == false)
 		{
 			double scaleFactor;
@@ -1775,6 +2577,27 @@ CBitmap* UIDescription::getBitmap (UTF8StringPtr name) const
 	return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+void UIDescription::Impl::prepareBitmaps (const UIDescription& description)
+{
+	// the bitmaps of shared resources belong to the other description
+	if (sharedResources)
+		return;
+	// the platform bitmaps, their reference counts and the filter factory are not thread safe, so
+	// only the decoding runs on the worker threads
+	auto bitmapsNode = description.getBaseNode (MainNodeNames::kBitmap);
+	for (auto& child : bitmapsNode->getChildren ())
+	{
+		auto bitmapNode = dynamic_cast<UIBitmapNode*> (child);
+		if (!bitmapNode)
+			continue;
+		// bitmaps without a platform bitmap are left to the bitmap creator in getBitmap ()
+		auto bitmap = bitmapNode->getBitmap (filePath);
+		if (bitmap && bitmap->getPlatformBitmap () && !bitmapNode->getFilterProcessed ())
+			applyBitmapFilters (description, bitmapNode, bitmap);
+	}
+}
+
 //-----------------------------------------------------------------------------
 CFontRef UIDescription::getFont (UTF8StringPtr name) const
 {
@@ -3017,6 +3840,33 @@ void UINode::sortChildren ()
 	children->sort ();
 }
 
+//-----------------------------------------------------------------------------
+void UINode::setWritten ()
+{
+	writtenAttributesVersion = attributes->getVersion ();
+	writtenChildrenVersion = children->getVersion ();
+	writtenFlags = flags;
+}
+
+//-----------------------------------------------------------------------------
+bool UINode::unchangedSinceWritten () const
+{
+	if (writtenFlags != flags)
+		return false;
+	// the writer skips nodes which are not exported
+	if (noExport ())
+		return true;
+	if (writtenAttributesVersion != attributes->getVersion () ||
+	    writtenChildrenVersion != children->getVersion ())
+		return false;
+	for (auto& child : *children)
+	{
+		if (!child->unchangedSinceWritten ())
+			return false;
+	}
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -3216,15 +4066,18 @@ void UIBitmapNode::createXMLData (const std::string& pathHint)
 	UINode* node = getChildren ().findChildNode ("data");
 	if (node)
 	{
-		if (node->getData ().empty ())
+		if (node != dataNode ())
 		{
 			getChildren ().remove (node);
 			node = nullptr;
 		}
 		else if (auto bm = getBitmap (pathHint))
 		{
+			auto bitmapDataNode = dynamic_cast<UIBitmapDataNode*> (node);
 			if (auto platformBitmap = bm->getPlatformBitmap ())
 			{
+				if (bitmapDataNode && bitmapDataNode->isVerifiedWith (platformBitmap))
+					return;
 				if (auto dataBitmap = createBitmapFromDataNode ())
 				{
 					if (!imagesEqual (platformBitmap, dataBitmap))
@@ -3232,6 +4085,8 @@ void UIBitmapNode::createXMLData (const std::string& pathHint)
 						removeXMLData ();
 						node = nullptr;
 					}
+					else if (bitmapDataNode)
+						bitmapDataNode->setVerifiedWith (platformBitmap);
 				}
 			}
 		}
@@ -3245,11 +4100,9 @@ void UIBitmapNode::createXMLData (const std::string& pathHint)
 				auto buffer = IPlatformBitmap::createMemoryPNGRepresentation (platformBitmap);
 				if (!buffer.empty ())
 				{
-					auto result = Base64Codec::encode (buffer.data(), static_cast<uint32_t> (buffer.size ()));
-					UINode* dataNode = new UINode ("data");
-					dataNode->getAttributes ()->setAttribute ("encoding", "base64");
-					dataNode->getData ().append (reinterpret_cast<const char*> (result.data.get ()), static_cast<std::streamsize> (result.dataSize));
-					getChildren ().add (dataNode);
+					auto bitmapDataNode = new UIBitmapDataNode (buffer.data (), buffer.size ());
+					bitmapDataNode->setVerifiedWith (platformBitmap);
+					getChildren ().add (bitmapDataNode);
 				}
 			}
 		}
@@ -3276,6 +4129,8 @@ CBitmap* UIBitmapNode::createBitmap (const std::string& str, CNinePartTiledDescr
 UINode* UIBitmapNode::dataNode () const
 {
 	UINode* node = getChildren ().findChildNode ("data");
+	if (auto bitmapDataNode = dynamic_cast<UIBitmapDataNode*> (node))
+		return bitmapDataNode->getDecodedDataSize () ? node : nullptr;
 	return (node && !node->getData ().empty ()) ? node : nullptr;
 }
 
@@ -3284,18 +4139,27 @@ SharedPointer<IPlatformBitmap> UIBitmapNode::createBitmapFromDataNode () const
 {
 	if (auto node = dataNode ())
 	{
-		auto codecStr = node->getAttributes ()->getAttributeValue ("encoding");
-		if (codecStr && *codecStr == "base64")
+		SharedPointer<IPlatformBitmap> platformBitmap;
+		if (auto bitmapDataNode = dynamic_cast<UIBitmapDataNode*> (node))
 		{
-			auto result = Base64Codec::decode (node->getData ());
-			if (auto platformBitmap = IPlatformBitmap::createFromMemory (result.data.get (), result.dataSize))
+			platformBitmap = IPlatformBitmap::createFromMemory (bitmapDataNode->getDecodedData (), bitmapDataNode->getDecodedDataSize ());
+		}
+		else
+		{
+			auto codecStr = node->getAttributes ()->getAttributeValue ("encoding");
+			if (codecStr && *codecStr == "base64")
 			{
-				double scaleFactor = 1.;
-				if (attributes->getDoubleAttribute ("scale-factor", scaleFactor))
-					platformBitmap->setScaleFactor (scaleFactor);
-				return platformBitmap;
+				auto result = Base64Codec::decode (node->getData ());
+				platformBitmap = IPlatformBitmap::createFromMemory (result.data.get (), result.dataSize);
 			}
 		}
+		if (platformBitmap)
+		{
+			double scaleFactor = 1.;
+			if (attributes->getDoubleAttribute ("scale-factor", scaleFactor))
+				platformBitmap->setScaleFactor (scaleFactor);
+			return platformBitmap;
+		}
 	}
 	return nullptr;
 }
@@ -3391,6 +4255,72 @@ void UIBitmapNode::invalidBitmap ()
 	filterProcessed = false;
 }
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+UIBitmapDataNode::UIBitmapDataNode (const SharedPointer<UIAttributes>& attributes)
+: UINode ("data", attributes)
+, decoder (std::unique_ptr<Base64Codec::StreamDecoder> (new Base64Codec::StreamDecoder))
+{
+}
+
+//-----------------------------------------------------------------------------
+UIBitmapDataNode::UIBitmapDataNode (const void* data, size_t dataSize)
+: UINode ("data")
+{
+	attributes->setAttribute ("encoding", "base64");
+	decodedData.data.allocate (dataSize);
+	if (dataSize)
+		memcpy (decodedData.data.get (), data, dataSize);
+	decodedData.dataSize = static_cast<uint32_t> (dataSize);
+}
+
+//-----------------------------------------------------------------------------
+UIBitmapDataNode::UIBitmapDataNode (const SharedPointer<UIAttributes>& attributes,
+                                    const SharedPointer<CMemoryMappedFile>& file,
+                                    const uint8_t* data, uint32_t dataSize)
+: UINode ("data", attributes)
+, mappedFile (file)
+, mappedData (data)
+, mappedDataSize (dataSize)
+{
+}
+
+//-----------------------------------------------------------------------------
+void UIBitmapDataNode::appendEncodedData (const int8_t* data, size_t size)
+{
+	vstgui_assert (decoder);
+	if (decoder)
+		decoder->decode (data, size);
+}
+
+//-----------------------------------------------------------------------------
+void UIBitmapDataNode::collectEncodedData (const int8_t* data, size_t size)
+{
+	getData ().append (reinterpret_cast<const char*> (data), size);
+}
+
+//-----------------------------------------------------------------------------
+void UIBitmapDataNode::finishDecoding ()
+{
+	if (decoder)
+	{
+		if (!getData ().empty ())
+		{
+			decoder->decode (reinterpret_cast<const int8_t*> (getData ().data ()), getData ().size ());
+			DataStorage ().swap (getData ());
+		}
+		decodedData = decoder->finish ();
+		decoder = nullptr;
+	}
+}
+
+//-----------------------------------------------------------------------------
+Base64Codec::Result UIBitmapDataNode::encodeData () const
+{
+	return Base64Codec::encode (getDecodedData (), getDecodedDataSize ());
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -27,6 +27,7 @@ protected:
 		WriteWindowsResourceFileBit = 0,
 		WriteImagesIntoXMLFileBit,
 		DoNotVerifyImageXMLDataBit,
+		WriteCompiledDescBit,
 		LastSaveFlagBit,
 	};
 public:
@@ -40,6 +41,8 @@ public:
 		kWriteWindowsResourceFile	= 1 << WriteWindowsResourceFileBit,
 		kWriteImagesIntoXMLFile		= 1 << WriteImagesIntoXMLFileBit,
 		kDoNotVerifyImageXMLData	= 1 << DoNotVerifyImageXMLDataBit,
+		/** write the memory mappable binary format instead of XML, parse () detects it */
+		kWriteCompiledDesc			= 1 << WriteCompiledDescBit,
 	};
 
 	virtual bool save (UTF8StringPtr filename, int32_t flags = kWriteWindowsResourceFile);
@@ -134,6 +137,16 @@ public:
 
 	void setBitmapCreator (IBitmapCreator* bitmapCreator);
 
+	/** number of worker threads parse () uses.
+	 *
+	 *	The workers decode the embedded bitmap data while the XML is parsed. Afterwards the calling
+	 *	thread creates the bitmaps and applies their filters, so that createView () only needs to
+	 *	create the views. The default 0 decodes the data on the calling thread and creates the
+	 *	bitmaps when they are used first.
+	 */
+	void setNumWorkerThreads (uint32_t numThreads);
+	uint32_t getNumWorkerThreads () const;
+
 	using FocusDrawing = FocusDrawingSettings;
 	FocusDrawing getFocusDrawingSettings () const;
 	void setFocusDrawingSettings (const FocusDrawing& fd);
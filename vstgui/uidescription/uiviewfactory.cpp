@@ -234,7 +234,7 @@ void UIViewFactory::evaluateAttributesAndRemember (CView* view, const UIAttribut
 		if (description && description->getVariable (value.c_str (), evaluatedValue))
 		{
 		#if VSTGUI_LIVE_EDITING
-			rememberAttribute (view, attr.first.c_str (), value.c_str ());
+			rememberAttribute (view, attr.first.getString ().c_str (), value.c_str ());
 		#endif
 			evaluatedAttributes.setAttribute (attr.first, evaluatedValue);
 		}
@@ -248,7 +248,7 @@ void UIViewFactory::evaluateAttributesAndRemember (CView* view, const UIAttribut
 				case IViewCreator::kTagType:
 				case IViewCreator::kFontType:
 				case IViewCreator::kGradientType:
-					rememberAttribute (view, attr.first.c_str (), value.c_str ());
+					rememberAttribute (view, attr.first.getString ().c_str (), value.c_str ());
 					break;
 				default:
 					break;
@@ -76,6 +76,9 @@ bool ViewContainerCreator::apply (CView* view, const UIAttributes& attributes,
 			}
 		}
 	}
+	bool b;
+	if (attributes.getBooleanAttribute (kAttrCacheAsBitmap, b))
+		viewContainer->setCacheAsBitmap (b);
 	return true;
 }
 
@@ -84,6 +87,7 @@ bool ViewContainerCreator::getAttributeNames (StringList& attributeNames) const
 {
 	attributeNames.emplace_back (kAttrBackgroundColor);
 	attributeNames.emplace_back (kAttrBackgroundColorDrawStyle);
+	attributeNames.emplace_back (kAttrCacheAsBitmap);
 	return true;
 }
 
@@ -94,6 +98,8 @@ auto ViewContainerCreator::getAttributeType (const string& attributeName) const
 		return kColorType;
 	if (attributeName == kAttrBackgroundColorDrawStyle)
 		return kListType;
+	if (attributeName == kAttrCacheAsBitmap)
+		return kBooleanType;
 	return kUnknownType;
 }
 
@@ -114,6 +120,11 @@ bool ViewContainerCreator::getAttributeValue (CView* view, const string& attribu
 		stringValue = backgroundColorDrawStyleStrings ()[vc->getBackgroundColorDrawStyle ()];
 		return true;
 	}
+	if (attributeName == kAttrCacheAsBitmap)
+	{
+		stringValue = vc->getCacheAsBitmap () ? strTrue : strFalse;
+		return true;
+	}
 	return false;
 }
 
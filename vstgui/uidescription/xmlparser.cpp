@@ -114,22 +114,28 @@ bool Parser::parse (IContentProvider* provider, IHandler* handler)
 	XML_SetCharacterDataHandler (pImpl->parser, gCharacterDataHandler);
 	XML_SetCommentHandler (pImpl->parser, gCommentHandler);
 
-	static const uint32_t kBufferSize = 0x8000;
+	static const uint32_t kMinBufferSize = 0x8000;
+	static const uint32_t kMaxBufferSize = 0x100000;
 
 	provider->rewind ();
 
+	// start small for small descriptions and let the buffer grow while the provider fills it
+	// completely, so that big descriptions are parsed with less calls
+	uint32_t bufferSize = kMinBufferSize;
 	while (true) 
 	{
-		void* buffer = XML_GetBuffer (pImpl->parser, kBufferSize);
+		void* buffer = XML_GetBuffer (pImpl->parser, static_cast<int> (bufferSize));
 		if (buffer == nullptr)
 		{
 			pImpl->handler = nullptr;
 			return false;
 		}
 
-		uint32_t bytesRead = provider->readRawXmlData ((int8_t*)buffer, kBufferSize);
+		uint32_t bytesRead = provider->readRawXmlData ((int8_t*)buffer, bufferSize);
 		if (bytesRead == kStreamIOError)
 			bytesRead = 0;
+		else if (bytesRead == bufferSize && bufferSize < kMaxBufferSize)
+			bufferSize *= 2;
 		XML_Status status = XML_ParseBuffer (pImpl->parser, static_cast<int> (bytesRead), bytesRead == 0);
 		switch (status) 
 		{
@@ -30,7 +30,9 @@
 #include "lib/cview.cpp"
 #include "lib/cviewcontainer.cpp"
 #include "lib/cvstguitimer.cpp"
+#include "lib/drawprofiler.cpp"
 #include "lib/genericstringlistdatabrowsersource.cpp"
+#include "lib/timerwheel.cpp"
 #include "lib/vstguidebug.cpp"
 
 #include "lib/controls/cautoanimation.cpp"
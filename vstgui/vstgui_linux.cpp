@@ -2,6 +2,8 @@
 
 #include "lib/platform/linux/linuxstring.cpp"
 
+#include "lib/platform/linux/headlessframe.cpp"
+#include "lib/platform/linux/x11drawhandler.cpp"
 #include "lib/platform/linux/x11frame.cpp"
 #include "lib/platform/linux/x11platform.cpp"
 #include "lib/platform/linux/x11timer.cpp"